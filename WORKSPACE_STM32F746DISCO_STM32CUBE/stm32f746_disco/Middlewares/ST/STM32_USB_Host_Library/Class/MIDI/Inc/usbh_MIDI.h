@@ -42,6 +42,19 @@
 #define USB_MIDI_DATA_IN_SIZE           64
 #define USB_MIDI_DATA_OUT_SIZE          64
 
+// receive ring: IN transfers buffered between the host core and the parser (power of 2)
+#ifndef USBH_MIDI_RX_BUFFERS
+#define USBH_MIDI_RX_BUFFERS      4
+#endif
+
+// parser: virtual cables tracked, SysEx bytes kept per cable
+#ifndef USBH_MIDI_CABLES
+#define USBH_MIDI_CABLES          16
+#endif
+#ifndef USBH_MIDI_SYSEX_SIZE
+#define USBH_MIDI_SYSEX_SIZE      32
+#endif
+
 // endpoint assignments (don't change!)
 #define USB_MIDI_DATA_OUT_EP 0x02
 #define USB_MIDI_DATA_IN_EP  0x81
@@ -174,12 +187,49 @@ typedef struct _MIDI_Process
 	MIDI_DataStateTypeDef		data_tx_state;
 	MIDI_DataStateTypeDef		data_rx_state;
 	uint8_t						Rx_Poll;
+
+	/* continuous reception (USBH_MIDI_StartReception) */
+	uint8_t			RxContinuous;
+	uint8_t			RxHead;		// buffer being filled by the core
+	uint8_t			RxTail;		// oldest filled buffer not yet released
+	uint16_t		RxLength[USBH_MIDI_RX_BUFFERS];
+	uint32_t		RxStalls;	// ring full: IN transfers held (NAKed) until a release
+	uint8_t			RxBuff[USBH_MIDI_RX_BUFFERS][USB_MIDI_DATA_IN_SIZE] __ALIGNED(4);
 	//uint8_t			buff[8];
 	//MIDI_DataItfTypedef                DataItf;
 	//CDC_InterfaceDesc_Typedef         CDC_Desc;
 }
 MIDI_HandleTypeDef;
 
+/* Result of USBH_MIDI_ParsePacket */
+typedef enum
+{
+	MIDI_PARSE_NONE = 0,	// byte(s) stored or ignored, no complete message
+	MIDI_PARSE_CHANNEL,		// complete channel voice message in *msg
+	MIDI_PARSE_SYSTEM,		// complete system common / real-time message in *msg
+	MIDI_PARSE_SYSEX,		// SysEx ended: sysex[] / sysex_len of cable msg->cable
+}
+MIDI_ParseResultTypeDef;
+
+/* Parser state of one virtual cable */
+typedef struct
+{
+	uint8_t			running_status;		// 0: none
+	uint8_t			data[2];			// data bytes received under running status (CIN 0xF)
+	uint8_t			data_count;
+	uint8_t			sysex_active;
+	uint8_t			sysex_overflow;		// bytes dropped past USBH_MIDI_SYSEX_SIZE
+	uint16_t		sysex_len;
+	uint8_t			sysex[USBH_MIDI_SYSEX_SIZE];
+}
+MIDI_CableParserTypeDef;
+
+typedef struct
+{
+	MIDI_CableParserTypeDef		cable[USBH_MIDI_CABLES];
+}
+MIDI_ParserTypeDef;
+
 /*---------------------------Exported_FunctionsPrototype-------------------------------------*/
 
 USBH_StatusTypeDef  USBH_MIDI_Transmit(USBH_HandleTypeDef *phost,
@@ -191,6 +241,18 @@ USBH_StatusTypeDef  USBH_MIDI_Receive(USBH_HandleTypeDef *phost,
                                      uint16_t length);
 
 
+USBH_StatusTypeDef  USBH_MIDI_StartReception(USBH_HandleTypeDef *phost);
+
+uint8_t*            USBH_MIDI_GetRxBuffer(USBH_HandleTypeDef *phost, uint16_t *length);
+
+void                USBH_MIDI_ReleaseRxBuffer(USBH_HandleTypeDef *phost);
+
+void                USBH_MIDI_ParserInit(MIDI_ParserTypeDef *parser);
+
+MIDI_ParseResultTypeDef USBH_MIDI_ParsePacket(MIDI_ParserTypeDef *parser,
+                                             const uint8_t *packet,
+                                             midi_package_t *msg);
+
 uint16_t            USBH_MIDI_GetLastReceivedDataSize(USBH_HandleTypeDef *phost);
 
 USBH_StatusTypeDef  USBH_MIDI_Stop(USBH_HandleTypeDef *phost);
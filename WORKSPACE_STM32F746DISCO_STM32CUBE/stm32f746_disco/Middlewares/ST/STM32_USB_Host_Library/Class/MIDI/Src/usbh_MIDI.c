@@ -51,6 +51,14 @@ static void MIDI_ProcessTransmission(USBH_HandleTypeDef *phost);
 
 static void MIDI_ProcessReception(USBH_HandleTypeDef *phost);
 
+static uint16_t MIDI_RxTransferSize(MIDI_HandleTypeDef *MIDI_Handle);
+
+static void MIDI_RearmReception(USBH_HandleTypeDef *phost);
+
+static uint8_t MIDI_DataLength(uint8_t status);
+
+static void MIDI_SysExAppend(MIDI_CableParserTypeDef *cp, const uint8_t *data, uint8_t n);
+
 /*-------------------------------------------------------------------------*/
 
 USBH_ClassTypeDef  MIDI_Class =
@@ -229,6 +237,7 @@ USBH_StatusTypeDef  USBH_MIDI_Stop(USBH_HandleTypeDef *phost)
   if(phost->gState == HOST_CLASS)
   {
     MIDI_Handle->state = MIDI_IDLE_STATE;
+    MIDI_Handle->RxContinuous = 0;
 
     USBH_ClosePipe(phost, MIDI_Handle->InPipe);
     USBH_ClosePipe(phost, MIDI_Handle->OutPipe);
@@ -355,6 +364,7 @@ USBH_StatusTypeDef  USBH_MIDI_Receive(USBH_HandleTypeDef *phost, uint8_t *pbuff,
 
 	if((MIDI_Handle->state == MIDI_IDLE_STATE) || (MIDI_Handle->state == MIDI_TRANSFER_DATA))
 	{
+		MIDI_Handle->RxContinuous = 0;
 		MIDI_Handle->pRxData = pbuff;
 		MIDI_Handle->RxDataLength = length;
 		MIDI_Handle->state = MIDI_TRANSFER_DATA;
@@ -369,6 +379,104 @@ USBH_StatusTypeDef  USBH_MIDI_Receive(USBH_HandleTypeDef *phost, uint8_t *pbuff,
 
 /*------------------------------------------------------------------------------------------------------------------------------*/
 
+/**
+ * @brief  Starts continuous reception into the class receive ring
+ *         (USBH_MIDI_RX_BUFFERS endpoint packets). Each completed transfer is
+ *         handed over through USBH_MIDI_ReceiveCallback and the next one is
+ *         issued immediately; USBH_MIDI_GetRxBuffer / USBH_MIDI_ReleaseRxBuffer
+ *         give access to the filled buffers, oldest first.
+ * @param  phost: Host handle
+ * @retval USBH Status
+ */
+USBH_StatusTypeDef  USBH_MIDI_StartReception(USBH_HandleTypeDef *phost)
+{
+	USBH_StatusTypeDef Status = USBH_BUSY;
+	MIDI_HandleTypeDef *MIDI_Handle =  phost->pActiveClass->pData;
+
+	if((MIDI_Handle->state == MIDI_IDLE_STATE) || (MIDI_Handle->state == MIDI_TRANSFER_DATA))
+	{
+		MIDI_Handle->RxContinuous = 1;
+		MIDI_Handle->RxHead = 0;
+		MIDI_Handle->RxTail = 0;
+		MIDI_Handle->pRxData = MIDI_Handle->RxBuff[0];
+		MIDI_Handle->RxDataLength = USB_MIDI_DATA_IN_SIZE;
+		MIDI_Handle->state = MIDI_TRANSFER_DATA;
+		MIDI_Handle->data_rx_state = MIDI_RECEIVE_DATA;
+		Status = USBH_OK;
+#if (USBH_USE_OS == 1)
+		osMessagePut ( phost->os_event, USBH_CLASS_EVENT, 0);
+#endif
+	}
+	return Status;
+}
+
+/*------------------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * @brief  Oldest filled receive buffer (continuous reception)
+ * @param  phost: Host handle
+ * @param  length: set to the number of bytes received
+ * @retval Buffer, or NULL if none is pending
+ */
+uint8_t* USBH_MIDI_GetRxBuffer(USBH_HandleTypeDef *phost, uint16_t *length)
+{
+	MIDI_HandleTypeDef *MIDI_Handle;
+	uint8_t index;
+
+	if((phost->gState != HOST_CLASS) || (phost->pActiveClass == NULL))
+	{
+		*length = 0;
+		return NULL;
+	}
+	MIDI_Handle = phost->pActiveClass->pData;
+	if((MIDI_Handle == NULL) || (MIDI_Handle->RxTail == MIDI_Handle->RxHead))
+	{
+		*length = 0;
+		return NULL;
+	}
+	index = MIDI_Handle->RxTail % USBH_MIDI_RX_BUFFERS;
+	*length = MIDI_Handle->RxLength[index];
+	return MIDI_Handle->RxBuff[index];
+}
+
+/*------------------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * @brief  Gives the buffer returned by USBH_MIDI_GetRxBuffer back to the ring.
+ *         Must be called from the host process context (receive callback or
+ *         the task running USBH_Process). Resumes a reception held on a full ring.
+ * @param  phost: Host handle
+ * @retval None
+ */
+void USBH_MIDI_ReleaseRxBuffer(USBH_HandleTypeDef *phost)
+{
+	MIDI_HandleTypeDef *MIDI_Handle;
+
+	if(phost->pActiveClass == NULL)
+	{
+		return;
+	}
+	MIDI_Handle = phost->pActiveClass->pData;
+	if((MIDI_Handle == NULL) || (MIDI_Handle->RxTail == MIDI_Handle->RxHead))
+	{
+		return;
+	}
+	MIDI_Handle->RxTail++;
+
+	if(MIDI_Handle->RxContinuous && (MIDI_Handle->state == MIDI_TRANSFER_DATA) &&
+			(MIDI_Handle->data_rx_state == MIDI_IDLE))
+	{
+		MIDI_Handle->pRxData = MIDI_Handle->RxBuff[MIDI_Handle->RxHead % USBH_MIDI_RX_BUFFERS];
+		MIDI_Handle->RxDataLength = USB_MIDI_DATA_IN_SIZE;
+		MIDI_Handle->data_rx_state = MIDI_RECEIVE_DATA;
+#if (USBH_USE_OS == 1)
+		osMessagePut ( phost->os_event, USBH_CLASS_EVENT, 0);
+#endif
+	}
+}
+
+/*------------------------------------------------------------------------------------------------------------------------------*/
+
 /**
  * @brief  The function is responsible for sending data to the device
  *  @param  pdev: Selected device
@@ -468,7 +576,7 @@ static void MIDI_ProcessReception(USBH_HandleTypeDef *phost)
 
 		USBH_BulkReceiveData (phost,
 				MIDI_Handle->pRxData,
-				MIDI_Handle->InEpSize,
+				MIDI_RxTransferSize(MIDI_Handle),
 				MIDI_Handle->InPipe);
 
 		MIDI_Handle->data_rx_state = MIDI_RECEIVE_DATA_WAIT;
@@ -489,7 +597,22 @@ static void MIDI_ProcessReception(USBH_HandleTypeDef *phost)
 
 			length = USBH_LL_GetLastXferSize(phost, MIDI_Handle->InPipe);
 
-			if(((MIDI_Handle->RxDataLength - length) > 0) && (length > MIDI_Handle->InEpSize))
+			if(MIDI_Handle->RxContinuous)
+			{
+				/* Re-arm before the callback: the next IN transfer lands in the
+				   following buffer while the application parses this one */
+				if(length > 0)
+				{
+					MIDI_Handle->RxLength[MIDI_Handle->RxHead % USBH_MIDI_RX_BUFFERS] = length;
+					MIDI_Handle->RxHead++;
+				}
+				MIDI_RearmReception(phost);
+				if(length > 0)
+				{
+					USBH_MIDI_ReceiveCallback(phost);
+				}
+			}
+			else if(((MIDI_Handle->RxDataLength - length) > 0) && (length > MIDI_Handle->InEpSize))
 			{
 				MIDI_Handle->RxDataLength -= length ;
 				MIDI_Handle->pRxData += length;
@@ -511,6 +634,270 @@ static void MIDI_ProcessReception(USBH_HandleTypeDef *phost)
 	}
 }
 
+/*------------------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * @brief  Size of the next IN transfer: one endpoint packet, within the buffer
+ * @param  MIDI_Handle: MIDI handle
+ * @retval Length in bytes
+ */
+static uint16_t MIDI_RxTransferSize(MIDI_HandleTypeDef *MIDI_Handle)
+{
+	if(MIDI_Handle->RxContinuous && (MIDI_Handle->InEpSize > USB_MIDI_DATA_IN_SIZE))
+	{
+		return USB_MIDI_DATA_IN_SIZE;
+	}
+	return MIDI_Handle->InEpSize;
+}
+
+/*------------------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * @brief  Continuous reception: issues the next IN transfer into the head buffer
+ *         right away, or holds it while the ring is full. The device NAKs in the
+ *         meantime and keeps its data, nothing is lost.
+ * @param  phost: Host handle
+ * @retval None
+ */
+static void MIDI_RearmReception(USBH_HandleTypeDef *phost)
+{
+	MIDI_HandleTypeDef *MIDI_Handle =  phost->pActiveClass->pData;
+
+	if((uint8_t)(MIDI_Handle->RxHead - MIDI_Handle->RxTail) >= USBH_MIDI_RX_BUFFERS)
+	{
+		MIDI_Handle->RxStalls++;
+		MIDI_Handle->data_rx_state = MIDI_IDLE;
+		return;
+	}
+
+	MIDI_Handle->pRxData = MIDI_Handle->RxBuff[MIDI_Handle->RxHead % USBH_MIDI_RX_BUFFERS];
+	MIDI_Handle->RxDataLength = USB_MIDI_DATA_IN_SIZE;
+	USBH_BulkReceiveData (phost,
+			MIDI_Handle->pRxData,
+			MIDI_RxTransferSize(MIDI_Handle),
+			MIDI_Handle->InPipe);
+	MIDI_Handle->data_rx_state = MIDI_RECEIVE_DATA_WAIT;
+}
+
+/*------------------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * @brief  Resets the parser of every cable
+ * @param  parser: parser state
+ * @retval None
+ */
+void USBH_MIDI_ParserInit(MIDI_ParserTypeDef *parser)
+{
+	USBH_memset(parser, 0, sizeof(MIDI_ParserTypeDef));
+}
+
+/*------------------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * @brief  Number of data bytes following a status byte
+ * @param  status: status byte
+ * @retval 0 to 2
+ */
+static uint8_t MIDI_DataLength(uint8_t status)
+{
+	switch(status & 0xF0)
+	{
+	case 0xC0:
+	case 0xD0:
+		return 1;
+	case 0xF0:
+		return (status == 0xF2) ? 2 : (((status == 0xF1) || (status == 0xF3)) ? 1 : 0);
+	default:
+		return 2;
+	}
+}
+
+/*------------------------------------------------------------------------------------------------------------------------------*/
+
+static void MIDI_SysExAppend(MIDI_CableParserTypeDef *cp, const uint8_t *data, uint8_t n)
+{
+	while(n--)
+	{
+		if(cp->sysex_len < USBH_MIDI_SYSEX_SIZE)
+		{
+			cp->sysex[cp->sysex_len++] = *data;
+		}
+		else
+		{
+			cp->sysex_overflow = 1;
+		}
+		data++;
+	}
+}
+
+/*------------------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * @brief  Decodes one 4-byte USB-MIDI event packet according to its Code Index
+ *         Number (USB MIDI 1.0, table 4-1), with a separate state per virtual
+ *         cable:
+ *         - CIN 0x8-0xE: complete channel voice message, sets the running status
+ *         - CIN 0x2, 0x3, 0x5: system common (0x5 may also end a SysEx)
+ *         - CIN 0x4, 0x6, 0x7: SysEx start/continue and end with 2 or 3 bytes
+ *         - CIN 0xF: single byte stream; data bytes complete the running status
+ *           message, real-time bytes pass through without breaking it
+ * @param  parser: parser state
+ * @param  packet: event packet (cable/CIN, then 3 MIDI bytes)
+ * @param  msg: complete message, as a packet with its status byte (CHANNEL, SYSTEM),
+ *         or only the cable number (SYSEX)
+ * @retval Kind of message completed by this packet
+ */
+MIDI_ParseResultTypeDef USBH_MIDI_ParsePacket(MIDI_ParserTypeDef *parser, const uint8_t *packet, midi_package_t *msg)
+{
+	uint8_t cin = packet[0] & 0x0F;
+	uint8_t cable = packet[0] >> 4;
+	uint8_t b = packet[1];
+	MIDI_CableParserTypeDef *cp;
+
+	if(cable >= USBH_MIDI_CABLES)
+	{
+		return MIDI_PARSE_NONE;
+	}
+	cp = &parser->cable[cable];
+	msg->ALL = 0;
+	msg->cin_cable = packet[0];
+
+	switch(cin)
+	{
+	case 0x8: case 0x9: case 0xA: case 0xB: case 0xC: case 0xD: case 0xE:
+		if((b & 0xF0) != (cin << 4))
+		{
+			return MIDI_PARSE_NONE;
+		}
+		cp->running_status = b;
+		cp->data_count = 0;
+		cp->sysex_active = 0;
+		msg->evnt0 = b;
+		msg->evnt1 = packet[2];
+		msg->evnt2 = (cin == 0xC || cin == 0xD) ? 0 : packet[3];
+		return MIDI_PARSE_CHANNEL;
+
+	case 0x2:
+	case 0x3:
+		cp->running_status = 0;
+		cp->sysex_active = 0;
+		msg->evnt0 = b;
+		msg->evnt1 = packet[2];
+		msg->evnt2 = (cin == 0x3) ? packet[3] : 0;
+		return MIDI_PARSE_SYSTEM;
+
+	case 0x4:
+		if(b == 0xF0)
+		{
+			cp->sysex_active = 1;
+			cp->sysex_len = 0;
+			cp->sysex_overflow = 0;
+			cp->running_status = 0;
+		}
+		if(cp->sysex_active)
+		{
+			MIDI_SysExAppend(cp, &packet[1], 3);
+		}
+		return MIDI_PARSE_NONE;
+
+	case 0x5:
+	case 0x6:
+	case 0x7:
+		if((cin == 0x5) && (b != 0xF7))
+		{
+			/* single-byte system common (tune request) */
+			cp->running_status = 0;
+			cp->sysex_active = 0;
+			msg->evnt0 = b;
+			return MIDI_PARSE_SYSTEM;
+		}
+		if(!cp->sysex_active && (b != 0xF0))
+		{
+			return MIDI_PARSE_NONE;
+		}
+		if(b == 0xF0)
+		{
+			cp->sysex_len = 0;
+			cp->sysex_overflow = 0;
+		}
+		MIDI_SysExAppend(cp, &packet[1], cin - 0x4);
+		cp->sysex_active = 0;
+		cp->running_status = 0;
+		return MIDI_PARSE_SYSEX;
+
+	case 0xF:
+		if(b >= 0xF8)
+		{
+			msg->evnt0 = b;
+			return MIDI_PARSE_SYSTEM;
+		}
+		if(b & 0x80)
+		{
+			cp->data_count = 0;
+			if(b == 0xF0)
+			{
+				cp->sysex_active = 1;
+				cp->sysex_len = 0;
+				cp->sysex_overflow = 0;
+				cp->running_status = 0;
+				MIDI_SysExAppend(cp, &b, 1);
+				return MIDI_PARSE_NONE;
+			}
+			if(b == 0xF7)
+			{
+				if(!cp->sysex_active)
+				{
+					return MIDI_PARSE_NONE;
+				}
+				MIDI_SysExAppend(cp, &b, 1);
+				cp->sysex_active = 0;
+				return MIDI_PARSE_SYSEX;
+			}
+			cp->sysex_active = 0;
+			cp->running_status = ((b == 0xF4) || (b == 0xF5)) ? 0 : b;
+			if((cp->running_status == 0) || (MIDI_DataLength(b) > 0))
+			{
+				return MIDI_PARSE_NONE;
+			}
+		}
+		else if(cp->sysex_active)
+		{
+			MIDI_SysExAppend(cp, &b, 1);
+			return MIDI_PARSE_NONE;
+		}
+		else if(cp->running_status == 0)
+		{
+			return MIDI_PARSE_NONE;
+		}
+		else
+		{
+			cp->data[cp->data_count++] = b;
+			if(cp->data_count < MIDI_DataLength(cp->running_status))
+			{
+				return MIDI_PARSE_NONE;
+			}
+		}
+
+		/* complete message from the byte stream */
+		msg->evnt0 = cp->running_status;
+		msg->evnt1 = (cp->data_count > 0) ? cp->data[0] : 0;
+		msg->evnt2 = (cp->data_count > 1) ? cp->data[1] : 0;
+		cp->data_count = 0;
+		if(cp->running_status >= 0xF0)
+		{
+			/* system common clears the running status */
+			cp->running_status = 0;
+			msg->cin_cable = (cable << 4) | ((msg->evnt0 == 0xF6) ? 0x5 : (0x1 + MIDI_DataLength(msg->evnt0)));
+			return MIDI_PARSE_SYSTEM;
+		}
+		msg->cin_cable = (cable << 4) | (msg->evnt0 >> 4);
+		return MIDI_PARSE_CHANNEL;
+
+	default:
+		/* 0x0 misc, 0x1 cable events: reserved */
+		return MIDI_PARSE_NONE;
+	}
+}
 
 /*------------------------------------------------------------------------------------------------------------------------------*/
 
@@ -0,0 +1,26 @@
+/*
+ * cmsis_host.c
+ *
+ *  Fonctions CMSIS-DSP livrées uniquement en assembleur Cortex-M,
+ *  réécrites en C pour le build PC.
+ */
+
+#include "arm_math.h"
+
+// arm_bitreversal2.S : permutation en place appelée par arm_cfft_f32 / arm_rfft_fast_f32
+void arm_bitreversal_32(uint32_t *pSrc, const uint16_t bitRevLen, const uint16_t *pBitRevTab) {
+    uint32_t a, b, i, tmp;
+
+    for (i = 0; i < bitRevLen; i += 2) {
+        a = pBitRevTab[i] >> 2;
+        b = pBitRevTab[i + 1] >> 2;
+
+        tmp = pSrc[a];
+        pSrc[a] = pSrc[b];
+        pSrc[b] = tmp;
+
+        tmp = pSrc[a + 1];
+        pSrc[a + 1] = pSrc[b + 1];
+        pSrc[b + 1] = tmp;
+    }
+}
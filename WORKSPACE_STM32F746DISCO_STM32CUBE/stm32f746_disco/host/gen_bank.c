@@ -0,0 +1,227 @@
+/*
+ * gen_bank.c
+ *
+ *  Banque de démonstration du sampler (make bank) : écrit l'image QSPI
+ *  (en-tête, répertoire, échantillons) et l'image SD (échantillons longs en
+ *  blocs de 512 octets), au format de sampler.h.
+ *
+ *  - pincé, zones QSPI do2 / do3 / do4 (notes 48-83) : harmoniques
+ *    amorties vers un régime de période entière, boucle sur 40 périodes
+ *  - nappe, zone SD do1 (notes 24-47) : partiels désaccordés quantifiés
+ *    sur fe / 65536, boucle de 65536 échantillons alignée sur les blocs
+ *  - cloche, zone SD do6 (notes 84-108) : partiels inharmoniques amortis,
+ *    sans boucle
+ *
+ *  Usage : gen_bank <bank_qspi.bin> <bank_sd.bin>
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <math.h>
+
+// Format de sampler.h
+#define BANK_MAGIC          0x424D5953u
+#define BANK_VERSION        1u
+#define BANK_HEADER_SIZE    16
+#define ZONE_SIZE           28
+#define ZONE_SD             0x01
+#define ZONE_LOOP           0x02
+#define SD_BLOCK_SAMPLES    256
+#define STREAM_HEAD         4096
+
+#define FE                  44100
+#define MAX_ZONES           8
+#define PEAK                24000.0
+
+struct zone
+{
+    int16_t *pcm;
+    uint32_t length;
+    uint32_t loop_start, loop_end;
+    uint8_t root, lo, hi, flags;
+    uint32_t offset, sd_block;
+};
+
+static struct zone zones[MAX_ZONES];
+static int zone_count = 0;
+
+//=======================================================================================
+// Échantillons
+
+static double note_freq(int note) {
+    return 440.0 * pow(2.0, (note - 69) / 12.0);
+}
+
+static int16_t* alloc_pcm(uint32_t length) {
+    int16_t *pcm = calloc(length, sizeof(int16_t));
+
+    if (pcm == NULL) {
+        perror("gen_bank");
+        exit(1);
+    }
+    return pcm;
+}
+
+static void add_zone(int16_t *pcm, uint32_t length, uint32_t loop_start, uint32_t loop_end,
+                     int root, int lo, int hi, uint8_t flags) {
+    struct zone *z = &zones[zone_count++];
+
+    z->pcm = pcm;
+    z->length = length;
+    z->loop_start = loop_start;
+    z->loop_end = loop_end;
+    z->root = (uint8_t)root;
+    z->lo = (uint8_t)lo;
+    z->hi = (uint8_t)hi;
+    z->flags = flags;
+}
+
+// Période entière : le régime final est exactement périodique
+static void make_pluck(int root, int lo, int hi) {
+    uint32_t period = (uint32_t)lround(FE / note_freq(root));
+    uint32_t length = FE;
+    uint32_t loop_end = length - length % period;
+    int16_t *pcm = alloc_pcm(length);
+    uint32_t n;
+    int k;
+
+    for (n = 0; n < length; n++) {
+        double t = (double)n / FE, y = 0.0;
+        for (k = 1; k <= 8; k++) {
+            double steady = (k <= 3) ? 0.5 / k : 0.0;
+            double a = steady + (1.0 / k - steady) * exp(-t * 12.0 * k);
+            y += a * sin(2.0 * M_PI * k * n / period);
+        }
+        pcm[n] = (int16_t)lround(PEAK * 0.5 * y * (1.0 - exp(-t * 2000.0)));
+    }
+    add_zone(pcm, length, loop_end - 40 * period, loop_end, root, lo, hi, ZONE_LOOP);
+}
+
+// Partiels sur fe / 65536 : toute fenêtre de 65536 échantillons boucle sans raccord
+static void make_pad(int root, int lo, int hi) {
+    const uint32_t loop_len = 65536;
+    const uint32_t loop_start = 172 * SD_BLOCK_SAMPLES;
+    uint32_t length = loop_start + loop_len;
+    int16_t *pcm = alloc_pcm(length);
+    double f0 = note_freq(root);
+    uint32_t n;
+    int k, d;
+
+    for (n = 0; n < length; n++) {
+        double t = (double)n / FE, y = 0.0;
+        for (k = 1; k <= 6; k++) {
+            for (d = -1; d <= 1; d += 2) {
+                double f = k * f0 * (1.0 + d * 0.002);
+                double bin = round(f * loop_len / FE);
+                y += 0.25 / k * sin(2.0 * M_PI * bin * (n % loop_len) / loop_len);
+            }
+        }
+        pcm[n] = (int16_t)lround(PEAK * 0.5 * y * (1.0 - exp(-t * 8.0)));
+    }
+    add_zone(pcm, length, loop_start, loop_start + loop_len, root, lo, hi, ZONE_SD | ZONE_LOOP);
+}
+
+static void make_bell(int root, int lo, int hi) {
+    static const double ratio[] = { 0.56, 0.92, 1.19, 1.71, 2.0, 2.74, 3.0, 3.76 };
+    uint32_t length = 3 * FE + 1234;
+    int16_t *pcm = alloc_pcm(length);
+    double f0 = note_freq(root);
+    uint32_t n;
+    int k;
+
+    for (n = 0; n < length; n++) {
+        double t = (double)n / FE, y = 0.0;
+        for (k = 0; k < 8; k++) {
+            y += 0.2 * exp(-t * (0.8 + k * 0.9)) * sin(2.0 * M_PI * ratio[k] * f0 * t);
+        }
+        pcm[n] = (int16_t)lround(PEAK * y * (1.0 - exp(-t * 4000.0)));
+    }
+    add_zone(pcm, length, 0, 0, root, lo, hi, ZONE_SD);
+}
+
+//=======================================================================================
+// Écriture
+
+static void put_le16(FILE *f, uint16_t v) { fputc(v & 0xFF, f); fputc(v >> 8, f); }
+static void put_le32(FILE *f, uint32_t v) { put_le16(f, v & 0xFFFF); put_le16(f, v >> 16); }
+
+static void put_pcm(FILE *f, const int16_t *pcm, uint32_t count) {
+    uint32_t n;
+
+    for (n = 0; n < count; n++) put_le16(f, (uint16_t)pcm[n]);
+}
+
+int main(int argc, char **argv) {
+    FILE *q, *sd;
+    uint32_t offset, block = 0;
+    int i;
+
+    if (argc != 3) {
+        fprintf(stderr, "usage : %s <bank_qspi.bin> <bank_sd.bin>\n", argv[0]);
+        return 1;
+    }
+
+    make_pluck(48, 48, 59);
+    make_pluck(60, 60, 71);
+    make_pluck(72, 72, 83);
+    make_pad(36, 24, 47);
+    make_bell(96, 84, 108);
+
+    // Échantillons QSPI après le répertoire ; une zone SD n'y garde que sa tête
+    offset = BANK_HEADER_SIZE + zone_count * ZONE_SIZE;
+    for (i = 0; i < zone_count; i++) {
+        struct zone *z = &zones[i];
+        z->offset = offset;
+        offset += 2 * ((z->flags & ZONE_SD) ? STREAM_HEAD : z->length);
+        if (z->flags & ZONE_SD) {
+            z->sd_block = block;
+            block += (z->length + SD_BLOCK_SAMPLES - 1) / SD_BLOCK_SAMPLES;
+        }
+    }
+
+    q = fopen(argv[1], "wb");
+    sd = fopen(argv[2], "wb");
+    if (q == NULL || sd == NULL) {
+        perror("gen_bank");
+        return 1;
+    }
+
+    put_le32(q, BANK_MAGIC);
+    put_le32(q, BANK_VERSION);
+    put_le32(q, (uint32_t)zone_count);
+    put_le32(q, offset);
+    for (i = 0; i < zone_count; i++) {
+        const struct zone *z = &zones[i];
+        put_le32(q, z->offset);
+        put_le32(q, z->length);
+        put_le32(q, z->loop_start);
+        put_le32(q, z->loop_end);
+        put_le32(q, z->sd_block);
+        put_le32(q, FE);
+        fputc(z->root, q);
+        fputc(z->lo, q);
+        fputc(z->hi, q);
+        fputc(z->flags, q);
+    }
+    for (i = 0; i < zone_count; i++) {
+        const struct zone *z = &zones[i];
+        put_pcm(q, z->pcm, (z->flags & ZONE_SD) ? STREAM_HEAD : z->length);
+    }
+
+    // Image SD : échantillons complets, complétés au bloc
+    for (i = 0; i < zone_count; i++) {
+        const struct zone *z = &zones[i];
+        uint32_t pad = (SD_BLOCK_SAMPLES - z->length % SD_BLOCK_SAMPLES) % SD_BLOCK_SAMPLES;
+
+        if (!(z->flags & ZONE_SD)) continue;
+        put_pcm(sd, z->pcm, z->length);
+        while (pad--) put_le16(sd, 0);
+    }
+
+    fclose(q);
+    fclose(sd);
+    printf("%d zones, QSPI %u octets, SD %u blocs\n", zone_count, offset, block);
+    return 0;
+}
@@ -0,0 +1,239 @@
+/*
+ * gen_tables.c
+ *
+ *  Générateur des tables constantes du synthé (make tables) : écrit
+ *  inc/synth_tables.h et src/synth_tables.c, compilés tels quels par le
+ *  projet STM32CubeIDE et par le build PC. Calcul en double, arrondi une
+ *  seule fois à l'écriture.
+ *
+ *  - sinus : une période de 2^SINE_TABLE_BITS points, crête 16384, point de
+ *    garde en fin de table (interpolation sans test de bouclage)
+ *  - notes MIDI 0..127 : fréquence (la3 = 69 = 440 Hz) et incrément de phase
+ *    32 bits à TABLES_FE
+ *  - banque FIR : FIR_BANK_SIZE passe-bas à fenêtre de Hamming, coupures
+ *    réparties en log entre FIR_BANK_FMIN et FIR_BANK_FMAX (même calcul que
+ *    FIR_calc_coeff_f32), et constantes de conversion coupure -> ligne.
+ *    Coupure à -6 dB en fc : h[centre] = 2 fc / fe
+ *  - passe-bas fixe FIR_LOWPASS_FC (ancien h_low_0_4500), en float et Q15
+ *
+ *  Tailles et fréquences réglables à la génération :
+ *      make tables SINE_TABLE_BITS=11 FIR_BANK_SIZE=32
+ *
+ *  Usage : gen_tables <synth_tables.h> <synth_tables.c>
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <math.h>
+
+#ifndef TABLES_FE
+#define TABLES_FE 44100
+#endif
+#ifndef SINE_TABLE_BITS
+#define SINE_TABLE_BITS 10
+#endif
+#define SINE_TABLE_SIZE (1u << SINE_TABLE_BITS)
+#define SINE_TABLE_PEAK 16384
+#define NOTE_COUNT 128
+#ifndef FIR_BANK_TAPS
+#define FIR_BANK_TAPS 64
+#endif
+#ifndef FIR_BANK_SIZE
+#define FIR_BANK_SIZE 64
+#endif
+#ifndef FIR_BANK_FMIN
+#define FIR_BANK_FMIN 20.0
+#endif
+#ifndef FIR_BANK_FMAX
+#define FIR_BANK_FMAX 4000.0
+#endif
+#ifndef FIR_LOWPASS_TAPS
+#define FIR_LOWPASS_TAPS 64
+#endif
+#ifndef FIR_LOWPASS_FC
+#define FIR_LOWPASS_FC 4500.0
+#endif
+
+#define PER_LINE 8
+
+static double fir_tmp[FIR_BANK_TAPS > FIR_LOWPASS_TAPS ? FIR_BANK_TAPS : FIR_LOWPASS_TAPS];
+
+//=======================================================================================
+// Calculs
+
+// Sinus cardinal fenêtré par Hamming, gain unité en bande passante (FIR_calc_coeff_f32)
+static void design_lowpass(double *h, int taps, double fc, double fe) {
+    double norm = fc / fe;
+    double sum = 0.0;
+    int center = taps / 2;
+    int n;
+
+    for (n = 0; n < taps; n++) {
+        if (n == center) {
+            h[n] = 2.0 * norm;
+        } else {
+            h[n] = sin(2.0 * M_PI * norm * (n - center)) / (M_PI * (n - center));
+        }
+        h[n] *= 0.54 - 0.46 * cos(2.0 * M_PI * n / (taps - 1));
+        sum += h[n];
+    }
+    for (n = 0; n < taps; n++) h[n] /= sum;
+}
+
+static double note_freq(int note) {
+    return 440.0 * pow(2.0, (note - 69) / 12.0);
+}
+
+//=======================================================================================
+// Écriture
+
+// Littéral float C : %.9g suffit à relire le même float, ".0" si entier
+static const char* float_literal(char buf[32], double v) {
+    int n = snprintf(buf, 32 - 3, "%.9g", v);
+
+    if (strpbrk(buf, ".en") == NULL) {
+        buf[n++] = '.';
+        buf[n++] = '0';
+    }
+    buf[n++] = 'f';
+    buf[n] = '\0';
+    return buf;
+}
+
+static void put_float(FILE *f, int i, int count, double v) {
+    char buf[32];
+
+    fprintf(f, "%s%s%s", (i % PER_LINE) ? " " : "    ", float_literal(buf, v),
+            (i + 1 == count) ? "\n" : ((i % PER_LINE == PER_LINE - 1) ? ",\n" : ","));
+}
+
+static void put_int(FILE *f, int i, int count, long v) {
+    fprintf(f, "%s%ld%s", (i % PER_LINE) ? " " : "    ", v,
+            (i + 1 == count) ? "\n" : ((i % PER_LINE == PER_LINE - 1) ? ",\n" : ","));
+}
+
+static void write_header(FILE *f) {
+    double log_step = log(FIR_BANK_FMAX / FIR_BANK_FMIN) / (FIR_BANK_SIZE - 1);
+    char fmin[32], fmax[32], log_fmin[32], inv_log_step[32], lp_fc[32];
+
+    fprintf(f,
+        "/*\n"
+        " * synth_tables.h\n"
+        " *\n"
+        " *  Généré par host/gen_tables.c (make -C host tables), ne pas modifier.\n"
+        " *  Tables constantes en flash (.rodata), une seule copie pour tout le\n"
+        " *  programme ; tailles fixées à la génération.\n"
+        " */\n\n"
+        "#ifndef INC_SYNTH_TABLES_H_\n"
+        "#define INC_SYNTH_TABLES_H_\n\n"
+        "#include <stdint.h>\n\n"
+        "#define SYNTH_TABLES_FE             %d      // fréquence d'échantillonnage des incréments et des FIR\n\n"
+        "#define SYNTH_SINE_TABLE_BITS       %d\n"
+        "#define SYNTH_SINE_TABLE_SIZE       %u\n"
+        "#define SYNTH_SINE_TABLE_PEAK       %d\n\n"
+        "#define SYNTH_NOTE_COUNT            %d\n\n"
+        "#define SYNTH_FIR_BANK_TAPS         %d\n"
+        "#define SYNTH_FIR_BANK_SIZE         %d\n"
+        "#define SYNTH_FIR_BANK_FMIN         %s\n"
+        "#define SYNTH_FIR_BANK_FMAX         %s\n"
+        "#define SYNTH_FIR_BANK_LOG_FMIN     %s\n"
+        "#define SYNTH_FIR_BANK_INV_LOG_STEP %s\n\n"
+        "#define SYNTH_FIR_LOWPASS_TAPS      %d\n"
+        "#define SYNTH_FIR_LOWPASS_FC        %s\n\n"
+        "// Lignes de la banque FIR alignées sur les lignes de cache\n"
+        "#define SYNTH_TABLE_ALIGN           __attribute__((aligned(32)))\n\n"
+        "// Une période, crête SYNTH_SINE_TABLE_PEAK ; [SIZE] = [0]\n"
+        "extern const int16_t synth_sine_table[SYNTH_SINE_TABLE_SIZE + 1];\n"
+        "// Fréquence (Hz) et incrément de phase 32 bits à SYNTH_TABLES_FE de chaque note MIDI\n"
+        "extern const float synth_note_freq[SYNTH_NOTE_COUNT];\n"
+        "extern const uint32_t synth_note_increment[SYNTH_NOTE_COUNT];\n"
+        "// Passe-bas à fenêtre de Hamming, coupure FMIN * exp(i * log(FMAX / FMIN) / (SIZE - 1))\n"
+        "extern const float synth_fir_bank[SYNTH_FIR_BANK_SIZE][SYNTH_FIR_BANK_TAPS];\n"
+        "// Passe-bas fixe à SYNTH_FIR_LOWPASS_FC\n"
+        "extern const float synth_fir_lowpass_f32[SYNTH_FIR_LOWPASS_TAPS];\n"
+        "extern const int16_t synth_fir_lowpass_q15[SYNTH_FIR_LOWPASS_TAPS];\n\n"
+        "#endif /* INC_SYNTH_TABLES_H_ */\n",
+        TABLES_FE, SINE_TABLE_BITS, SINE_TABLE_SIZE, SINE_TABLE_PEAK, NOTE_COUNT,
+        FIR_BANK_TAPS, FIR_BANK_SIZE, float_literal(fmin, FIR_BANK_FMIN), float_literal(fmax, FIR_BANK_FMAX),
+        float_literal(log_fmin, log(FIR_BANK_FMIN)), float_literal(inv_log_step, 1.0 / log_step),
+        FIR_LOWPASS_TAPS, float_literal(lp_fc, FIR_LOWPASS_FC));
+}
+
+static void write_source(FILE *f) {
+    double log_step = log(FIR_BANK_FMAX / FIR_BANK_FMIN) / (FIR_BANK_SIZE - 1);
+    uint32_t i;
+    int n;
+
+    fprintf(f,
+        "/*\n"
+        " * synth_tables.c\n"
+        " *\n"
+        " *  Généré par host/gen_tables.c (make -C host tables), ne pas modifier.\n"
+        " */\n\n"
+        "#include \"synth_tables.h\"\n\n");
+
+    fprintf(f, "const int16_t synth_sine_table[SYNTH_SINE_TABLE_SIZE + 1] SYNTH_TABLE_ALIGN = {\n");
+    for (i = 0; i <= SINE_TABLE_SIZE; i++) {
+        double v = SINE_TABLE_PEAK * sin(2.0 * M_PI * (i % SINE_TABLE_SIZE) / SINE_TABLE_SIZE);
+        put_int(f, (int)i, SINE_TABLE_SIZE + 1, lround(v));
+    }
+    fprintf(f, "};\n\n");
+
+    fprintf(f, "const float synth_note_freq[SYNTH_NOTE_COUNT] = {\n");
+    for (n = 0; n < NOTE_COUNT; n++) put_float(f, n, NOTE_COUNT, note_freq(n));
+    fprintf(f, "};\n\n");
+
+    fprintf(f, "const uint32_t synth_note_increment[SYNTH_NOTE_COUNT] = {\n");
+    for (n = 0; n < NOTE_COUNT; n++) {
+        put_int(f, n, NOTE_COUNT, (long)llround(note_freq(n) / TABLES_FE * 4294967296.0));
+    }
+    fprintf(f, "};\n\n");
+
+    fprintf(f, "const float synth_fir_bank[SYNTH_FIR_BANK_SIZE][SYNTH_FIR_BANK_TAPS] SYNTH_TABLE_ALIGN = {\n");
+    for (i = 0; i < FIR_BANK_SIZE; i++) {
+        double fc = FIR_BANK_FMIN * exp(log_step * i);
+
+        design_lowpass(fir_tmp, FIR_BANK_TAPS, fc, TABLES_FE);
+        fprintf(f, "  { // %.1f Hz\n", fc);
+        for (n = 0; n < FIR_BANK_TAPS; n++) put_float(f, n, FIR_BANK_TAPS, fir_tmp[n]);
+        fprintf(f, "  }%s\n", (i + 1 < FIR_BANK_SIZE) ? "," : "");
+    }
+    fprintf(f, "};\n\n");
+
+    design_lowpass(fir_tmp, FIR_LOWPASS_TAPS, FIR_LOWPASS_FC, TABLES_FE);
+    fprintf(f, "const float synth_fir_lowpass_f32[SYNTH_FIR_LOWPASS_TAPS] = {\n");
+    for (n = 0; n < FIR_LOWPASS_TAPS; n++) put_float(f, n, FIR_LOWPASS_TAPS, fir_tmp[n]);
+    fprintf(f, "};\n\n");
+
+    fprintf(f, "const int16_t synth_fir_lowpass_q15[SYNTH_FIR_LOWPASS_TAPS] = {\n");
+    for (n = 0; n < FIR_LOWPASS_TAPS; n++) {
+        long q = lround(fir_tmp[n] * 32768.0);
+        if (q > 32767) q = 32767;
+        put_int(f, n, FIR_LOWPASS_TAPS, q);
+    }
+    fprintf(f, "};\n");
+}
+
+//=======================================================================================
+
+int main(int argc, char **argv) {
+    FILE *h, *c;
+
+    if (argc != 3) {
+        fprintf(stderr, "usage : %s <synth_tables.h> <synth_tables.c>\n", argv[0]);
+        return 1;
+    }
+    h = fopen(argv[1], "w");
+    c = fopen(argv[2], "w");
+    if (h == NULL || c == NULL) {
+        perror("gen_tables");
+        return 1;
+    }
+    write_header(h);
+    write_source(c);
+    fclose(h);
+    fclose(c);
+    return 0;
+}
@@ -0,0 +1,488 @@
+/*
+ * synth_host.c
+ *
+ *  Rendu hors-ligne du moteur de synthèse sur PC (Linux x86).
+ *  Remplace main.c : lit un scénario MIDI texte, appelle synth_render_block()
+ *  bloc par bloc comme process_buffer(), écrit un WAV/RAW 16 bits stéréo et
+ *  affiche le coût de chaque étage (ns/échantillon, échantillons/s).
+ *  Avec -r, la sortie est comparée à un rendu RAW de référence (golden) :
+ *  identique à l'échantillon près, ou RSB minimal donné par -t.
+ *  Avec -b (et -S), le sampler reçoit une image de banque QSPI (et une image
+ *  de carte SD lue une lecture par bloc rendu) : make bank, make run-sampler.
+ *
+ *  Format du scénario (une ligne par message, '#' = commentaire) :
+ *      <temps_ms> <status> <data1> <data2>
+ *  ex : 0 0x90 60 100   /   500 0x80 60 0   /   2000 0xB0 7 64
+ *  Rampe : un message toutes les <période_ms> pendant <durée_ms>, valeur
+ *  linéaire de <début> vers <fin> (exclue, arrondi vers le bas) ; pour
+ *  0xE0 la valeur est le pitch bend 14 bits et data1 est ignoré :
+ *      <temps_ms> ramp <status> <data1> <début> <fin> <durée_ms> <période_ms>
+ *  ex : 2200 ramp 0xB0 7 0 127 1000 5   /   4200 ramp 0xE0 0 0 16383 1000 5
+ */
+
+#define _POSIX_C_SOURCE 199309L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+
+#include "synth.h"
+#include "synth_profile.h"
+#include "synth_telemetry.h"
+#include "voice.h"
+#include "FIR_filter.h"
+#include "audio_buffer.h"
+#include "sampler.h"
+
+#define MAX_EVENTS 4096
+
+typedef struct {
+    uint32_t sample;
+    uint8_t status, data1, data2;
+} host_event_t;
+
+static host_event_t events[MAX_EVENTS];
+static uint32_t nb_events = 0;
+
+//=======================================================================================
+// Horloge des points de mesure (SYNTH_PROFILE_HOST) : équivalent de DWT->CYCCNT en ns
+
+static uint64_t host_clock_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ull + (uint64_t)ts.tv_nsec;
+}
+
+uint32_t synth_profile_now(void) {
+    return (uint32_t)host_clock_ns();
+}
+
+//=======================================================================================
+
+static void add_event(uint32_t time_ms, uint8_t status, uint8_t data1, uint8_t data2) {
+    if (nb_events >= MAX_EVENTS) return;
+    events[nb_events].sample = (uint32_t)((uint64_t)time_ms * (uint32_t)SYNTH_SAMPLE_RATE / 1000u);
+    events[nb_events].status = status;
+    events[nb_events].data1 = data1;
+    events[nb_events].data2 = data2;
+    nb_events++;
+}
+
+// Scénario par défaut : accords arpégés, balayage CC7 et pitchbend
+static void load_default_scenario(void) {
+    static const uint8_t notes[] = { 48, 55, 60, 64, 67, 72 };
+    uint32_t t = 0;
+
+    add_event(0, 0xB0, 1, 80);
+    for (int rep = 0; rep < 4; rep++) {
+        for (unsigned i = 0; i < sizeof(notes); i++) {
+            add_event(t, 0x90, notes[i], 100);
+            add_event(t + 350, 0x80, notes[i], 0);
+            add_event(t + 100, 0xB0, 7, (uint8_t)((i * 20 + rep * 10) & 0x7F));
+            t += 400;
+        }
+        add_event(t, 0xE0, 0, (uint8_t)(32 + rep * 24));
+    }
+}
+
+// Balayage de potentiomètre : n = durée / période messages
+static void add_ramp(uint32_t time_ms, uint8_t status, uint8_t data1, long from, long to,
+                     uint32_t duration_ms, uint32_t period_ms) {
+    uint32_t n = duration_ms / period_ms;
+
+    for (uint32_t k = 0; k < n; k++) {
+        long num = (to - from) * (long)k;
+        long v = from + (num >= 0 ? num / (long)n : -((-num + (long)n - 1) / (long)n));
+        if ((status & 0xF0) == 0xE0) {
+            add_event(time_ms + k * period_ms, status, (uint8_t)(v & 0x7F), (uint8_t)((v >> 7) & 0x7F));
+        } else {
+            add_event(time_ms + k * period_ms, status, data1, (uint8_t)(v & 0x7F));
+        }
+    }
+}
+
+static int load_scenario(const char *path) {
+    char line[256];
+    FILE *f = fopen(path, "r");
+    if (f == NULL) {
+        fprintf(stderr, "impossible d'ouvrir %s\n", path);
+        return -1;
+    }
+    while (fgets(line, sizeof(line), f) != NULL) {
+        long t, st, d1, d2, from, to, duration, period;
+        char *p = line;
+        while (*p == ' ' || *p == '\t') p++;
+        if (*p == '#' || *p == '\n' || *p == '\0') continue;
+        if (sscanf(p, "%li ramp %li %li %li %li %li %li", &t, &st, &d1, &from, &to, &duration, &period) == 7) {
+            if (t < 0 || duration <= 0 || period <= 0) {
+                fprintf(stderr, "ligne ignorée : %s", line);
+                continue;
+            }
+            add_ramp((uint32_t)t, (uint8_t)st, (uint8_t)(d1 & 0x7F), from, to, (uint32_t)duration, (uint32_t)period);
+            continue;
+        }
+        if (sscanf(p, "%li %li %li %li", &t, &st, &d1, &d2) != 4 || t < 0) {
+            fprintf(stderr, "ligne ignorée : %s", line);
+            continue;
+        }
+        add_event((uint32_t)t, (uint8_t)st, (uint8_t)(d1 & 0x7F), (uint8_t)(d2 & 0x7F));
+    }
+    fclose(f);
+    return 0;
+}
+
+static int cmp_event(const void *a, const void *b) {
+    const host_event_t *ea = a, *eb = b;
+    return (ea->sample > eb->sample) - (ea->sample < eb->sample);
+}
+
+// Image de banque ou de carte SD, lue entière en mémoire
+static uint8_t* load_file(const char *path, uint32_t *size) {
+    FILE *f = fopen(path, "rb");
+    uint8_t *data = NULL;
+    long len;
+
+    if (f == NULL) {
+        fprintf(stderr, "impossible d'ouvrir %s\n", path);
+        return NULL;
+    }
+    if (fseek(f, 0, SEEK_END) == 0 && (len = ftell(f)) > 0 && fseek(f, 0, SEEK_SET) == 0) {
+        data = malloc((size_t)len);
+        if (data != NULL && fread(data, 1, (size_t)len, f) != (size_t)len) {
+            free(data);
+            data = NULL;
+        }
+        *size = (uint32_t)len;
+    }
+    fclose(f);
+    if (data == NULL) fprintf(stderr, "lecture de %s impossible\n", path);
+    return data;
+}
+
+//=======================================================================================
+
+static void write_le16(FILE *f, uint16_t v) { fputc(v & 0xFF, f); fputc(v >> 8, f); }
+static void write_le32(FILE *f, uint32_t v) { write_le16(f, v & 0xFFFF); write_le16(f, v >> 16); }
+
+static void write_wav_header(FILE *f, uint32_t nb_frames) {
+    uint32_t data_bytes = nb_frames * 4u;
+    fwrite("RIFF", 1, 4, f); write_le32(f, 36u + data_bytes);
+    fwrite("WAVEfmt ", 1, 8, f); write_le32(f, 16);
+    write_le16(f, 1); write_le16(f, 2);
+    write_le32(f, (uint32_t)SYNTH_SAMPLE_RATE); write_le32(f, (uint32_t)SYNTH_SAMPLE_RATE * 4u);
+    write_le16(f, 4); write_le16(f, 16);
+    fwrite("data", 1, 4, f); write_le32(f, data_bytes);
+}
+
+// même conversion que process_buffer(), saturation comprise
+#if (SYNTH_FORMAT == SYNTH_FORMAT_Q15)
+#define SYNTH_TO_CODEC(pL, pR, pDst, n)  audio_interleave_q15(pL, pR, pDst, 1, n)
+#else
+#define SYNTH_TO_CODEC(pL, pR, pDst, n)  audio_interleave_f32(pL, pR, pDst, 16384.0f, n)
+#endif
+
+//=======================================================================================
+// Comparaison à un rendu de référence (trames [R:L] 16 bits, même format que -o x.raw)
+
+typedef struct {
+    FILE *f;
+    uint64_t samples;
+    uint64_t differ;
+    uint32_t max_diff;
+    double signal;          // somme des carrés de la référence
+    double noise;           // somme des carrés de l'écart
+    int truncated;
+} golden_t;
+
+static void golden_compare(golden_t *g, const uint32_t *frame, uint32_t n) {
+    static uint32_t ref[AUDIO_BLOCK_SIZE];
+    uint32_t i, c;
+
+    if (fread(ref, sizeof(uint32_t), n, g->f) != n) {
+        g->truncated = 1;
+        return;
+    }
+    for (i = 0; i < n; i++) {
+        for (c = 0; c < 2; c++) {
+            int32_t a = (int16_t)(frame[i] >> (16 * c));
+            int32_t b = (int16_t)(ref[i] >> (16 * c));
+            uint32_t d = (uint32_t)abs(a - b);
+            g->signal += (double)b * b;
+            g->noise += (double)d * d;
+            if (d) g->differ++;
+            if (d > g->max_diff) g->max_diff = d;
+        }
+    }
+    g->samples += 2u * n;
+}
+
+// 0 si le rendu est conforme : identique (min_snr_db = 0) ou RSB >= min_snr_db
+static int golden_report(const golden_t *g, float min_snr_db) {
+    double snr = (g->noise > 0.0) ? 10.0 * log10(g->signal / g->noise) : INFINITY;
+
+    if (g->truncated) {
+        printf("golden : référence plus courte que le rendu\n");
+        return 1;
+    }
+    if (g->differ == 0) {
+        printf("golden : identique (%llu échantillons)\n", (unsigned long long)g->samples);
+        return 0;
+    }
+    printf("golden : %llu/%llu échantillons différents, écart max %u LSB, RSB %.1f dB\n",
+           (unsigned long long)g->differ, (unsigned long long)g->samples, g->max_diff, snr);
+    if (min_snr_db > 0.0f && snr >= min_snr_db) return 0;
+    printf("golden : ÉCHEC (%s)\n", (min_snr_db > 0.0f) ? "RSB insuffisant" : "rendu non identique");
+    return 1;
+}
+
+//=======================================================================================
+// Horodatage du chemin DMA (main.c) : chaque moitié est rendue d'un coup juste
+// après l'échange, les messages reçus pendant sa lecture sont mis en file après
+// ce rendu. Un note on reçu t échantillons après l'échange doit sonner
+// exactement comme un note on programmé t échantillons après le début de la
+// moitié suivante, pas au début de bloc.
+
+#define HOST_HALF_SIZE  (8u * AUDIO_BLOCK_SIZE)
+
+static synth_sample_t stamp_ref[2 * HOST_HALF_SIZE], stamp_out[2 * HOST_HALF_SIZE];
+
+// Rendu des deux moitiés qui suivent la réception ; direct : note programmée
+// à sa position attendue avant tout rendu, sinon horodatée par synth_midi_stamp()
+static void stamp_render(uint32_t elapsed, int direct, synth_sample_t *pDst) {
+    static synth_sample_t right[2 * HOST_HALF_SIZE];
+    uint32_t half_clock, i;
+
+    synth_init();
+
+    // Échange puis rendu de la moitié, comme process_buffer()
+    half_clock = synth_sample_clock();
+    if (direct) synth_midi_post(0x90, 60, 100, half_clock + HOST_HALF_SIZE + elapsed);
+    for (i = 0; i < HOST_HALF_SIZE; i += AUDIO_BLOCK_SIZE) {
+        synth_render_block(pDst + i, right + i, AUDIO_BLOCK_SIZE);
+    }
+    // Réception pendant la lecture de cette moitié, comme midi_post_packet()
+    if (!direct) synth_midi_post(0x90, 60, 100, synth_midi_stamp(half_clock, HOST_HALF_SIZE, elapsed));
+
+    for (i = 0; i < 2 * HOST_HALF_SIZE; i += AUDIO_BLOCK_SIZE) {
+        synth_render_block(pDst + i, right + i, AUDIO_BLOCK_SIZE);
+    }
+}
+
+// 0 si chaque note démarre à sa position dans la moitié
+static int stamp_check(void) {
+    static const uint32_t elapsed[] = { 0, 1, 37, AUDIO_BLOCK_SIZE, 300, HOST_HALF_SIZE - 1 };
+    int failed = 0;
+    unsigned k;
+    uint32_t i;
+
+    printf("midi : moitié %u échantillons\n", HOST_HALF_SIZE);
+    for (k = 0; k < sizeof(elapsed) / sizeof(elapsed[0]); k++) {
+        int32_t onset = -1;
+        int ok;
+
+        stamp_render(elapsed[k], 1, stamp_ref);
+        stamp_render(elapsed[k], 0, stamp_out);
+        for (i = 0; i < 2 * HOST_HALF_SIZE && onset < 0; i++) {
+            if (stamp_out[i] != 0) onset = (int32_t)i;
+        }
+        ok = !memcmp(stamp_ref, stamp_out, sizeof(stamp_ref)) && onset >= (int32_t)elapsed[k];
+        printf("midi : reçue à +%u -> premier échantillon non nul +%d %s\n",
+               (unsigned)elapsed[k], (int)onset, ok ? "ok" : "ÉCHEC");
+        failed |= !ok;
+    }
+    return failed;
+}
+
+//=======================================================================================
+
+static void usage(const char *prog) {
+    fprintf(stderr,
+            "usage : %s [-s scenario.txt] [-o sortie.wav|sortie.raw] [-d durée_s] [-c]\n"
+            "          [-r reference.raw [-t rsb_min_dB]] [-b banque_qspi.bin [-S carte_sd.bin [-F n]]] [-f] [-m]\n"
+            "  sans -s, un scénario de démonstration est utilisé\n"
+            "  sans -o, seul le benchmark est affiché\n"
+            "  -c : ajoute le dump CSV de synth_profile (même format que la cible)\n"
+            "  -r : compare le rendu à une référence RAW, code de sortie 2 si non conforme\n"
+            "  -t : tolérance, RSB minimal en dB (par défaut : identique à l'échantillon près)\n"
+            "  -b : banque du sampler (image QSPI), canal %d ; -S : image de la carte SD\n"
+            "  -F : pannes SD, une lecture sur n : fin perdue ou signalée deux fois, en alternance\n"
+            "  -f : banc de mesure des noyaux FIR (CSV, même format que la cible), sans rendu\n"
+            "  -m : contrôle de l'horodatage MIDI du chemin DMA, code de sortie 2 si non conforme\n", prog, SAMPLER_MIDI_CHANNEL + 1);
+}
+
+int main(int argc, char **argv) {
+    const char *scenario = NULL;
+    const char *output = NULL;
+    float duration_s = 0.0f;
+    FILE *out = NULL;
+    int raw = 0;
+    int csv = 0;
+    int fir_bench = 0;
+    int midi_check = 0;
+    const char *reference = NULL;
+    float min_snr_db = 0.0f;
+    golden_t golden = { 0 };
+    const char *bank_path = NULL;
+    const char *sd_path = NULL;
+    uint8_t *bank = NULL, *sd = NULL;
+    uint32_t bank_size = 0, sd_size = 0;
+    uint32_t sd_faults = 0;
+    static synth_sample_t left[AUDIO_BLOCK_SIZE] __ALIGNED(4), right[AUDIO_BLOCK_SIZE] __ALIGNED(4);
+    static uint32_t frame[AUDIO_BLOCK_SIZE];    // trames [R:L] comme la moitié TX du DMA
+
+    for (int i = 1; i < argc; i++) {
+        if (!strcmp(argv[i], "-s") && i + 1 < argc) scenario = argv[++i];
+        else if (!strcmp(argv[i], "-o") && i + 1 < argc) output = argv[++i];
+        else if (!strcmp(argv[i], "-d") && i + 1 < argc) duration_s = (float)atof(argv[++i]);
+        else if (!strcmp(argv[i], "-c")) csv = 1;
+        else if (!strcmp(argv[i], "-r") && i + 1 < argc) reference = argv[++i];
+        else if (!strcmp(argv[i], "-t") && i + 1 < argc) min_snr_db = (float)atof(argv[++i]);
+        else if (!strcmp(argv[i], "-b") && i + 1 < argc) bank_path = argv[++i];
+        else if (!strcmp(argv[i], "-S") && i + 1 < argc) sd_path = argv[++i];
+        else if (!strcmp(argv[i], "-F") && i + 1 < argc) sd_faults = (uint32_t)atoi(argv[++i]);
+        else if (!strcmp(argv[i], "-f")) fir_bench = 1;
+        else if (!strcmp(argv[i], "-m")) midi_check = 1;
+        else { usage(argv[0]); return 1; }
+    }
+
+    if (fir_bench) {
+        FIR_bench();
+        return 0;
+    }
+    if (midi_check) {
+        return stamp_check() ? 2 : 0;
+    }
+
+    if (scenario != NULL) {
+        if (load_scenario(scenario) != 0) return 1;
+    } else {
+        load_default_scenario();
+    }
+    qsort(events, nb_events, sizeof(events[0]), cmp_event);
+
+    uint32_t nb_frames;
+    if (duration_s > 0.0f) {
+        nb_frames = (uint32_t)(duration_s * SYNTH_SAMPLE_RATE);
+    } else {
+        // fin du dernier événement + 2 s de queue de release/reverb
+        nb_frames = (nb_events ? events[nb_events - 1].sample : 0) + 2u * (uint32_t)SYNTH_SAMPLE_RATE;
+    }
+    nb_frames -= nb_frames % AUDIO_BLOCK_SIZE;
+
+    if (output != NULL) {
+        size_t len = strlen(output);
+        raw = (len > 4 && !strcmp(output + len - 4, ".raw"));
+        out = fopen(output, "wb");
+        if (out == NULL) {
+            fprintf(stderr, "impossible de créer %s\n", output);
+            return 1;
+        }
+        if (!raw) write_wav_header(out, nb_frames);
+    }
+
+    if (reference != NULL) {
+        golden.f = fopen(reference, "rb");
+        if (golden.f == NULL) {
+            fprintf(stderr, "impossible d'ouvrir %s\n", reference);
+            return 1;
+        }
+    }
+
+    if (bank_path != NULL && (bank = load_file(bank_path, &bank_size)) == NULL) return 1;
+    if (sd_path != NULL && (sd = load_file(sd_path, &sd_size)) == NULL) return 1;
+
+    synth_init();
+    // comme sampler_storage_init() : carte SD puis répertoire de la banque
+    if (bank != NULL) {
+#if (SYNTH_SAMPLER)
+        if (sd != NULL) sampler_host_set_sd(&sampler, sd, sd_size);
+        sampler_host_set_faults(sd_faults);
+        if (sampler_load(&sampler, bank, bank_size) < 0) {
+            fprintf(stderr, "banque %s refusée\n", bank_path);
+            return 1;
+        }
+#else
+        fprintf(stderr, "sampler non compilé (SYNTH_SAMPLER=0) : %s ignorée\n", bank_path);
+        (void)sd_faults;
+#endif
+    }
+    synth_profile_init();
+    // une moitié simulée par bloc, libérée juste avant son rendu : seule la
+    // charge est significative hors temps réel
+    synth_telemetry_init((uint32_t)(1e9 / SYNTH_SAMPLE_RATE * AUDIO_BLOCK_SIZE));
+
+    uint32_t next_event = 0;
+    uint64_t render_ns = 0;
+    for (uint32_t pos = 0; pos < nb_frames; pos += AUDIO_BLOCK_SIZE) {
+        // les événements du bloc sont mis en file avec leur horodatage, comme
+        // le callback USB ; le rendu les applique à l'échantillon près
+        while (next_event < nb_events && events[next_event].sample < pos + AUDIO_BLOCK_SIZE) {
+            synth_midi_post(events[next_event].status, events[next_event].data1,
+                            events[next_event].data2, events[next_event].sample);
+            next_event++;
+        }
+
+        uint64_t t0 = host_clock_ns();
+        synth_telemetry_dma_half((uint32_t)t0);
+        synth_telemetry_render_begin((uint32_t)t0);
+        synth_render_block(left, right, AUDIO_BLOCK_SIZE);
+        uint64_t t1 = host_clock_ns();
+        synth_telemetry_render_end((uint32_t)t1, voices.active_count);
+        render_ns += t1 - t0;
+        synth_profile_poll();
+
+        if (out != NULL || golden.f != NULL) {
+            SYNTH_TO_CODEC(left, right, frame, AUDIO_BLOCK_SIZE);
+        }
+        if (out != NULL) fwrite(frame, sizeof(uint32_t), AUDIO_BLOCK_SIZE, out);
+        if (golden.f != NULL) golden_compare(&golden, frame, AUDIO_BLOCK_SIZE);
+    }
+
+    if (out != NULL) fclose(out);
+
+    double audio_s = nb_frames / (double)SYNTH_SAMPLE_RATE;
+    printf("rendu : %u échantillons (%.2f s audio), bloc %u, %u événements MIDI\n",
+           nb_frames, audio_s, (unsigned)AUDIO_BLOCK_SIZE, nb_events);
+    const synth_profile_stat_t *st = synth_profile_stats();
+    printf("%-14s %10s %12s %8s   %s\n", "étage", "ns/éch", "éch/s", "% total", "µs/bloc min/moy/max");
+    for (int s = 0; s < PROF_STAGE_COUNT; s++) {
+        if (st[s].count == 0) continue;
+        double ns = st[s].samples ? (double)st[s].sum / st[s].samples : 0.0;
+        double sps = st[s].sum ? st[s].samples * 1e9 / st[s].sum : 0.0;
+        printf("%-14s %10.2f %12.0f %7.1f%%   %.2f / %.2f / %.2f\n", synth_profile_names[s], ns, sps,
+               render_ns ? 100.0 * st[s].sum / render_ns : 0.0,
+               st[s].min / 1e3, (double)st[s].sum / st[s].count / 1e3, st[s].max / 1e3);
+    }
+    double total_ns = nb_frames ? (double)render_ns / nb_frames : 0.0;
+    printf("%-14s %12.2f %14.0f\n", "chaîne", total_ns, render_ns ? nb_frames * 1e9 / render_ns : 0.0);
+    printf("facteur temps réel : x%.1f (budget %.0f ns/éch à %.0f Hz)\n",
+           render_ns ? audio_s * 1e9 / render_ns : 0.0, 1e9 / SYNTH_SAMPLE_RATE, SYNTH_SAMPLE_RATE);
+
+    struct synth_telemetry_record_TypeStruct tlm;
+    synth_telemetry_snapshot(&tlm, (uint32_t)(audio_s * 1000.0));
+    printf("charge par bloc : moy %.1f%% max %.1f%%, voix max %u, MIDI perdus %u\n",
+           tlm.load_avg / 10.0, tlm.load_max / 10.0, tlm.voices_max, (unsigned)tlm.midi_overflows);
+
+#if (SYNTH_SAMPLER)
+    if (sampler_ready(&sampler)) {
+        const struct sampler_stats_TypeStruct *ss = &sampler.stats;
+        printf("sampler : %u zones, lectures SD %u (attente max %u), blocs en manque %u, erreurs %u, écartées %u, fins ignorées %u\n",
+               (unsigned)sampler.zone_count, (unsigned)ss->reads, (unsigned)ss->wait_max,
+               (unsigned)ss->underruns, (unsigned)ss->read_errors, (unsigned)ss->discarded,
+               (unsigned)ss->stray);
+    }
+#endif
+
+    if (csv) synth_profile_dump();
+
+    if (golden.f != NULL) {
+        fclose(golden.f);
+        if (golden_report(&golden, min_snr_db) != 0) return 2;
+    }
+    free(bank);
+    free(sd);
+
+    return 0;
+}
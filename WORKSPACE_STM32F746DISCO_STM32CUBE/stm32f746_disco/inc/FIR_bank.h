@@ -0,0 +1,24 @@
+/*
+ * FIR_bank.h
+ *
+ *  Banque de coefficients FIR passe-bas précalculés, indexée par la
+ *  fréquence de coupure (échelle logarithmique FIR_BANK_FMIN..FIR_BANK_FMAX).
+ *  Un changement de coupure devient une interpolation entre deux lignes
+ *  voisines de la banque, sans sinf/cosf. La banque est générée à la
+ *  compilation (synth_tables.h) et lue en flash.
+ */
+
+#ifndef INC_FIR_BANK_H_
+#define INC_FIR_BANK_H_
+
+#include "arm_math.h"
+#include "synth_tables.h"
+
+#define FIR_BANK_TAPS   SYNTH_FIR_BANK_TAPS
+#define FIR_BANK_SIZE   SYNTH_FIR_BANK_SIZE     // nombre de coupures précalculées
+#define FIR_BANK_FMIN   SYNTH_FIR_BANK_FMIN
+#define FIR_BANK_FMAX   SYNTH_FIR_BANK_FMAX
+const float32_t* FIR_bank_nearest(float32_t cutoff);
+void FIR_bank_interp(float32_t cutoff, float32_t *pDst);
+
+#endif /* INC_FIR_BANK_H_ */
@@ -1,25 +1,16 @@
-//#include "arm_math.h"
-#include <stdint.h>
-
-#define N_FILTER 64 // A MODIFIER
-#define FILTER_COEFFS h_low_0_4500__f32 // A MODIFIER
-
-
-float h_low_0_4500__f32[64]=
-{
-0.000788,0.000557,0.000062,-0.000612,-0.001261,-0.001566,-0.001194,0.000000,0.001772,0.003433,0.004034,0.002796,-0.000389,-0.004632,-0.008157,-0.008917,-0.005556,0.001676,0.010534,0.017253,0.017890,0.010125,-0.005177,-0.023402,-0.037048,-0.037959,-0.020248,0.017121,0.069114,0.125417,0.173108,0.200439,0.200439,0.173108,0.125417,0.069114,0.017121,-0.020248,-0.037959,-0.037048,-0.023402,-0.005177,0.010125,0.017890,0.017253,0.010534,0.001676,-0.005556,-0.008917,-0.008157,-0.004632,-0.000389,0.002796,0.004034,0.003433,0.001772,0.000000,-0.001194,-0.001566,-0.001261,-0.000612,0.000062,0.000557,0.000788,
-};
-
-int16_t h_low_0_4500__q15[64]=
-{
-25,18,2,-20,-41,-51,-39,0,58,112,132,91,-12,-151,-267,-292,-182,54,345,565,586,331,-169,-766,-1213,-1243,-663,561,2264,4109,5672,6567,6567,5672,4109,2264,561,-663,-1243,-1213,-766,-169,331,586,565,345,54,-182,-292,-267,-151,-12,91,132,112,58,0,-39,-51,-41,-20,2,18,25,
-};
-
-
-
-
-
+/*
+ * FIR_coeff.h
+ *
+ *  Passe-bas fixe 64 coefficients à 4500 Hz, généré avec les autres tables
+ *  (synth_tables.h) au lieu d'être recopié dans chaque fichier qui l'inclut.
+ */
 
+#ifndef INC_FIR_COEFF_H_
+#define INC_FIR_COEFF_H_
 
+#include "synth_tables.h"
 
+#define N_FILTER SYNTH_FIR_LOWPASS_TAPS
+#define FILTER_COEFFS synth_fir_lowpass_f32
 
+#endif /* INC_FIR_COEFF_H_ */
@@ -3,6 +3,14 @@
  *
  *  Created on: 13 sept. 2016
  *      Author: kerhoas
+ *
+ *  Filtres FIR réentrants, traitement par blocs.
+ *  État linéaire double longueur : les entrées sont ajoutées à la suite de
+ *  l'historique (position propre à chaque instance) et chaque sortie lit une
+ *  fenêtre contiguë ; l'historique n'est recopié en tête que lorsque la fin
+ *  du tampon est atteinte (une fois toutes les numTaps + FIR_SPAN_MIN entrées).
+ *  Coefficients dans l'ordre de arm_fir_* : pCoeffs[0] pondère l'échantillon
+ *  le plus ancien. Sortie q15 identique à arm_fir_q15 (accumulateur 64 bits).
  */
 
 #ifndef INC_FIR_FILTERS_H_
@@ -10,17 +18,42 @@
 
 #include "arm_math.h"
 
-void FIR_init_f32(arm_fir_instance_f32 *S, uint16_t numTaps,float32_t *pCoeffs, float32_t *pState );
+// Entrées logées au minimum entre deux recopies de l'historique
+#define FIR_SPAN_MIN 32
+// Taille de pState (échantillons) pour numTaps coefficients
+#define FIR_STATE_SIZE(numTaps) (2 * (numTaps) - 1 + FIR_SPAN_MIN)
+
+struct FIR_f32_TypeStruct
+{
+	uint16_t numTaps;
+	uint32_t pos;				// prochaine écriture dans pState
+	const float32_t *pCoeffs;
+	float32_t *pState;			// FIR_STATE_SIZE(numTaps)
+};
+
+struct FIR_q15_TypeStruct
+{
+	uint16_t numTaps;
+	uint32_t pos;
+	const q15_t *pCoeffs;
+	q15_t *pState;
+};
+
 void FIR_calc_coeff_f32(arm_fir_instance_f32 *S, uint16_t numTaps,float32_t fc1, float32_t fc2, float32_t fe, int filter_type );
 void FIR_custom_init_f32( arm_fir_instance_f32 *S, uint16_t numTaps,float32_t fc1, float32_t fc2, float32_t fe,  float32_t *pCoeffs, float32_t *pState );
 
+void FIR_init_f32(struct FIR_f32_TypeStruct *S, uint16_t numTaps, const float32_t *pCoeffs, float32_t *pState);
+// pSrc et pDst peuvent être confondus
+void FIR_filt_f32(struct FIR_f32_TypeStruct *S, const float32_t *pSrc, float32_t *pDst, uint32_t blockSize);
 
-void FIR_filt_f32(arm_fir_instance_f32 *S, float32_t *pSrc, float32_t *pDst);
-
-void FIR_filt_f32_circular(arm_fir_instance_f32 *S, float32_t *pSrc, float32_t *pDst);
+void FIR_init_q15(struct FIR_q15_TypeStruct *S, uint16_t numTaps, const q15_t *pCoeffs, q15_t *pState);
+void FIR_filt_q15(struct FIR_q15_TypeStruct *S, const q15_t *pSrc, q15_t *pDst, uint32_t blockSize);
 
-void FIR_init_q15(arm_fir_instance_q15 *S, uint16_t numTaps, q15_t * pCoeffs, q15_t * pState);
-void FIR_filt_q15(arm_fir_instance_q15 *S, q15_t *pSrc, q15_t *pDst);
-void FIR_filt_q15_circular(arm_fir_instance_q15 *S, q15_t *pSrc, q15_t *pDst);
+// Banc de mesure contre arm_fir_f32 / arm_fir_q15 / arm_fir_fast_q15 (SYNTH_PROFILE_DWT
+// ou SYNTH_PROFILE_HOST), dump CSV :
+//   # fir bench unit=<cycles|ns> block=<n>
+//   kernel,taps,ticks,max_err
+int FIR_bench_format(char *buf, int len);
+void FIR_bench(void);
 
 #endif /* INC_FIR_FILTERS_H_ */
@@ -44,6 +44,9 @@
 #if defined(__ICCARM__) || defined(__CC_ARM) || defined(__GNUC__)
  #include <stdint.h>
  extern uint32_t SystemCoreClock;
+ /* Compteur de temps d'exécution par tâche (synth_tasks.c) */
+ void synth_tasks_runtime_init(void);
+ uint32_t synth_tasks_runtime_counter(void);
 #endif
 
 /*  CMSIS-RTOSv2 defines 56 levels of priorities. To be able to use them
@@ -57,7 +60,8 @@
 #define configUSE_IDLE_HOOK               0
 #define configUSE_TICK_HOOK               0
 #define configMAX_PRIORITIES              (7)
-#define configSUPPORT_STATIC_ALLOCATION   0
+#define configSUPPORT_STATIC_ALLOCATION   1
+#define configSUPPORT_DYNAMIC_ALLOCATION  0
 #define configCPU_CLOCK_HZ                (SystemCoreClock)
 #define configTICK_RATE_HZ                ((TickType_t)1000)
 #define configMINIMAL_STACK_SIZE          ((uint16_t)128)
@@ -68,12 +72,15 @@
 #define configIDLE_SHOULD_YIELD           1
 #define configUSE_MUTEXES                 1
 #define configQUEUE_REGISTRY_SIZE         8
-#define configCHECK_FOR_STACK_OVERFLOW    0
+#define configCHECK_FOR_STACK_OVERFLOW    2
 #define configUSE_RECURSIVE_MUTEXES       1
 #define configUSE_MALLOC_FAILED_HOOK      0
 #define configUSE_APPLICATION_TASK_TAG    0
 #define configUSE_COUNTING_SEMAPHORES     1
-#define configGENERATE_RUN_TIME_STATS     0
+#define configGENERATE_RUN_TIME_STATS     1
+#define configUSE_STATS_FORMATTING_FUNCTIONS 0
+#define portCONFIGURE_TIMER_FOR_RUN_TIME_STATS() synth_tasks_runtime_init()
+#define portGET_RUN_TIME_COUNTER_VALUE()  synth_tasks_runtime_counter()
 
 /* Co-routine definitions. */
 #define configUSE_CO_ROUTINES           0
@@ -92,9 +99,10 @@ to exclude the API function. */
 #define INCLUDE_vTaskDelete            1
 #define INCLUDE_vTaskCleanUpResources  0
 #define INCLUDE_vTaskSuspend           1
-#define INCLUDE_vTaskDelayUntil        0
+#define INCLUDE_vTaskDelayUntil        1
 #define INCLUDE_vTaskDelay             1
 #define INCLUDE_xTaskGetSchedulerState 1
+#define INCLUDE_uxTaskGetStackHighWaterMark 1
 
 /*------------- CMSIS-RTOS V2 specific defines -----------*/
 /* When using CMSIS-RTOSv2 set configSUPPORT_STATIC_ALLOCATION to 1
@@ -153,8 +161,9 @@ header file. */
 #define vPortSVCHandler    SVC_Handler
 #define xPortPendSVHandler PendSV_Handler
 
-/* IMPORTANT: FreeRTOS is using the SysTick as internal time base, thus make sure the system and peripherials are
-              using a different time base (TIM based for example).
+/* SysTick est partagé : SysTick_Handler (stm32f7xx_it.c) incrémente le tick HAL
+   puis appelle xPortSysTickHandler une fois l'ordonnanceur lancé. Les deux
+   bases de temps sont à 1 ms (configTICK_RATE_HZ).
  */
 /* #define xPortSysTickHandler SysTick_Handler */
 
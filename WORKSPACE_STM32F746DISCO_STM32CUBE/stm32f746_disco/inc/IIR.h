@@ -1,25 +1,94 @@
+/*
+ * IIR.h
+ *
+ *  Filtre à variables d'état (SVF) en topologie TPT (Zavalishin, « The Art
+ *  of VA Filter Design ») : deux intégrateurs trapézoïdaux, réponse du
+ *  biquad analogique sans déformation de la résonance, stable quelle que
+ *  soit la vitesse de modulation de la coupure. Sorties passe-bas,
+ *  passe-bande (gain unité à la coupure), passe-haut et réjecteur.
+ *
+ *      g = tan(pi fc / fe)    k = 1 / Q
+ *      a1 = 1 / (1 + g (g + k))   a2 = g a1   a3 = g a2
+ *      v3 = x - ic2   v1 = a1 ic1 + a2 v3   v2 = ic2 + a2 ic1 + a3 v3
+ *      ic1 = 2 v1 - ic1   ic2 = 2 v2 - ic2
+ *      lp = v2   bp = k v1   hp = x - k v1 - v2   notch = x - k v1
+ *
+ *  Banque par voix (SoA) : une nouvelle coupure est atteinte en rampe sur le
+ *  bloc suivant, g et k interpolés à chaque échantillon, a1 suivi par une
+ *  itération de Newton (sans division). Coupure fixe : 10 opérations par
+ *  échantillon, et deux voix traitées dans la même boucle
+ *  (SVF_bank_process_pair) pour recouvrir leurs récursions.
+ */
+
 #ifndef IIR_H_
 #define IIR_H_
-#include <math.h>
 
-typedef struct {
-  float fc; // Filter cutoff frequency
-  float Q; // Filter resonance
-  float alpha1, alpha2; // Filter coefficients
-  float yb1, yl1; // Filter state variables
-  float yl;
-} state_variable_filter_t;
+#include <stdint.h>
+#include "arm_math.h"
 
-void SVF_init(state_variable_filter_t *f, float fe, float cutoff, float resonance);
-void SVF_process(state_variable_filter_t *f,float x);
+// Nombre de filtres d'une banque (>= VOICE_COUNT)
+#ifndef SVF_BANK_SIZE
+#define SVF_BANK_SIZE 16
+#endif
 
+// Coupure maximale / fe : tan() reste fini
+#define SVF_FC_MAX_RATIO 0.49f
+#define SVF_Q_MIN 0.5f
 
+typedef enum {
+  SVF_LOWPASS = 0,
+  SVF_BANDPASS,
+  SVF_HIGHPASS,
+  SVF_NOTCH,
+  SVF_MODE_COUNT
+} svf_mode_t;
 
+// Filtre seul, traité échantillon par échantillon
+typedef struct {
+  float fc; // Filter cutoff frequency
+  float Q; // Filter resonance
+  float k; // 1 / Q
+  float a1, a2, a3; // Filter coefficients
+  float ic1eq, ic2eq; // Filter state variables (intégrateurs)
+  float yl, yb, yh; // Dernières sorties passe-bas, passe-bande, passe-haut
+} state_variable_filter_t;
 
+// Banque de filtres en tableaux (SoA), une entrée par voix, mode partagé
+struct svf_bank_TypeStruct
+{
+  svf_mode_t mode;
+  float32_t fe;
+  float32_t g[SVF_BANK_SIZE];         // coefficients appliqués en fin du dernier bloc
+  float32_t k[SVF_BANK_SIZE];
+  float32_t a1[SVF_BANK_SIZE];
+  float32_t g_target[SVF_BANK_SIZE];  // atteints à la fin du prochain bloc
+  float32_t k_target[SVF_BANK_SIZE];
+  float32_t a1_target[SVF_BANK_SIZE];
+  float32_t ic1eq[SVF_BANK_SIZE];
+  float32_t ic2eq[SVF_BANK_SIZE];
+};
 
+// tan(x) pour 0 <= x < pi/2, approximant de Padé (erreur relative < 3e-6)
+float32_t SVF_tan(float32_t x);
 
+void SVF_init(state_variable_filter_t *f, float fe, float cutoff, float resonance);
+void SVF_set(state_variable_filter_t *f, float fe, float cutoff, float resonance);
+// Un échantillon : met à jour yl, yb, yh et retourne le passe-bas
+float SVF_process(state_variable_filter_t *f, float x);
 
+void SVF_bank_init(struct svf_bank_TypeStruct *bank, svf_mode_t mode, float32_t fe);
+void SVF_bank_set_mode(struct svf_bank_TypeStruct *bank, svf_mode_t mode);
+// Coupure et résonance visées par le filtre i, atteintes en fin du prochain bloc
+void SVF_bank_set(struct svf_bank_TypeStruct *bank, uint32_t i, float32_t cutoff, float32_t resonance);
+// Coupure et résonance appliquées immédiatement, état remis à zéro
+void SVF_bank_reset(struct svf_bank_TypeStruct *bank, uint32_t i, float32_t cutoff, float32_t resonance);
+// pSrc et pDst peuvent être confondus
+void SVF_bank_process(struct svf_bank_TypeStruct *bank, uint32_t i, const float32_t *pSrc, float32_t *pDst, uint32_t blockSize);
+void SVF_bank_process_q15(struct svf_bank_TypeStruct *bank, uint32_t i, const q15_t *pSrc, q15_t *pDst, uint32_t blockSize);
+// Filtres i et j (i != j) sur place, dans la même boucle
+void SVF_bank_process_pair(struct svf_bank_TypeStruct *bank, uint32_t i, uint32_t j, float32_t *pBufI, float32_t *pBufJ,
+                           uint32_t blockSize);
+void SVF_bank_process_pair_q15(struct svf_bank_TypeStruct *bank, uint32_t i, uint32_t j, q15_t *pBufI, q15_t *pBufJ,
+                               uint32_t blockSize);
 
 #endif /* IIR_H_ */
-
-
@@ -1,39 +1,77 @@
-#include <stdlib.h>
+/*
+ * IIR_filter.h
+ *
+ *  Cascades de biquads traitées par blocs (arm_biquad_cascade_df2T_f32,
+ *  ou arm_biquad_cascade_df1_q31 pour la chaîne virgule fixe).
+ *  Les sections sont calculées à partir de prototypes analogiques
+ *  transformés par szxform() (bilinear.c) : Butterworth, Chebyshev type I,
+ *  plateaux (shelving) et cloche (peaking).
+ */
+
+#ifndef INC_IIR_FILTER_H_
+#define INC_IIR_FILTER_H_
+
 #include <stdint.h>
-#include <math.h>
 #include "arm_math.h"
 
+#define IIR_MAX_STAGES 4            // ordre maximal : 2 * IIR_MAX_STAGES
+
+typedef enum {
+    IIR_LOWPASS = 0,                // Butterworth, param = Q de résonance (0.7071 = Butterworth pur)
+    IIR_HIGHPASS,                   // Butterworth, param = Q de résonance
+    IIR_CHEBYSHEV_LOWPASS,          // Chebyshev type I, param = ondulation en dB
+    IIR_LOWSHELF,                   // plateau grave, param = Q, gain_db
+    IIR_HIGHSHELF,                  // plateau aigu, param = Q, gain_db
+    IIR_PEAKING                     // cloche, param = Q, gain_db
+} iir_type_t;
+
+// Instance mono : coefficients {b0, b1, b2, a1, a2} par section + état DF2T
+struct iir_TypeStruct
+{
+    arm_biquad_cascade_df2T_instance_f32 S;
+    float32_t coeffs[5 * IIR_MAX_STAGES];
+    float32_t state[2 * IIR_MAX_STAGES];
+};
 
-typedef struct
-  {
-    uint16_t numStages;
-    float32_t *pState;
-    float32_t *coef;
-  } arm_iir_instance_f32;
+// Instance stéréo : mêmes coefficients pour L et R, entrée/sortie entrelacées
+struct iir_stereo_TypeStruct
+{
+    arm_biquad_cascade_stereo_df2T_instance_f32 S;
+    float32_t coeffs[5 * IIR_MAX_STAGES];
+    float32_t state[4 * IIR_MAX_STAGES];
+};
 
-/* FILTER INFORMATION STRUCTURE FOR FILTER ROUTINES */
-typedef struct {
-    unsigned int length;       /* size of filter */
-    float *history;            /* pointer to history in filter */
-    float *coef;               /* pointer to coefficients of filter */
-} FILTER;
+// Instance virgule fixe (DF1, accumulateur 64 bits) : coefficients et état en Q31,
+// {b0, b1, b2, a1, a2} divisés par 2^postShift. En Q15, b0 d'un passe-bas à
+// 20 Hz (~1e-5) serait arrondi à zéro ; les échantillons restent en Q15.
+struct iir_q31_TypeStruct
+{
+    arm_biquad_casd_df1_inst_q31 S;
+    q31_t coeffs[5 * IIR_MAX_STAGES];
+    q31_t state[4 * IIR_MAX_STAGES];
+};
 
-#define FILTER_SECTIONS   2   /* 2 filter sections for 24 db/oct filter */
+uint8_t IIR_design_f32(float32_t *pCoeffs, iir_type_t type, uint8_t order,
+                       float32_t fc, float32_t fe, float32_t param, float32_t gain_db);
 
-typedef struct {
-        float a0, a1, a2;       /* numerator coefficients */
-        float b0, b1, b2;       /* denominator coefficients */
-} BIQUAD;
+void IIR_init_f32(struct iir_TypeStruct *f, iir_type_t type, uint8_t order,
+                  float32_t fc, float32_t fe, float32_t param, float32_t gain_db);
+void IIR_set_f32(struct iir_TypeStruct *f, iir_type_t type, uint8_t order,
+                 float32_t fc, float32_t fe, float32_t param, float32_t gain_db);
+void IIR_process_block(struct iir_TypeStruct *f, float32_t *pSrc, float32_t *pDst, uint32_t blockSize);
+void IIR_reset_states(struct iir_TypeStruct *f);
 
-void szxform(
-    float *a0, float *a1, float *a2,     /* numerator coefficients */
-    float *b0, float *b1, float *b2,   /* denominator coefficients */
-    float fc,           /* Filter cutoff frequency */
-    float fs,           /* sampling rate */
-    float *k,           /* overall gain factor */
-    float *coef);         /* pointer to 4 iir coefficients */
+void IIR_stereo_init_f32(struct iir_stereo_TypeStruct *f, iir_type_t type, uint8_t order,
+                         float32_t fc, float32_t fe, float32_t param, float32_t gain_db);
+void IIR_stereo_set_f32(struct iir_stereo_TypeStruct *f, iir_type_t type, uint8_t order,
+                        float32_t fc, float32_t fe, float32_t param, float32_t gain_db);
+void IIR_stereo_process_block(struct iir_stereo_TypeStruct *f, float32_t *pSrc, float32_t *pDst, uint32_t blockSize);
 
+void IIR_init_q31(struct iir_q31_TypeStruct *f, iir_type_t type, uint8_t order,
+                  float32_t fc, float32_t fe, float32_t param, float32_t gain_db);
+void IIR_set_q31(struct iir_q31_TypeStruct *f, iir_type_t type, uint8_t order,
+                 float32_t fc, float32_t fe, float32_t param, float32_t gain_db);
+void IIR_process_block_q31(struct iir_q31_TypeStruct *f, q31_t *pSrc, q31_t *pDst, uint32_t blockSize);
+void IIR_process_block_q15(struct iir_q31_TypeStruct *f, q15_t *pSrc, q15_t *pDst, uint32_t blockSize);
 
-void IIR_init_f32( arm_iir_instance_f32 * S,  uint16_t numStages,  float32_t * pCoeffs,  float32_t * pState,  uint32_t blockSize);
-int IIR_filt_f32(arm_iir_instance_f32 *S, float* x, float* y);
-void IIR_calc_coeff_f32(arm_iir_instance_f32 *S, uint16_t numStages,float32_t fc1, float32_t fc2, float32_t fe, int filter_type );
+#endif /* INC_IIR_FILTER_H_ */
@@ -1,7 +1,11 @@
 
 
+#ifndef ADSR_H
+#define ADSR_H
+
 //#include "notes.h"
 #include <stdint.h>
+#include "arm_math.h"
 
 // DURÉES ADSR LONGUES POUR OSCILLOSCOPE
 #define ATTACK_DURATION  1000.0
@@ -9,23 +13,61 @@
 #define SUSTAIN_LEVEL    0.7
 #define RELEASE_DURATION 1000.0
 
+// Courbure des segments : écart entre l'asymptote du pôle et le niveau visé.
+// Attaque peu courbée (0.3), decay/release exponentiels jusqu'à -60 dB (0.001).
+#define ADSR_ATTACK_RATIO   0.3f
+#define ADSR_DECAY_RATIO    0.001f
+
+// Nombre d'enveloppes d'une banque (>= VOICE_COUNT)
+#ifndef ADSR_BANK_SIZE
+#define ADSR_BANK_SIZE 16
+#endif
+
 enum state_t { INIT, NOTE_OFF, ATTACK, DECAY, SUSTAIN, RELEASE };
 
+// Segment à un pôle : level = base + level * coef, tend vers target
+struct adsr_segment_TypeStruct
+{
+    float coef;
+    float base;                 // target * (1 - coef)
+    float target;
+    float inv_log_coef;         // 1 / ln(coef), pour la durée restante du segment
+};
+
+// Paramètres partagés par toutes les enveloppes d'une banque,
+// recalculés une fois à chaque changement (adsr_set_*)
 struct adsr_TypeStruct
 {
-    enum state_t state;
-    float current_level;
-    float attack_increment;
-    float decay_decrement;
-    float release_decrement;
-    float sustain_level;
     uint32_t sample_rate;
     float attack_time_ms;
     float decay_time_ms;
+    float sustain_level;
     float release_time_ms;
+    struct adsr_segment_TypeStruct attack;
+    struct adsr_segment_TypeStruct decay;
+    struct adsr_segment_TypeStruct release;
+};
+
+// État des enveloppes en tableaux (SoA), une entrée par voix
+struct adsr_bank_TypeStruct
+{
+    const struct adsr_TypeStruct *params;
+    float32_t level[ADSR_BANK_SIZE];
+    uint8_t state[ADSR_BANK_SIZE];      // enum state_t
 };
 
-float adsr(struct adsr_TypeStruct* adsr_s);
 void adsr_init(struct adsr_TypeStruct* adsr, uint32_t sample_rate);
-void adsr_note_on(struct adsr_TypeStruct* adsr);
-void adsr_note_off(struct adsr_TypeStruct* adsr);
+void adsr_set_attack(struct adsr_TypeStruct* adsr, float time_ms);
+void adsr_set_decay(struct adsr_TypeStruct* adsr, float time_ms);
+void adsr_set_sustain(struct adsr_TypeStruct* adsr, float level);
+void adsr_set_release(struct adsr_TypeStruct* adsr, float time_ms);
+
+void adsr_bank_init(struct adsr_bank_TypeStruct* bank, const struct adsr_TypeStruct* params);
+void adsr_note_on(struct adsr_bank_TypeStruct* bank, uint32_t i);
+void adsr_note_off(struct adsr_bank_TypeStruct* bank, uint32_t i);
+// Rend un bloc de l'enveloppe i : une transition d'état au plus par segment,
+// boucle sans branchement entre deux transitions
+void adsr_process_block(struct adsr_bank_TypeStruct* bank, uint32_t i, float32_t* pDst, uint32_t blockSize);
+void adsr_process_block_q15(struct adsr_bank_TypeStruct* bank, uint32_t i, q15_t* pDst, uint32_t blockSize);
+
+#endif
@@ -0,0 +1,44 @@
+/*
+ * audio_buffer.h
+ *
+ *  Vues sur les moitiés ping-pong du DMA audio (SDRAM).
+ *  Une trame stéréo = un mot de 32 bits [R:L] (L dans la moitié basse), le
+ *  format écrit et lu par le SAI. Les étages de traitement travaillent sur
+ *  des canaux séparés : la conversion entrelacé <-> L/R se fait en une seule
+ *  passe, directement depuis la moitié RX remplie et vers la moitié TX que
+ *  le DMA ne lit pas, sans tampon intermédiaire.
+ *
+ *  Flottant : pleine échelle du codec = +/-1.0.
+ *  Q15      : échantillons du codec tels quels, deux trames par itération
+ *             (__PKHBT / __PKHTB).
+ */
+
+#ifndef INC_AUDIO_BUFFER_H_
+#define INC_AUDIO_BUFFER_H_
+
+#include <stdint.h>
+#include "arm_math.h"
+
+struct audio_view_TypeStruct
+{
+    const uint32_t *rx;     // moitié remplie par le DMA de réception
+    uint32_t *tx;           // moitié libérée par le DMA d'émission
+    uint32_t frames;        // trames stéréo par moitié
+};
+
+#if defined(USE_HAL_DRIVER)
+// Moitiés désignées par les callbacks DMA (rx_buffer_proc / tx_buffer_proc).
+// acquire invalide la moitié RX, release nettoie la moitié TX : sans effet
+// tant que les tampons sont dans la SRAM non cacheable (synth_memory.h).
+void audio_buffer_acquire(struct audio_view_TypeStruct* view);
+void audio_buffer_release(struct audio_view_TypeStruct* view);
+#endif
+
+void audio_deinterleave_f32(const uint32_t* pSrc, float32_t* pDstL, float32_t* pDstR, uint32_t frames);
+void audio_deinterleave_q15(const uint32_t* pSrc, q15_t* pDstL, q15_t* pDstR, uint32_t frames);
+// gain : valeur du codec pour un échantillon à 1.0, saturation sur 16 bits
+void audio_interleave_f32(const float32_t* pSrcL, const float32_t* pSrcR, uint32_t* pDst, float32_t gain, uint32_t frames);
+// shift : décalage arithmétique à droite appliqué à chaque échantillon
+void audio_interleave_q15(const q15_t* pSrcL, const q15_t* pSrcR, uint32_t* pDst, uint32_t shift, uint32_t frames);
+
+#endif /* INC_AUDIO_BUFFER_H_ */
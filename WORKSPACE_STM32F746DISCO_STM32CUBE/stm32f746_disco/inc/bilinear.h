@@ -1,4 +1,7 @@
 // bilinear.h
+#ifndef INC_BILINEAR_H_
+#define INC_BILINEAR_H_
+
 // second order type 1 Chebyshev LPF with 2dB passband ripple
 // and cutoff frequency 1500Hz
 /*
@@ -87,3 +90,12 @@ void bilinear(
     float *k,                                   /* overall gain factor */
     float fs,                                   /* sampling rate */
     float *coef);                         /* pointer to 4 iir coefficients */
+void szxform(
+    float *a0, float *a1, float *a2,     /* numerator coefficients */
+    float *b0, float *b1, float *b2,     /* denominator coefficients */
+    float fc,                                   /* filter cutoff frequency */
+    float fs,                                   /* sampling rate */
+    float *k,                                   /* overall gain factor */
+    float *coef);                         /* pointer to 4 iir coefficients */
+
+#endif /* INC_BILINEAR_H_ */
@@ -0,0 +1,68 @@
+/*
+ * conv_reverb.h
+ *
+ *  Reverb à convolution par réponse impulsionnelle (RI) stéréo, overlap-save
+ *  à partitions uniformes (UPOLS) :
+ *  - la RI est découpée en P partitions de CONV_PARTITION échantillons, chacune
+ *    transformée une fois pour toutes (arm_rfft_fast_f32, CONV_FFT_SIZE points)
+ *    et rangée en SDRAM ;
+ *  - à chaque partition d'entrée, une FFT alimente la ligne à retard
+ *    fréquentielle (FDL) ; la sortie est la somme des P produits spectre
+ *    d'entrée retardé x spectre de partition, puis une IFFT par canal.
+ *  Coût par échantillon : 3 FFT de CONV_FFT_SIZE points par partition
+ *  (O(log B)) plus 2P multiplications complexes par échantillon, contre
+ *  2 x longueur de la RI MAC pour arm_fir_f32.
+ *
+ *  Latence : CONV_PARTITION échantillons. Les blocs d'appel peuvent avoir
+ *  n'importe quelle taille (découpage aux événements MIDI).
+ *  Flottant uniquement.
+ */
+
+#ifndef INC_CONV_REVERB_H_
+#define INC_CONV_REVERB_H_
+
+#include <stdint.h>
+#include "arm_math.h"
+
+// Taille de partition B (FFT de 2B points, 2B parmi 32..4096)
+#ifndef CONV_PARTITION
+#define CONV_PARTITION 512
+#endif
+#define CONV_FFT_SIZE (2 * CONV_PARTITION)
+
+// Longueur de RI par défaut : 32768 échantillons (0.74 s à 44.1 kHz)
+#ifndef CONV_IR_LENGTH
+#define CONV_IR_LENGTH 32768
+#endif
+#define CONV_PARTITIONS(len) (((len) + CONV_PARTITION - 1) / CONV_PARTITION)
+
+// Mémoire à fournir à conv_reverb_init() : spectres L, spectres R et FDL
+#define CONV_MEMORY_SIZE(partitions) (3 * (partitions) * CONV_FFT_SIZE)
+
+#define CONV_MIX_DEFAULT 0.5f
+
+struct conv_reverb_TypeStruct {
+    arm_rfft_fast_instance_f32 fft;
+    uint32_t partitions;                // P
+    float32_t *spectra_l;               // P spectres de RI (format compact de arm_rfft_fast_f32)
+    float32_t *spectra_r;
+    float32_t *fdl;                     // P spectres d'entrée, le plus récent en fdl_index
+    uint32_t fdl_index;
+    float32_t input[CONV_FFT_SIZE];     // deux dernières partitions d'entrée
+    float32_t out_l[CONV_PARTITION];    // sortie humide de la dernière partition
+    float32_t out_r[CONV_PARTITION];
+    uint32_t pos;                       // position dans la partition courante
+    float mix;
+    float mix_current;                  // rampe vers mix sur le bloc suivant
+};
+
+void conv_reverb_init(struct conv_reverb_TypeStruct* conv, float32_t* pMemory, uint32_t partitions);
+// Charge une RI mono ou stéréo (pIrR = NULL : même RI sur les deux canaux), len <= P * CONV_PARTITION
+void conv_reverb_load_ir(struct conv_reverb_TypeStruct* conv, const float32_t* pIrL, const float32_t* pIrR, uint32_t len);
+// RI synthétique : bruit décroissant décorrélé L/R, énergie unité
+void conv_reverb_load_synthetic(struct conv_reverb_TypeStruct* conv, float rt60, float fe);
+void conv_reverb_process_block(struct conv_reverb_TypeStruct* conv, const float32_t* pSrc,
+                               float32_t* pDstL, float32_t* pDstR, uint32_t blockSize);
+void conv_reverb_set_mix(struct conv_reverb_TypeStruct* conv, float mix);
+
+#endif /* INC_CONV_REVERB_H_ */
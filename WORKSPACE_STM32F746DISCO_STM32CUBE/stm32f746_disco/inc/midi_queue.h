@@ -0,0 +1,37 @@
+/*
+ * midi_queue.h
+ *
+ *  File d'événements MIDI sans verrou, un producteur (callback USB) et un
+ *  consommateur (rendu audio). Chaque événement porte sa position sur
+ *  l'horloge d'échantillons du synthétiseur, le rendu l'applique à
+ *  l'échantillon près.
+ */
+
+#ifndef INC_MIDI_QUEUE_H_
+#define INC_MIDI_QUEUE_H_
+
+#include <stdint.h>
+
+#define MIDI_QUEUE_SIZE 64  // puissance de 2
+
+typedef struct {
+    uint32_t sample;        // horodatage (échantillons depuis synth_init)
+    uint8_t status;
+    uint8_t data1;
+    uint8_t data2;
+} midi_event_t;
+
+struct midi_queue_TypeStruct
+{
+    midi_event_t events[MIDI_QUEUE_SIZE];
+    volatile uint32_t head;     // écrit par le producteur seulement
+    volatile uint32_t tail;     // écrit par le consommateur seulement
+    volatile uint32_t dropped;  // événements perdus, file pleine
+};
+
+void midi_queue_init(struct midi_queue_TypeStruct* q);
+int midi_queue_push(struct midi_queue_TypeStruct* q, const midi_event_t* ev);
+int midi_queue_peek(struct midi_queue_TypeStruct* q, midi_event_t* ev);
+void midi_queue_pop(struct midi_queue_TypeStruct* q);
+
+#endif /* INC_MIDI_QUEUE_H_ */
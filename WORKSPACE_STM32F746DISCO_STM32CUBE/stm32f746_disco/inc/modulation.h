@@ -0,0 +1,145 @@
+/*
+ * modulation.h
+ *
+ *  Matrice de modulation : sources -> table de routage -> destinations lissées.
+ *
+ *      destination = base + somme (profondeur x source), bornée à [min, max]
+ *
+ *  - Sources globales (CC, pitch bend, LFO) : les messages MIDI ne font que
+ *    mémoriser la position de la source ; la somme est évaluée une fois par
+ *    segment de rendu (mod_update) puis lissée, à un pôle ou en rampe linéaire.
+ *  - Sources par voix (vélocité, enveloppe) : ajoutées par voice.c à la valeur
+ *    globale lissée (mod_voice_value), vers MOD_DST_CUTOFF et MOD_DST_AMP.
+ *
+ *  Côté consommateurs, les gains (voix, mix de reverb, sustain) sont
+ *  interpolés linéairement sur le bloc, à l'échantillon près ; les
+ *  coefficients coûteux (filtres, segments ADSR, gains de la FDN) sont
+ *  recalculés au plus une fois tous les MOD_COEFF_INTERVAL échantillons
+ *  (mod_due), et non plus à chaque message d'un balayage de potentiomètre.
+ */
+
+#ifndef INC_MODULATION_H_
+#define INC_MODULATION_H_
+
+#include <stdint.h>
+#include "arm_math.h"
+#include "synth.h"
+
+#define MOD_ROUTE_COUNT 16
+#define MOD_LFO_COUNT 2
+
+// Intervalle minimal entre deux recalculs de coefficients (5.8 ms à 44.1 kHz)
+#ifndef MOD_COEFF_INTERVAL
+#define MOD_COEFF_INTERVAL 256
+#endif
+
+// Fréquences des LFO au démarrage (Hz)
+#define MOD_LFO1_RATE_DEFAULT 5.0f
+#define MOD_LFO2_RATE_DEFAULT 0.3f
+
+// Pitch bend : ± demi-tons à fond de course ; vibrato : LFO1 -> hauteur,
+// en demi-tons crête (0 : pas de route au démarrage)
+#ifndef MOD_PITCHBEND_RANGE
+#define MOD_PITCHBEND_RANGE 2.0f
+#endif
+#ifndef MOD_VIBRATO_DEPTH
+#define MOD_VIBRATO_DEPTH 0.0f
+#endif
+
+typedef enum {
+    MOD_SRC_NONE = 0,
+    MOD_SRC_CC,                 // contrôleur route.cc, 0..1
+    MOD_SRC_PITCHBEND,          // -1..1, centré
+    MOD_SRC_LFO1,               // sinus -1..1
+    MOD_SRC_LFO2,
+    MOD_SRC_VELOCITY,           // par voix, 0..1
+    MOD_SRC_ENVELOPE,           // par voix, niveau ADSR en début de bloc
+    MOD_SRC_COUNT
+} mod_source_t;
+
+typedef enum {
+    MOD_DST_CUTOFF = 0,         // par voix : coupure / fréquence de la note
+    MOD_DST_RESONANCE,          // Q du passe-bas biquad ou du SVF
+    MOD_DST_AMP,                // par voix : gain avant mixage
+    MOD_DST_REVERB_FEEDBACK,
+    MOD_DST_REVERB_MIX,
+    MOD_DST_ATTACK,             // ms
+    MOD_DST_DECAY,              // ms
+    MOD_DST_SUSTAIN,
+    MOD_DST_RELEASE,            // ms
+    MOD_DST_PITCH,              // demi-tons, toutes les voix (incrément x 2^(p/12))
+    MOD_DST_COUNT
+} mod_dest_t;
+
+typedef enum {
+    MOD_SMOOTH_ONEPOLE = 0,     // constante de temps
+    MOD_SMOOTH_LINEAR           // rampe de durée fixe vers chaque nouvelle cible
+} mod_smooth_t;
+
+struct mod_route_TypeStruct
+{
+    uint8_t source;             // mod_source_t, MOD_SRC_NONE : entrée libre
+    uint8_t cc;                 // numéro de contrôleur (MOD_SRC_CC)
+    uint8_t dest;               // mod_dest_t
+    float depth;                // unités de la destination par unité de source
+};
+
+struct mod_param_TypeStruct
+{
+    float base;
+    float min;
+    float max;
+    float target;               // somme des sources globales, bornée
+    float value;                // valeur lissée en fin du dernier segment
+    float step;                 // rampe linéaire : pas par échantillon
+    float time;                 // échantillons : constante de temps ou durée de rampe
+    float coef_block;           // un pôle : décroissance sur AUDIO_BLOCK_SIZE échantillons
+    float applied;              // dernière valeur rendue par mod_due()
+    uint32_t elapsed;           // échantillons depuis, saturé à MOD_COEFF_INTERVAL
+    uint8_t smooth;             // mod_smooth_t
+    uint8_t voice_routes;       // routes depuis une source par voix
+};
+
+struct mod_lfo_TypeStruct
+{
+    uint32_t phase;             // 2^32 = une période
+    uint32_t increment;
+    float value;
+};
+
+struct mod_TypeStruct
+{
+    float cc[128];
+    float pitchbend;
+    struct mod_lfo_TypeStruct lfo[MOD_LFO_COUNT];
+    struct mod_route_TypeStruct route[MOD_ROUTE_COUNT];
+    struct mod_param_TypeStruct param[MOD_DST_COUNT];
+};
+
+extern struct mod_TypeStruct modulation;
+
+// Routage par défaut (CC7 coupure, CC71 résonance, CC1 feedback, pitch bend
+// hauteur, CC2-4 ADSR, LFO1 vibrato si MOD_VIBRATO_DEPTH) ; les sources partent des positions qui redonnent les réglages
+// par défaut des modules
+void mod_init(struct mod_TypeStruct* mod);
+// Entrée libre ou slot occupé remplacé ; -1 si la source par voix ne peut pas
+// atteindre la destination (globale)
+int mod_route_set(struct mod_TypeStruct* mod, uint32_t slot, mod_source_t source, uint8_t cc,
+                  mod_dest_t dest, float depth);
+void mod_route_clear(struct mod_TypeStruct* mod, uint32_t slot);
+void mod_set_lfo_rate(struct mod_TypeStruct* mod, uint32_t i, float freq);
+
+// Messages MIDI : position de la source seulement
+void mod_set_cc(struct mod_TypeStruct* mod, uint8_t cc, uint8_t value);
+void mod_set_pitchbend(struct mod_TypeStruct* mod, uint16_t value);
+
+// Avance LFO et lissages de blockSize échantillons, en tête de chaque segment rendu
+void mod_update(struct mod_TypeStruct* mod, uint32_t blockSize);
+float mod_value(const struct mod_TypeStruct* mod, mod_dest_t dest);
+// Valeur d'une destination par voix, sources de la voix comprises
+float mod_voice_value(const struct mod_TypeStruct* mod, mod_dest_t dest, float velocity, float envelope);
+// 1 si la valeur a changé depuis le dernier recalcul et que l'intervalle est
+// écoulé (ou que le lissage est terminé) : l'appelant recalcule ses coefficients
+int mod_due(struct mod_TypeStruct* mod, mod_dest_t dest);
+
+#endif /* INC_MODULATION_H_ */
@@ -8,6 +8,9 @@
 #ifndef INC_NOTES_H_
 #define INC_NOTES_H_
 
+// Fréquences des notes MIDI 0..127 : synth_note_freq[] (générée)
+#include "synth_tables.h"
+
 // FREQUENCES DES NOTES
 #define DO_0 32.7
 #define DO_d_0 34.6
@@ -96,128 +99,6 @@
 #define SI_4 988
 #define DO_5 1046.5
 
-// http://subsynth.sourceforge.net/midinote2freq.html
-
-float table_freq[200]= {
-
-		8.1757989156,				// 0 C1
-		8.6619572180,				// 1
-		9.1770239974,				// 2
-		9.7227182413,				// 3
-		10.3008611535,				// 4
-		10.9133822323,				// 5
-		11.5623257097,				// 6
-		12.2498573744,				// 7
-		12.9782717994,				// 8
-		13.7500000000,				// 9
-		14.5676175474,				// 10
-		15.4338531643,				// 11
-		//--------------------------------------------------------------------------
-		16.3515978313,				// 12 C2
-		17.3239144361,				// 13
-		18.3540479948,				// 14
-		19.4454364826,				// 15
-		20.6017223071,				// 16
-		21.8267644646,				// 17
-		23.1246514195,				// 18		349.228231433,				// 65
-		24.4997147489,				// 19
-		25.9565435987,				// 20
-		27.5,						// 21
-		29.1352350949,				// 22
-		30.8677063285,				// 23
-		//--------------------------------------------------------------------------
-		32.7031956626,				// 24 C3
-		34.6478288721,				// 25
-		36.7080959897,				// 26
-		38.8908729653,				// 27
-		41.2034446141,				// 28
-		43.6535289291,				// 29
-		46.249302839,				// 30
-		48.9994294977,				// 31
-		51.9130871975,				// 32
-		55.0,						// 33
-		58.2704701898,				// 34
-		61.735412657,				// 35
-		//--------------------------------------------------------------------------
-		65.4063913251,				// 36 C4
-		69.2956577442,				// 37
-		73.4161919794,				// 38
-		77.7817459305,				// 39
-		82.4068892282,				// 40
-		87.3070578583,				// 41
-		92.4986056779,				// 42
-		97.9988589954,				// 43
-		103.826174395,				// 44
-		110.0,						// 45
-		116.5409403795,				// 46
-		123.470825314,				// 47
-		//--------------------------------------------------------------------------
-		130.8127826503,				// 48 C5
-		138.5913154884,				// 49
-		146.8323839587,				// 50
-		155.563491861,				// 51
-		164.8137784564,				// 52
-		174.6141157165,				// 53
-		184.9972113558,				// 54
-		195.9977179909,				// 55
-		207.65234879,				// 56
-		220.0,						// 57
-		233.081880759,				// 58
-		246.9416506281,				// 59
-		//--------------------------------------------------------------------------
-		261.6255653006,				// 60 C6
-		277.1826309769,				// 61
-		293.6647679174,				// 62
-		311.1269837221,				// 63
-		329.6275569129,				// 64
-		349.228231433,				// 65
-		369.9944227116,				// 66
-		391.9954359817,				// 67
-		415.3046975799,				// 68
-		440.0,						// 69		A 440
-		466.1637615181,				// 70
-		493.8833012561,				// 71
-		//--------------------------------------------------------------------------
-		523.2511306012,				// 72 C7
-		554.3652619537,				// 73
-		587.3295358348,				// 74
-		622.2539674442,				// 75
-		659.2551138257,				// 76
-		698.456462866,				// 77
-		739.9888454233,				// 78
-		783.9908719635,				// 79
-		830.6093951599,				// 80
-		880.0,						// 81
-		932.3275230362,				// 82
-		987.7666025122,				// 83
-		//--------------------------------------------------------------------------
-		1046.5022612024,			// 84 C8
-		1108.7305239075,			// 85
-		1174.6590716696,			// 86
-		1244.5079348883,
-		1318.5102276515,
-		1396.912925732,
-		1479.9776908465,
-		1567.981743927,
-		1661.2187903198,
-		1760.0,
-		1864.6550460724,
-		1975.5332050245,
-		//--------------------------------------------------------------------------
-		2093.0045224048,
-		2217.461047815,
-		2349.3181433393,
-		2489.0158697766,
-		2637.020455303,
-		2793.825851464,
-		2959.9553816931,
-		3135.963487854,
-		3322.4375806396,
-		3520.0,
-		3729.3100921447,
-		3951.066410049
-		//--------------------------------------------------------------------------
-};
 
 
 #define SILENCE			0
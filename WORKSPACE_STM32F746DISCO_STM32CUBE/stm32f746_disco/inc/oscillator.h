@@ -0,0 +1,46 @@
+/*
+ * oscillator.h
+ *
+ *  Oscillateurs à bande limitée rendus par blocs.
+ *  Phase en virgule fixe 32 bits : 2^32 = une période, le débordement de
+ *  l'entier fait le modulo. Carré et dent de scie corrigés par PolyBLEP,
+ *  triangle par PolyBLAMP, sinus interpolé dans synth_sine_table[] : index
+ *  dans les SYNTH_SINE_TABLE_BITS bits de poids fort de la phase, fraction
+ *  dans les bits suivants.
+ *  L'incrément d'une note vient de synth_note_increment[] ; pitch bend et
+ *  vibrato le multiplient une fois par bloc (osc_increment_scale).
+ */
+
+#ifndef INC_OSCILLATOR_H_
+#define INC_OSCILLATOR_H_
+
+#include <stdint.h>
+#include "arm_math.h"
+
+// Amplitude crête : celle des anciennes tables (16384 / 32768)
+#define OSC_AMPLITUDE 0.5f
+
+// Interpolation du sinus : linéaire ou cubique Catmull-Rom (4 points). À 1024
+// points, l'erreur (-90 dB) vient de la quantification 16 bits de la table :
+// la cubique ne sert qu'aux tables générées plus courtes
+#define OSC_INTERP_LINEAR 0
+#define OSC_INTERP_CUBIC  1
+#ifndef OSC_SINE_INTERP
+#define OSC_SINE_INTERP OSC_INTERP_LINEAR
+#endif
+
+typedef enum {
+    OSC_SQUARE = 0,
+    OSC_SAW,
+    OSC_TRIANGLE,
+    OSC_SINE,
+    OSC_WAVE_COUNT
+} osc_wave_t;
+
+uint32_t osc_phase_increment(float32_t freq, float32_t fe);
+// Incrément multiplié par un rapport de fréquence, borné à fe / 2 ; exact si ratio = 1
+uint32_t osc_increment_scale(uint32_t increment, float32_t ratio);
+void osc_render_block(osc_wave_t wave, uint32_t *pPhase, uint32_t increment, float32_t *pDst, uint32_t blockSize);
+void osc_render_block_q15(osc_wave_t wave, uint32_t *pPhase, uint32_t increment, q15_t *pDst, uint32_t blockSize);
+
+#endif /* INC_OSCILLATOR_H_ */
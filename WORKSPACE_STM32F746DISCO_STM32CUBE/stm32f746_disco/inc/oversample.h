@@ -0,0 +1,59 @@
+/*
+ * oversample.h
+ *
+ *  Suréchantillonnage des oscillateurs : chaque voix est rendue à
+ *  OVERSAMPLE_FACTOR x fe puis ramenée à fe par des filtres demi-bande 2:1
+ *  en cascade (4x : un demi-bande court puis le demi-bande principal).
+ *
+ *  Demi-bande de 4K-1 coefficients : un coefficient sur deux est nul hors du
+ *  centre (0.5), et la réponse est symétrique. Par échantillon de sortie :
+ *  K multiplications sur des paires d'entrées additionnées, plus le centre.
+ *  Seules les sorties conservées sont calculées (décimation polyphase).
+ *
+ *  Gabarit du demi-bande principal (à 2 fe) : bande passante 0..16 kHz,
+ *  atténuation >= 80 dB au-delà de 28.1 kHz, ce qui ne replie que dans la
+ *  bande 16..22 kHz (47 coefficients, 12 MAC par échantillon de sortie).
+ *  4x : demi-bande de 23 coefficients en tête, 12 + 2 x 6 MAC. Le FIR direct
+ *  de chaque voix en coûte 64.
+ */
+
+#ifndef INC_OVERSAMPLE_H_
+#define INC_OVERSAMPLE_H_
+
+#include <stdint.h>
+#include "arm_math.h"
+#include "synth_format.h"
+#include "synth.h"
+
+// Facteur de suréchantillonnage des oscillateurs : 1 (aucun), 2 ou 4
+#ifndef OVERSAMPLE_FACTOR
+#define OVERSAMPLE_FACTOR 2
+#endif
+
+#if (OVERSAMPLE_FACTOR != 1) && (OVERSAMPLE_FACTOR != 2) && (OVERSAMPLE_FACTOR != 4)
+#error "OVERSAMPLE_FACTOR : 1, 2 ou 4"
+#endif
+
+// Demi-bandes : K paires de coefficients non nuls de part et d'autre du centre
+#define OVERSAMPLE_HB_K         12      // 2 fe -> fe
+#define OVERSAMPLE_HB4_K        6       // 4 fe -> 2 fe, transition 16..72 kHz
+#define OVERSAMPLE_HB_TAPS(K)   (4 * (K) - 1)
+
+struct oversample_TypeStruct
+{
+    // Dernières entrées de chaque étage (historique du filtre)
+    synth_sample_t hist[OVERSAMPLE_HB_TAPS(OVERSAMPLE_HB_K) - 1];
+#if (OVERSAMPLE_FACTOR == 4)
+    synth_sample_t hist4[OVERSAMPLE_HB_TAPS(OVERSAMPLE_HB4_K) - 1];
+#endif
+};
+
+// Calcule les coefficients (fenêtre de Kaiser), une fois au démarrage
+void oversample_init(void);
+void oversample_reset(struct oversample_TypeStruct* os);
+// Tampon partagé où rendre les blockSize x OVERSAMPLE_FACTOR échantillons
+// d'une voix avant oversample_decimate() (blockSize <= AUDIO_BLOCK_SIZE)
+synth_sample_t* oversample_input(void);
+void oversample_decimate(struct oversample_TypeStruct* os, synth_sample_t* pDst, uint32_t blockSize);
+
+#endif /* INC_OVERSAMPLE_H_ */
@@ -1,23 +1,50 @@
+/*
+ * reverb.h
+ *
+ *  Reverb à réseau de lignes à retard (FDN) : REVERB_LINES lignes de
+ *  longueurs premières entre elles, matrice de Hadamard (orthogonale),
+ *  amortissement passe-bas par ligne, sorties L/R décorrélées.
+ *  Une seule instance stéréo, traitée par blocs à coût fixe par échantillon.
+ */
+
 #ifndef REVERB_H
 #define REVERB_H
 
 #include <stdint.h>
+#include "synth_format.h"
 
-#define REVERB_DELAY_MAX 2400
+#define REVERB_LINES 8                  // puissance de 2 (transformée de Hadamard rapide)
+#define REVERB_LINE_SIZE 4096           // puissance de 2 : index masqué, sans modulo
+#define REVERB_LINE_MASK (REVERB_LINE_SIZE - 1)
+#define REVERB_DELAY_REF 2048.0f        // retard de référence du gain de boucle
 #define REVERB_FEEDBACK_DEFAULT 0.8f
 #define REVERB_MIX_DEFAULT 0.9f
+#define REVERB_DAMPING_DEFAULT 0.3f
+
+// Mémoire des lignes : REVERB_LINES * REVERB_LINE_SIZE échantillons (128 Ko en flottant),
+// fournie par l'appelant (SDRAM cacheable sur la cible, voir synth_memory.h).
 
 struct reverb_TypeStruct {
-    float delay_buffer[REVERB_DELAY_MAX];
-    uint16_t write_index;
-    uint16_t delay_samples;
+    synth_sample_t *lines;              // ligne i : lines[i * REVERB_LINE_SIZE]
+    uint32_t write_index;               // commun à toutes les lignes
+    uint16_t delay[REVERB_LINES];
+    float gain[REVERB_LINES];           // gain de boucle de chaque ligne
+#if (SYNTH_FORMAT == SYNTH_FORMAT_Q15)
+    q31_t damp_state[REVERB_LINES];     // Q15 décalé de 16 bits
+#else
+    float damp_state[REVERB_LINES];
+#endif
     float feedback_gain;
     float delay_mix;
+    float wet;                          // gain humide appliqué en fin de bloc, rampe vers delay_mix
+    float damping;
 };
 
-void reverb_init(struct reverb_TypeStruct* reverb);
-float reverb_process(struct reverb_TypeStruct* reverb, float input);
+void reverb_init(struct reverb_TypeStruct* reverb, synth_sample_t* pLines);
+void reverb_process_block(struct reverb_TypeStruct* reverb, const synth_sample_t* pSrc,
+                          synth_sample_t* pDstL, synth_sample_t* pDstR, uint32_t blockSize);
 void reverb_set_feedback(struct reverb_TypeStruct* reverb, float feedback);
 void reverb_set_delay_mix(struct reverb_TypeStruct* reverb, float delay_mix);
+void reverb_set_damping(struct reverb_TypeStruct* reverb, float damping);
 
 #endif
@@ -0,0 +1,204 @@
+/*
+ * sampler.h
+ *
+ *  Lecteur d'échantillons polyphonique, à côté du pool de voix (canal MIDI
+ *  SAMPLER_MIDI_CHANNEL), mixé avant la reverb.
+ *
+ *  Banque : un répertoire de zones et les échantillons PCM 16 bits mono en
+ *  QSPI (N25Q128A, 16 Mo), lus sans copie dans la fenêtre mappée en mémoire
+ *  à 0x90000000 (BSP_QSPI_EnableMemoryMappedMode, région MPU 4 cacheable).
+ *  Les échantillons longs (SAMPLER_ZONE_SD) sont sur la carte SD, blocs
+ *  bruts à partir de sd_block ; la QSPI n'en garde que la tête
+ *  (SAMPLER_STREAM_HEAD échantillons), jouée pendant l'amorçage du flux.
+ *
+ *  Flux SD : chaque voix a un anneau de SAMPLER_RING_BLOCKS blocs de 512
+ *  octets en SDRAM, rempli par BSP_SD_ReadBlocks_DMA en lectures d'au plus
+ *  SAMPLER_READ_BLOCKS blocs. Une seule lecture à la fois (un seul SDMMC) :
+ *  la fin de lecture (interruption) lance aussitôt la suivante, le rendu
+ *  relance la chaîne quand elle s'est arrêtée (sampler_stream_service).
+ *  Une lecture n'est enregistrée qu'une fois acceptée par le HAL ; une fin
+ *  sans lecture en cours est ignorée, une lecture sans fin à l'échéance
+ *  (SAMPLER_READ_DEADLINE) est annulée et comptée en erreur.
+ *  Ordonnancement au plus urgent d'abord : parmi les flux qui ont la place
+ *  d'une lecture, celui dont les données restantes s'épuisent le plus tôt
+ *  au pas de lecture courant. Avec au plus SAMPLER_VOICES flux à
+ *  SAMPLER_PITCH_MAX, une voix attend au pire SAMPLER_VOICES lectures ;
+ *  tête et marge de l'anneau couvrent cette attente (vérifié à la
+ *  compilation avec SAMPLER_SD_READ_US, durée d'une lecture au pire).
+ *
+ *  Position de lecture en virgule fixe 32.32, interpolation linéaire,
+ *  boucle [loop_start, loop_end[. Pour une zone SD la position avance sur
+ *  la ligne déroulée (boucles dépliées par le remplissage), loop_start et
+ *  loop_end sont des multiples de SAMPLER_SD_BLOCK_SAMPLES au-delà de la
+ *  tête.
+ *
+ *  Images de banque : host/gen_bank.c (make -C host bank). La QSPI se
+ *  programme par le loader externe de STM32CubeProgrammer, la SD en brut.
+ */
+
+#ifndef INC_SAMPLER_H_
+#define INC_SAMPLER_H_
+
+#include <stdint.h>
+#include "arm_math.h"
+#include "synth_format.h"
+#include "modulation.h"
+#include "synth_memory.h"
+
+// Lecteur compilé et mixé ; sans banque valide le canal reste aux voix du synthé
+#ifndef SYNTH_SAMPLER
+#define SYNTH_SAMPLER 1
+#endif
+
+#define SAMPLER_MIDI_CHANNEL        9       // canal 10
+#define SAMPLER_VOICES              8       // chacune avec son anneau SD
+#define SAMPLER_GAIN                0.5f    // crête à vélocité 127, comme OSC_AMPLITUDE
+#define SAMPLER_RELEASE_MS          30.0f   // fondu linéaire après le note off
+
+#define SAMPLER_BANK_MAGIC          0x424D5953u     // "SYMB" en petit-boutiste
+#define SAMPLER_BANK_VERSION        1u
+#define SAMPLER_QSPI_BASE           SYNTH_QSPI_BASE
+#define SAMPLER_QSPI_SIZE           SYNTH_QSPI_SIZE
+
+// Flux SD : blocs de 512 octets, anneau et lectures en blocs
+#define SAMPLER_SD_BLOCK_SAMPLES    256
+#define SAMPLER_READ_BLOCKS         8
+#define SAMPLER_RING_BLOCKS         32
+#define SAMPLER_RING_SAMPLES        (SAMPLER_RING_BLOCKS * SAMPLER_SD_BLOCK_SAMPLES)
+#define SAMPLER_STREAM_HEAD         4096    // échantillons en QSPI, multiple de SAMPLER_SD_BLOCK_SAMPLES
+#define SAMPLER_PITCH_MAX           2.0f    // pas de lecture maximal (échantillons source par échantillon rendu)
+
+// Pire durée d'une lecture de SAMPLER_READ_BLOCKS blocs (commande + transfert)
+// et pire délai de relance : une moitié ping-pong rendue d'un coup
+#ifndef SAMPLER_SD_READ_US
+#define SAMPLER_SD_READ_US          2500
+#endif
+#define SAMPLER_KICK_SAMPLES        512
+
+// Échéance d'une lecture en échantillons rendus depuis son lancement : la
+// deuxième moitié ping-pong rendue après le lancement l'est au moins une
+// période de moitié plus tard (11,6 ms), bien après SAMPLER_SD_READ_US. Une
+// fin de lecture perdue (abandon DMA du HAL sans rappel) est alors comptée
+// comme erreur, le transfert annulé et la lecture relancée.
+#define SAMPLER_READ_DEADLINE       (2 * SAMPLER_KICK_SAMPLES)
+
+#if (SAMPLER_RING_SAMPLES & (SAMPLER_RING_SAMPLES - 1))
+#error "SAMPLER_RING_BLOCKS doit être une puissance de 2"
+#endif
+#if (SAMPLER_STREAM_HEAD % SAMPLER_SD_BLOCK_SAMPLES)
+#error "SAMPLER_STREAM_HEAD doit être un multiple de SAMPLER_SD_BLOCK_SAMPLES"
+#endif
+#if (SAMPLER_READ_BLOCKS > SAMPLER_RING_BLOCKS / 2)
+#error "SAMPLER_READ_BLOCKS : au plus la moitié de l'anneau"
+#endif
+
+// Zone du répertoire (28 octets, petit-boutiste), après l'en-tête en QSPI
+#define SAMPLER_ZONE_SD             0x01    // flux SD, offset ne pointe que la tête
+#define SAMPLER_ZONE_LOOP           0x02
+
+struct sampler_zone_TypeStruct
+{
+    uint32_t offset;            // octets depuis le début de la banque (QSPI)
+    uint32_t length;            // échantillons
+    uint32_t loop_start;        // échantillons
+    uint32_t loop_end;
+    uint32_t sd_block;          // premier bloc SD de l'échantillon (SAMPLER_ZONE_SD)
+    uint32_t rate;              // Hz
+    uint8_t root;               // note jouée sans transposition
+    uint8_t note_lo;            // plage de notes de la zone
+    uint8_t note_hi;
+    uint8_t flags;
+};
+
+struct sampler_bank_TypeStruct
+{
+    uint32_t magic;
+    uint32_t version;
+    uint32_t zone_count;
+    uint32_t size;              // octets, répertoire et échantillons QSPI
+};
+
+struct sampler_stats_TypeStruct
+{
+    uint32_t reads;             // lectures SD terminées
+    uint32_t read_errors;
+    uint32_t discarded;         // lectures arrivées après le vol de leur voix
+    uint32_t underruns;         // blocs rendus sans données (voix en attente)
+    uint32_t stray;             // fins de lecture sans lecture en cours (doublon du HAL, après échéance)
+    uint32_t wait_max;          // plus longue attente d'un flux éligible, en lectures
+};
+
+struct sampler_TypeStruct
+{
+    // Banque (QSPI mappée ou image en RAM sur PC)
+    const uint8_t* bank;
+    const struct sampler_zone_TypeStruct* zones;
+    uint32_t zone_count;
+    uint8_t sd_ready;
+
+    // État par voix (SoA) ; zone NULL : voix libre
+    const struct sampler_zone_TypeStruct* zone[SAMPLER_VOICES];
+    const int16_t* data[SAMPLER_VOICES];    // échantillon entier ou tête
+    uint64_t pos[SAMPLER_VOICES];           // 32.32, ligne déroulée pour une zone SD
+    float32_t ratio[SAMPLER_VOICES];        // rate / fe x 2^((note - root) / 12)
+    float32_t gain[SAMPLER_VOICES];         // vélocité x SAMPLER_GAIN
+    float32_t level[SAMPLER_VOICES];        // gain en fin du dernier bloc
+    uint8_t note[SAMPLER_VOICES];
+    uint8_t gate[SAMPLER_VOICES];
+    uint32_t age[SAMPLER_VOICES];
+
+    // Flux SD par voix : écrits par le rendu, lus par la fin de lecture
+    int16_t* ring[SAMPLER_VOICES];
+    volatile uint32_t stream_end[SAMPLER_VOICES];   // fin des données reçues (ligne déroulée)
+    volatile uint32_t stream_read[SAMPLER_VOICES];  // premier échantillon encore utile
+    volatile float32_t stream_speed[SAMPLER_VOICES];
+    volatile uint32_t stream_gen[SAMPLER_VOICES];   // incrémenté à chaque (ré)affectation
+    volatile uint8_t stream_on[SAMPLER_VOICES];
+    uint32_t stream_wait[SAMPLER_VOICES];           // lectures servies depuis l'éligibilité
+
+    // Lecture SD en cours : req_* écrits seulement une fois la lecture acceptée
+    volatile uint8_t busy;
+    uint8_t req_voice;
+    uint32_t req_gen;
+    uint32_t req_blocks;
+    int16_t* req_dst;
+    uint32_t req_age;                   // échantillons rendus depuis le lancement
+
+    uint32_t clock;
+    float32_t release_step;             // par échantillon
+    const struct mod_TypeStruct *mod;   // MOD_DST_PITCH
+    struct sampler_stats_TypeStruct stats;
+};
+
+extern struct sampler_TypeStruct sampler;
+
+void sampler_init(struct sampler_TypeStruct* s, const struct mod_TypeStruct* mod_ref);
+// Vérifie le répertoire d'une image de banque ; nombre de zones, -1 si refusée
+int sampler_load(struct sampler_TypeStruct* s, const uint8_t* bank, uint32_t size);
+int sampler_ready(const struct sampler_TypeStruct* s);
+
+// Contexte de rendu
+void sampler_note_on(struct sampler_TypeStruct* s, uint8_t note, uint8_t velocity);
+void sampler_note_off(struct sampler_TypeStruct* s, uint8_t note);
+// Ajoute les voix actives à pDst
+void sampler_render_block(struct sampler_TypeStruct* s, synth_sample_t* pDst, uint32_t blockSize);
+// Relance la chaîne de lectures SD si elle est arrêtée, annule une lecture
+// échue ; blockSize échantillons rendus depuis l'appel précédent
+void sampler_stream_service(struct sampler_TypeStruct* s, uint32_t blockSize);
+uint32_t sampler_active_count(const struct sampler_TypeStruct* s);
+
+// Contexte interruption (fin de lecture SD) : valide les blocs, lance la lecture suivante
+void sampler_stream_complete(struct sampler_TypeStruct* s, int error);
+
+#if defined(USE_HAL_DRIVER)
+// QSPI en mode mappé et carte SD ; banque lue à SAMPLER_QSPI_BASE
+int sampler_storage_init(struct sampler_TypeStruct* s);
+#else
+// Image SD simulée : lecture immédiate, fin signalée au service suivant
+void sampler_host_set_sd(struct sampler_TypeStruct* s, const uint8_t* image, uint32_t size);
+// Pannes simulées, une lecture sur every (0 : aucune) : fin perdue, ou
+// signalée deux fois (erreur de la commande d'arrêt puis fin, comme le HAL)
+void sampler_host_set_faults(uint32_t every);
+#endif
+
+#endif /* INC_SAMPLER_H_ */
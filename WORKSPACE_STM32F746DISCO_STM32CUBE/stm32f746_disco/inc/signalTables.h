@@ -1,150 +0,0 @@
-int16_t sinus_int[1000]=
-{
-           0,         103,         206,         309,         412,         515,         618,         720,         823,         926,        1029,        1131,        1234,        1337,        1439,        1542,        1644,        1747,        1849,        1951,        2053,        2156,        2258,        2359,        2461,        2563,        2665,        2766,        2868,        2969,        3070,        3171,        3272,        3373,        3474,        3574,        3674,        3775,        3875,        3975,        4075,        4174,        4274,        4373,        4472,        4571,        4670,        4768,        4867,        4965,        5063,        5161,        5258,        5356,        5453,        5550,        5647,        5743,        5839,        5936,        6031,        6127,        6222,        6317,        6412,        6507,        6601,        6695,        6789,        6883,        6976,        7069,        7162,        7254,        7346,        7438,        7530,        7621,        7712,        7803,        7893,        7983,        8073,        8162,        8251,        8340,        8429,        8517,        8604,        8692,        8779,        8866,        8952,        9038,        9124,        9209,        9294,        9379,        9463,        9547,        9630,        9713,        9796,        9878,        9960,       10042,       10123,       10204,       10284,       10364,       10444,       10523,       10601,       10680,       10758,       10835,       10912,       10989,       11065,       11140,       11216,       11290,       11365,       11439,       11512,       11585,       11658,       11730,       11802,       11873,       11943,       12014,       12083,       12153,       12221,       12290,       12358,       12425,       12492,       12558,       12624,       12689,       12754,       12819,       12883,       12946,       13009,       13071,       13133,       13194,       13255,       13315,       13375,       13434,       13493,       13551,       13608,       13666,       13722,       13778,       13833,       13888,       13943,       13996,       14050,       14102,       14155,       14206,       14257,       14308,       14357,       14407,       14455,       14504,       14551,       14598,       14645,       14691,       14736,       14781,       14825,       14868,       14911,       14954,       14995,       15036,       15077,       15117,       15156,       15195,       15233,       15271,       15308,       15344,       15380,       15415,       15450,       15484,       15517,       15550,       15582,       15614,       15645,       15675,       15704,       15733,       15762,       15790,       15817,       15843,       15869,       15895,       15919,       15943,       15967,       15989,       16012,       16033,       16054,       16074,       16094,       16113,       16131,       16149,       16166,       16182,       16198,       16213,       16228,       16242,       16255,       16267,       16279,       16291,       16301,       16311,       16321,       16329,       16337,       16345,       16352,       16358,       16363,       16368,       16372,       16376,       16379,       16381,       16383,       16384,       16384,       16384,       16383,       16381,       16379,       16376,       16372,       16368,       16363,       16358,       16352,       16345,       16337,       16329,       16321,       16311,       16301,       16291,       16279,       16267,       16255,       16242,       16228,       16213,       16198,       16182,       16166,       16149,       16131,       16113,       16094,       16074,       16054,       16033,       16012,       15989,       15967,       15943,       15919,       15895,       15869,       15843,       15817,       15790,       15762,       15733,       15704,       15675,       15645,       15614,       15582,       15550,       15517,       15484,       15450,       15415,       15380,       15344,       15308,       15271,       15233,       15195,       15156,       15117,       15077,       15036,       14995,       14954,       14911,       14868,       14825,       14781,       14736,       14691,       14645,       14598,       14551,       14504,       14455,       14407,       14357,       14308,       14257,       14206,       14155,       14102,       14050,       13996,       13943,       13888,       13833,       13778,       13722,       13666,       13608,       13551,       13493,       13434,       13375,       13315,       13255,       13194,       13133,       13071,       13009,       12946,       12883,       12819,       12754,       12689,       12624,       12558,       12492,       12425,       12358,       12290,       12221,       12153,       12083,       12014,       11943,       11873,       11802,       11730,       11658,       11585,       11512,       11439,       11365,       11290,       11216,       11140,       11065,       10989,       10912,       10835,       10758,       10680,       10601,       10523,       10444,       10364,       10284,       10204,       10123,       10042,        9960,        9878,        9796,        9713,        9630,        9547,        9463,        9379,        9294,        9209,        9124,        9038,        8952,        8866,        8779,        8692,        8604,        8517,        8429,        8340,        8251,        8162,        8073,        7983,        7893,        7803,        7712,        7621,        7530,        7438,        7346,        7254,        7162,        7069,        6976,        6883,        6789,        6695,        6601,        6507,        6412,        6317,        6222,        6127,        6031,        5936,        5839,        5743,        5647,        5550,        5453,        5356,        5258,        5161,        5063,        4965,        4867,        4768,        4670,        4571,        4472,        4373,        4274,        4174,        4075,        3975,        3875,        3775,        3674,        3574,        3474,        3373,        3272,        3171,        3070,        2969,        2868,        2766,        2665,        2563,        2461,        2359,        2258,        2156,        2053,        1951,        1849,        1747,        1644,        1542,        1439,        1337,        1234,        1131,        1029,         926,         823,         720,         618,         515,         412,         309,         206,         103,           0,        -103,        -206,        -309,        -412,        -515,        -618,        -720,        -823,        -926,       -1029,       -1131,       -1234,       -1337,       -1439,       -1542,       -1644,       -1747,       -1849,       -1951,       -2053,       -2156,       -2258,       -2359,       -2461,       -2563,       -2665,       -2766,       -2868,       -2969,       -3070,       -3171,       -3272,       -3373,       -3474,       -3574,       -3674,       -3775,       -3875,       -3975,       -4075,       -4174,       -4274,       -4373,       -4472,       -4571,       -4670,       -4768,       -4867,       -4965,       -5063,       -5161,       -5258,       -5356,       -5453,       -5550,       -5647,       -5743,       -5839,       -5936,       -6031,       -6127,       -6222,       -6317,       -6412,       -6507,       -6601,       -6695,       -6789,       -6883,       -6976,       -7069,       -7162,       -7254,       -7346,       -7438,       -7530,       -7621,       -7712,       -7803,       -7893,       -7983,       -8073,       -8162,       -8251,       -8340,       -8429,       -8517,       -8604,       -8692,       -8779,       -8866,       -8952,       -9038,       -9124,       -9209,       -9294,       -9379,       -9463,       -9547,       -9630,       -9713,       -9796,       -9878,       -9960,      -10042,      -10123,      -10204,      -10284,      -10364,      -10444,      -10523,      -10601,      -10680,      -10758,      -10835,      -10912,      -10989,      -11065,      -11140,      -11216,      -11290,      -11365,      -11439,      -11512,      -11585,      -11658,      -11730,      -11802,      -11873,      -11943,      -12014,      -12083,      -12153,      -12221,      -12290,      -12358,      -12425,      -12492,      -12558,      -12624,      -12689,      -12754,      -12819,      -12883,      -12946,      -13009,      -13071,      -13133,      -13194,      -13255,      -13315,      -13375,      -13434,      -13493,      -13551,      -13608,      -13666,      -13722,      -13778,      -13833,      -13888,      -13943,      -13996,      -14050,      -14102,      -14155,      -14206,      -14257,      -14308,      -14357,      -14407,      -14455,      -14504,      -14551,      -14598,      -14645,      -14691,      -14736,      -14781,      -14825,      -14868,      -14911,      -14954,      -14995,      -15036,      -15077,      -15117,      -15156,      -15195,      -15233,      -15271,      -15308,      -15344,      -15380,      -15415,      -15450,      -15484,      -15517,      -15550,      -15582,      -15614,      -15645,      -15675,      -15704,      -15733,      -15762,      -15790,      -15817,      -15843,      -15869,      -15895,      -15919,      -15943,      -15967,      -15989,      -16012,      -16033,      -16054,      -16074,      -16094,      -16113,      -16131,      -16149,      -16166,      -16182,      -16198,      -16213,      -16228,      -16242,      -16255,      -16267,      -16279,      -16291,      -16301,      -16311,      -16321,      -16329,      -16337,      -16345,      -16352,      -16358,      -16363,      -16368,      -16372,      -16376,      -16379,      -16381,      -16383,      -16384,      -16384,      -16384,      -16383,      -16381,      -16379,      -16376,      -16372,      -16368,      -16363,      -16358,      -16352,      -16345,      -16337,      -16329,      -16321,      -16311,      -16301,      -16291,      -16279,      -16267,      -16255,      -16242,      -16228,      -16213,      -16198,      -16182,      -16166,      -16149,      -16131,      -16113,      -16094,      -16074,      -16054,      -16033,      -16012,      -15989,      -15967,      -15943,      -15919,      -15895,      -15869,      -15843,      -15817,      -15790,      -15762,      -15733,      -15704,      -15675,      -15645,      -15614,      -15582,      -15550,      -15517,      -15484,      -15450,      -15415,      -15380,      -15344,      -15308,      -15271,      -15233,      -15195,      -15156,      -15117,      -15077,      -15036,      -14995,      -14954,      -14911,      -14868,      -14825,      -14781,      -14736,      -14691,      -14645,      -14598,      -14551,      -14504,      -14455,      -14407,      -14357,      -14308,      -14257,      -14206,      -14155,      -14102,      -14050,      -13996,      -13943,      -13888,      -13833,      -13778,      -13722,      -13666,      -13608,      -13551,      -13493,      -13434,      -13375,      -13315,      -13255,      -13194,      -13133,      -13071,      -13009,      -12946,      -12883,      -12819,      -12754,      -12689,      -12624,      -12558,      -12492,      -12425,      -12358,      -12290,      -12221,      -12153,      -12083,      -12014,      -11943,      -11873,      -11802,      -11730,      -11658,      -11585,      -11512,      -11439,      -11365,      -11290,      -11216,      -11140,      -11065,      -10989,      -10912,      -10835,      -10758,      -10680,      -10601,      -10523,      -10444,      -10364,      -10284,      -10204,      -10123,      -10042,       -9960,       -9878,       -9796,       -9713,       -9630,       -9547,       -9463,       -9379,       -9294,       -9209,       -9124,       -9038,       -8952,       -8866,       -8779,       -8692,       -8604,       -8517,       -8429,       -8340,       -8251,       -8162,       -8073,       -7983,       -7893,       -7803,       -7712,       -7621,       -7530,       -7438,       -7346,       -7254,       -7162,       -7069,       -6976,       -6883,       -6789,       -6695,       -6601,       -6507,       -6412,       -6317,       -6222,       -6127,       -6031,       -5936,       -5839,       -5743,       -5647,       -5550,       -5453,       -5356,       -5258,       -5161,       -5063,       -4965,       -4867,       -4768,       -4670,       -4571,       -4472,       -4373,       -4274,       -4174,       -4075,       -3975,       -3875,       -3775,       -3674,       -3574,       -3474,       -3373,       -3272,       -3171,       -3070,       -2969,       -2868,       -2766,       -2665,       -2563,       -2461,       -2359,       -2258,       -2156,       -2053,       -1951,       -1849,       -1747,       -1644,       -1542,       -1439,       -1337,       -1234,       -1131,       -1029,        -926,        -823,        -720,        -618,        -515,        -412,        -309,        -206,        -103
-};
-
-float32_t carre_f32[20]=
-{
-1.000000,
-1.000000,
-1.000000,
-1.000000,
-1.000000,
-1.000000,
-1.000000,
-1.000000,
-1.000000,
-1.000000,
--1.000000,
--1.000000,
--1.000000,
--1.000000,
--1.000000,
--1.000000,
--1.000000,
--1.000000,
--1.000000,
-1.000000,
-};
-
-int16_t carre_int[20]=
-{
-16384.000000,
-16384.000000,
-16384.000000,
-16384.000000,
-16384.000000,
-16384.000000,
-16384.000000,
-16384.000000,
-16384.000000,
-16384.000000,
--16384.000000,
--16384.000000,
--16384.000000,
--16384.000000,
--16384.000000,
--16384.000000,
--16384.000000,
--16384.000000,
--16384.000000,
-16384.000000,
-};
-
-
-float32_t triangle_f32[20]=
-{
--1.000000,
--0.789474,
--0.578947,
--0.368421,
--0.157895,
-0.052632,
-0.263158,
-0.473684,
-0.684211,
-0.894737,
-0.894737,
-0.684211,
-0.473684,
-0.263158,
-0.052632,
--0.157895,
--0.368421,
--0.578947,
--0.789474,
--1.000000,
-};
-
-int16_t triangle_int[20]=
-{
--16384.000000,
--12935.000000,
--9485.000000,
--6036.000000,
--2587.000000,
-862.000000,
-4312.000000,
-7761.000000,
-11210.000000,
-14659.000000,
-14659.000000,
-11210.000000,
-7761.000000,
-4312.000000,
-862.000000,
--2587.000000,
--6036.000000,
--9485.000000,
--12935.000000,
--16384.000000,
-};
-
-
-float32_t sawtooth_f32[20]=
-{
--1.000000,
--0.894737,
--0.789474,
--0.684211,
--0.578947,
--0.473684,
--0.368421,
--0.263158,
--0.157895,
--0.052632,
-0.052632,
-0.157895,
-0.263158,
-0.368421,
-0.473684,
-0.578947,
-0.684211,
-0.789474,
-0.894737,
--1.000000,
-};
-
-int16_t sawtooth_int[20]=
-{
--16384,
--14659,
--12935,
--11210,
--9485,
--7761,
--6036,
--4312,
--2587,
--862,
-862,
-2587,
-4312,
-6036,
-7761,
-9485,
-11210,
-12935,
-14659,
--16384,
-};
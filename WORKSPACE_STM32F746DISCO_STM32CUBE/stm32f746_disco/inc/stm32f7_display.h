@@ -13,6 +13,8 @@
 //#include "arm_const_structs.h"
 
 #include "armlogo.h"
+#include "synth_profile.h"
+#include "synth_telemetry.h"
 
 /* Macros --------------------------------------------------------------------*/
 #ifdef USE_FULL_ASSERT
@@ -107,5 +109,7 @@ void changeButtonFlag(int value);
 void proceed_statement(void);
 
 uint8_t CheckForUserInput(void);
+void displayProfile(const char *const names[], const synth_profile_stat_t *stats, int num_stages, uint32_t budget, uint32_t dropped);
+void displayTelemetry(const struct synth_telemetry_record_TypeStruct *rec);
 
 /************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -87,11 +87,14 @@
 
 // this is the size of each ping pong buffer - PING_IN, PING_OUT, PONG_IN and PONG_OUT in sample instants
 // there are two samples (left and right) per sample instant
+#ifndef PING_PONG_BUFFER_SIZE
 #define PING_PONG_BUFFER_SIZE ((uint32_t)512)
+#endif
 
-// buffers are placed in SDRAM - AUDIO_REC_START_ADDR is defined in stm32f7_wm8994_init.h
-// this is the start address of the PING_IN buffer
-#define PING_IN AUDIO_REC_START_ADDR
+// buffers are placed in non cacheable SRAM (section .dma_buffer, see synth_memory.h)
+// PING_IN, PING_OUT, PONG_IN and PONG_OUT follow each other in audio_dma_buffer
+extern int16_t audio_dma_buffer[4 * 2 * PING_PONG_BUFFER_SIZE];
+#define PING_IN ((uint32_t)audio_dma_buffer)
 
 // length of each ping pong buffer in bytes is number of sample instants (PING_PONG_BUFFER_SIZE)
 // multiplied by bytes per 16-bit sample (2) multiplied by samples per sample instant (L+R => 2) 
@@ -101,9 +104,9 @@
 // on the other hand, perhaps all of these 'global' scope variables and #defines might be moved to
 // stm32f7_wm8994_init.h
 
-#define PING_OUT (AUDIO_REC_START_ADDR + (PING_PONG_BUFFER_SIZE * 4))
-#define PONG_IN (AUDIO_REC_START_ADDR + (PING_PONG_BUFFER_SIZE * 8))
-#define PONG_OUT (AUDIO_REC_START_ADDR + (PING_PONG_BUFFER_SIZE * 12))
+#define PING_OUT (PING_IN + (PING_PONG_BUFFER_SIZE * 4))
+#define PONG_IN (PING_IN + (PING_PONG_BUFFER_SIZE * 8))
+#define PONG_OUT (PING_IN + (PING_PONG_BUFFER_SIZE * 12))
 
 // this code provided by ST - do we need it? should we place it in another, copyright-headed file?
 /* Macros --------------------------------------------------------------------*/
@@ -67,6 +67,8 @@ void DMA2_Stream1_IRQHandler(void);
 void DCMI_IRQHandler(void);
 void AUDIO_IN_SAIx_DMAx_IRQHandler(void);
 void BSP_SDRAM_DMA_IRQHandler(void);
+void BSP_SDMMC_IRQHandler(void);
+void BSP_SDMMC_DMA_Rx_IRQHandler(void);
 void DMA2D_IRQHandler(void);
 void BSP_LCD_DMA2D_IRQHandler(void);
 #ifdef __cplusplus
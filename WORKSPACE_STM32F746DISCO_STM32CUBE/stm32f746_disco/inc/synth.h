@@ -0,0 +1,59 @@
+/*
+ * synth.h
+ *
+ *  Moteur du synthétiseur : VOICE_COUNT voix (oscillateur -> FIR -> ADSR) -> reverb,
+ *  rendu par blocs (chemin DMA ping-pong).
+ */
+
+#ifndef INC_SYNTH_H_
+#define INC_SYNTH_H_
+
+#include <stdint.h>
+#include "arm_math.h"
+#include "adsr.h"
+#include "reverb.h"
+#include "conv_reverb.h"
+#include "synth_format.h"
+
+#define SYNTH_SAMPLE_RATE 44100.0f
+
+// Nombre d'échantillons rendus par appel de chaque étage.
+// Doit diviser PING_PONG_BUFFER_SIZE (taille d'une moitié DMA).
+#ifndef AUDIO_BLOCK_SIZE
+#define AUDIO_BLOCK_SIZE 64
+#endif
+
+// Reverb commune : FDN 8 lignes (reverb.c) ou convolution par RI (conv_reverb.c, flottant)
+#define SYNTH_REVERB_FDN  0
+#define SYNTH_REVERB_CONV 1
+#ifndef SYNTH_REVERB
+#define SYNTH_REVERB SYNTH_REVERB_FDN
+#endif
+
+#if (SYNTH_REVERB == SYNTH_REVERB_CONV) && (SYNTH_FORMAT == SYNTH_FORMAT_Q15)
+#error "SYNTH_REVERB_CONV : chaîne flottante uniquement"
+#endif
+
+// Temps de décroissance de la RI synthétique chargée au démarrage
+#ifndef SYNTH_CONV_RT60
+#define SYNTH_CONV_RT60 0.7f
+#endif
+
+// Paramètres d'enveloppe partagés par les voix (CC2-4)
+extern struct adsr_TypeStruct adsr_envelope;
+
+void synth_init(void);
+// Horloge d'échantillons : position du prochain échantillon rendu
+uint32_t synth_sample_clock(void);
+// Producteur (USB) : met en file un message à appliquer à l'échantillon sample
+int synth_midi_post(uint8_t status, uint8_t data1, uint8_t data2, uint32_t sample);
+// Horodatage d'un message reçu elapsed échantillons après l'échange qui a
+// lancé le rendu de la moitié half_clock : même position dans la moitié
+// suivante, pas encore rendue (latence constante d'une moitié)
+uint32_t synth_midi_stamp(uint32_t half_clock, uint32_t half_size, uint32_t elapsed);
+uint32_t synth_midi_dropped(void);
+// Consommateur (rendu) : application immédiate
+void synth_midi_message(uint8_t status, uint8_t data1, uint8_t data2);
+void synth_render_block(synth_sample_t *pDstL, synth_sample_t *pDstR, uint32_t blockSize);
+
+#endif /* INC_SYNTH_H_ */
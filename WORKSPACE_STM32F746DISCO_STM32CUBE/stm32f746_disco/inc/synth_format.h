@@ -0,0 +1,29 @@
+/*
+ * synth_format.h
+ *
+ *  Format des échantillons de la chaîne audio, choisi à la compilation.
+ *  SYNTH_FORMAT_F32 : flottant simple précision (FPU du Cortex-M7).
+ *  SYNTH_FORMAT_Q15 : virgule fixe 1.15 de l'oscillateur à la sortie, noyaux
+ *                     CMSIS q15 à double MAC (__SMLAD / __SMLALD). La phase,
+ *                     l'enveloppe et les accumulateurs restent sur 32 bits.
+ */
+
+#ifndef INC_SYNTH_FORMAT_H_
+#define INC_SYNTH_FORMAT_H_
+
+#include "arm_math.h"
+
+#define SYNTH_FORMAT_F32 0
+#define SYNTH_FORMAT_Q15 1
+
+#ifndef SYNTH_FORMAT
+#define SYNTH_FORMAT SYNTH_FORMAT_F32
+#endif
+
+#if (SYNTH_FORMAT == SYNTH_FORMAT_Q15)
+typedef q15_t synth_sample_t;
+#else
+typedef float32_t synth_sample_t;
+#endif
+
+#endif /* INC_SYNTH_FORMAT_H_ */
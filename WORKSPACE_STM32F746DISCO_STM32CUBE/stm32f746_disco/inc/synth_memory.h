@@ -0,0 +1,70 @@
+/*
+ * synth_memory.h
+ *
+ *  Placement mémoire des données audio (voir LinkerScript.ld et MPU_Config()).
+ *
+ *  SYNTH_DTCM    : DTCM 64 Ko (0x20000000), 0 wait state, hors cache.
+ *                  État chaud du rendu : voix, états FIR/biquad, blocs de travail.
+ *  SYNTH_DMA_NC  : SRAM2 non cacheable (0x20048000, 32 Ko, région MPU 1).
+ *                  Moitiés ping-pong du DMA audio : pas de donnée périmée possible.
+ *  SYNTH_SDRAM   : SDRAM externe cacheable write-back (0xC0600000, 2 Mo, région MPU 2).
+ *                  Grandes lignes à retard, lues et écrites par le CPU seulement.
+ *                  Anneaux de flux SD du sampler (DMA SDMMC, invalidés à la réception).
+ *  QSPI          : flash QSPI mappée en mémoire (0x90000000, 16 Mo, région MPU 4),
+ *                  cacheable write-through, lecture seule : banque du sampler.
+ *  Sans attribut : SRAM1 cacheable write-through.
+ *  const         : flash (.rodata), tables générées de synth_tables.h.
+ *
+ *  Les sections DTCM et SDRAM sont NOLOAD : la DTCM est mise à zéro par le
+ *  startup, la SDRAM n'existe qu'après BSP_SDRAM_Init() et doit être
+ *  initialisée par son propriétaire.
+ *
+ *  Sur PC les attributs ne génèrent rien.
+ */
+
+#ifndef INC_SYNTH_MEMORY_H_
+#define INC_SYNTH_MEMORY_H_
+
+#include <stdint.h>
+
+#if defined(USE_HAL_DRIVER)
+#define SYNTH_DTCM      __attribute__((section(".dtcm")))
+#define SYNTH_DMA_NC    __attribute__((section(".dma_buffer"), aligned(32)))
+#define SYNTH_SDRAM     __attribute__((section(".sdram"), aligned(32)))
+#else
+#define SYNTH_DTCM
+#define SYNTH_DMA_NC
+#define SYNTH_SDRAM
+#endif
+
+// Régions vues par le cœur (attributs résultant de MPU_Config())
+typedef enum {
+    MEM_DTCM = 0,       // hors cache
+    MEM_SRAM,           // cacheable write-through
+    MEM_SRAM_NC,        // non cacheable
+    MEM_SDRAM,          // cacheable write-back
+    MEM_SDRAM_DEVICE,   // SDRAM hors région MPU : mémoire device, non cacheable
+    MEM_QSPI,           // cacheable write-through, lecture seule
+    MEM_OTHER
+} synth_mem_region_t;
+
+#define SYNTH_DTCM_BASE         0x20000000u
+#define SYNTH_DTCM_SIZE         0x00010000u
+#define SYNTH_SRAM_BASE         0x20010000u
+#define SYNTH_SRAM_NC_BASE      0x20048000u
+#define SYNTH_SRAM_NC_SIZE      0x00008000u
+#define SYNTH_SDRAM_BASE        0xC0000000u
+#define SYNTH_SDRAM_SIZE        0x00800000u
+#define SYNTH_SDRAM_AUDIO_BASE  0xC0600000u
+#define SYNTH_SDRAM_AUDIO_SIZE  0x00200000u
+#define SYNTH_QSPI_BASE         0x90000000u
+#define SYNTH_QSPI_SIZE         0x01000000u
+
+synth_mem_region_t synth_mem_region(const void* addr);
+// Cohérence DMA : sans effet sur une région non cacheable
+void synth_dma_clean(const void* addr, uint32_t len);
+void synth_dma_invalidate(void* addr, uint32_t len);
+// Coût en cycles d'un FIR et d'une ligne à retard dans chaque région (SYNTH_PROFILE_DWT)
+void synth_memory_bench(void);
+
+#endif /* INC_SYNTH_MEMORY_H_ */
@@ -0,0 +1,22 @@
+/*
+ * synth_opt.h
+ *
+ *  Optimisation des modules DSP sur la cible, indépendante de la configuration
+ *  du projet. La configuration Debug reste en -O0 -g3 pour suivre pas à pas
+ *  HAL, BSP et USB ; les modules DSP incluent ce fichier en premier et sont
+ *  compilés en -O3 -ffast-math, comme la variante fast de host/ validée par
+ *  make golden. CMSIS-DSP est en -O3 par l'option du dossier CMSIS/DSP/Source
+ *  (.cproject).
+ *
+ *  -DSYNTH_DSP_DEBUG : modules DSP en -O0 eux aussi, pour les suivre pas à pas.
+ *  Sur PC, l'optimisation est celle du Makefile (OPT, variantes de make golden).
+ */
+
+#ifndef INC_SYNTH_OPT_H_
+#define INC_SYNTH_OPT_H_
+
+#if defined(USE_HAL_DRIVER) && defined(__GNUC__) && !defined(SYNTH_DSP_DEBUG)
+#pragma GCC optimize ("O3", "fast-math")
+#endif
+
+#endif /* INC_SYNTH_OPT_H_ */
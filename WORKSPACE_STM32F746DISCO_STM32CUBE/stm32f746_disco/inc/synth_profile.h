@@ -0,0 +1,112 @@
+/*
+ * synth_profile.h
+ *
+ *  Points de mesure par étage du moteur de synthèse.
+ *  Sans définition de plateforme, les macros ne génèrent aucun code.
+ *  SYNTH_PROFILE_DWT  : cycles CPU (DWT->CYCCNT) sur la cible.
+ *  SYNTH_PROFILE_HOST : nanosecondes sur PC (voir host/synth_host.c).
+ *
+ *  Chaque mesure est poussée dans un anneau sans verrou (un producteur :
+ *  le rendu, un consommateur : synth_profile_poll() dans la boucle
+ *  principale) puis agrégée en min/moy/max par étage.
+ */
+
+#ifndef INC_SYNTH_PROFILE_H_
+#define INC_SYNTH_PROFILE_H_
+
+#include <stdint.h>
+
+typedef enum {
+    PROF_OSC = 0,
+    PROF_FILTER,
+    PROF_ADSR,
+    PROF_SAMPLER,
+    PROF_REVERB,
+    PROF_MOD,
+    PROF_MIDI,
+    PROF_USB,
+    PROF_STAGE_COUNT
+} synth_stage_t;
+
+// Statistiques d'un étage depuis le dernier synth_profile_reset()
+typedef struct {
+    uint32_t count;         // nombre de mesures
+    uint32_t min;           // ticks (cycles ou ns) par mesure
+    uint32_t max;
+    uint64_t sum;
+    uint64_t samples;       // échantillons audio couverts par les mesures
+} synth_profile_stat_t;
+
+#define PROF_RING_SIZE 128  // puissance de 2
+
+extern const char *const synth_profile_names[PROF_STAGE_COUNT];
+
+void synth_profile_init(void);
+void synth_profile_record(synth_stage_t stage, uint32_t ticks, uint32_t nb_samples);
+void synth_profile_poll(void);
+void synth_profile_reset(void);
+const synth_profile_stat_t* synth_profile_stats(void);
+uint32_t synth_profile_dropped(void);
+int synth_profile_format(char *buf, int len);
+void synth_profile_dump(void);
+
+#if defined(SYNTH_PROFILE_DWT)
+
+#include "stm32f7xx.h"
+#define SYNTH_PROFILE_NOW()     (DWT->CYCCNT)
+#define SYNTH_PROFILE_UNIT      "cycles"
+
+#elif defined(SYNTH_PROFILE_HOST)
+
+uint32_t synth_profile_now(void);
+#define SYNTH_PROFILE_NOW()     synth_profile_now()
+#define SYNTH_PROFILE_UNIT      "ns"
+
+#endif
+
+#if defined(SYNTH_PROFILE_DWT) || defined(SYNTH_PROFILE_HOST)
+
+#define SYNTH_PROFILE_ENABLED
+
+// Mesure d'une portion de code délimitée
+#define SYNTH_PROFILE_BEGIN(stage)      uint32_t prof_t0_##stage = SYNTH_PROFILE_NOW()
+#define SYNTH_PROFILE_END(stage, n)     synth_profile_record(stage, SYNTH_PROFILE_NOW() - prof_t0_##stage, n)
+
+// Mesure d'un appel, dans le style de JTEST_COUNT_CYCLES
+#define SYNTH_PROFILE_COUNT(stage, n, fn_call)                  \
+    do                                                          \
+    {                                                           \
+        uint32_t __prof_start = SYNTH_PROFILE_NOW();            \
+                                                                \
+        fn_call;                                                \
+                                                                \
+        synth_profile_record(stage,                             \
+                             SYNTH_PROFILE_NOW() - __prof_start,\
+                             n);                                \
+    } while (0)
+
+// Cumul de plusieurs appels (une mesure par voix) enregistré une fois par bloc
+#define SYNTH_PROFILE_DECLARE(acc)      uint32_t acc = 0
+#define SYNTH_PROFILE_ACC(acc, fn_call)                         \
+    do                                                          \
+    {                                                           \
+        uint32_t __prof_start = SYNTH_PROFILE_NOW();            \
+                                                                \
+        fn_call;                                                \
+                                                                \
+        acc += SYNTH_PROFILE_NOW() - __prof_start;              \
+    } while (0)
+#define SYNTH_PROFILE_RECORD(stage, acc, n)     synth_profile_record(stage, acc, n)
+
+#else
+
+#define SYNTH_PROFILE_BEGIN(stage)
+#define SYNTH_PROFILE_END(stage, n)
+#define SYNTH_PROFILE_COUNT(stage, n, fn_call)  do { fn_call; } while (0)
+#define SYNTH_PROFILE_DECLARE(acc)
+#define SYNTH_PROFILE_ACC(acc, fn_call)         do { fn_call; } while (0)
+#define SYNTH_PROFILE_RECORD(stage, acc, n)
+
+#endif
+
+#endif /* INC_SYNTH_PROFILE_H_ */
@@ -0,0 +1,46 @@
+/*
+ * synth_tables.h
+ *
+ *  Généré par host/gen_tables.c (make -C host tables), ne pas modifier.
+ *  Tables constantes en flash (.rodata), une seule copie pour tout le
+ *  programme ; tailles fixées à la génération.
+ */
+
+#ifndef INC_SYNTH_TABLES_H_
+#define INC_SYNTH_TABLES_H_
+
+#include <stdint.h>
+
+#define SYNTH_TABLES_FE             44100      // fréquence d'échantillonnage des incréments et des FIR
+
+#define SYNTH_SINE_TABLE_BITS       10
+#define SYNTH_SINE_TABLE_SIZE       1024
+#define SYNTH_SINE_TABLE_PEAK       16384
+
+#define SYNTH_NOTE_COUNT            128
+
+#define SYNTH_FIR_BANK_TAPS         64
+#define SYNTH_FIR_BANK_SIZE         64
+#define SYNTH_FIR_BANK_FMIN         20.0f
+#define SYNTH_FIR_BANK_FMAX         4000.0f
+#define SYNTH_FIR_BANK_LOG_FMIN     2.99573227f
+#define SYNTH_FIR_BANK_INV_LOG_STEP 11.8905674f
+
+#define SYNTH_FIR_LOWPASS_TAPS      64
+#define SYNTH_FIR_LOWPASS_FC        4500.0f
+
+// Lignes de la banque FIR alignées sur les lignes de cache
+#define SYNTH_TABLE_ALIGN           __attribute__((aligned(32)))
+
+// Une période, crête SYNTH_SINE_TABLE_PEAK ; [SIZE] = [0]
+extern const int16_t synth_sine_table[SYNTH_SINE_TABLE_SIZE + 1];
+// Fréquence (Hz) et incrément de phase 32 bits à SYNTH_TABLES_FE de chaque note MIDI
+extern const float synth_note_freq[SYNTH_NOTE_COUNT];
+extern const uint32_t synth_note_increment[SYNTH_NOTE_COUNT];
+// Passe-bas à fenêtre de Hamming, coupure FMIN * exp(i * log(FMAX / FMIN) / (SIZE - 1))
+extern const float synth_fir_bank[SYNTH_FIR_BANK_SIZE][SYNTH_FIR_BANK_TAPS];
+// Passe-bas fixe à SYNTH_FIR_LOWPASS_FC
+extern const float synth_fir_lowpass_f32[SYNTH_FIR_LOWPASS_TAPS];
+extern const int16_t synth_fir_lowpass_q15[SYNTH_FIR_LOWPASS_TAPS];
+
+#endif /* INC_SYNTH_TABLES_H_ */
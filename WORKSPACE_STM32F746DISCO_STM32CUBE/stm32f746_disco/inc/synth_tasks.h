@@ -0,0 +1,74 @@
+/*
+ * synth_tasks.h
+ *
+ *  Découpage FreeRTOS (build avec -DSYNTH_RTOS, noyau dans Middlewares) :
+ *
+ *    tâche       priorité  réveil
+ *    audio          5      notification des callbacks DMA TX (moitié libre)
+ *    contrôle       4      file des paquets MIDI reçus
+ *    USB hôte       3      notification des callbacks HCD, ou 1 tick
+ *    affichage      1      période SYNTH_TASK_DISPLAY_MS
+ *
+ *  Piles et file statiques (aucun tas), débordement vérifié par le noyau
+ *  (configCHECK_FOR_STACK_OVERFLOW 2). Les temps d'exécution par tâche sont
+ *  comptés par le DWT (cycles / 1024) et envoyés avec le dump du profil.
+ *
+ *  Sans SYNTH_RTOS, main() garde la boucle de scrutation.
+ */
+
+#ifndef INC_SYNTH_TASKS_H_
+#define INC_SYNTH_TASKS_H_
+
+#include <stdint.h>
+
+#define SYNTH_TASK_PRIO_AUDIO       5
+#define SYNTH_TASK_PRIO_CONTROL     4
+#define SYNTH_TASK_PRIO_USB         3
+#define SYNTH_TASK_PRIO_DISPLAY     1
+
+// Piles en mots de 32 bits
+#define SYNTH_TASK_STACK_AUDIO      1024
+#define SYNTH_TASK_STACK_CONTROL    256
+#define SYNTH_TASK_STACK_USB        512
+#define SYNTH_TASK_STACK_DISPLAY    512
+
+#define SYNTH_TASK_MIDI_QUEUE       64      // paquets USB-MIDI en attente
+#define SYNTH_TASK_DISPLAY_MS       50      // scrutation du bouton, LCD toutes les 500 ms
+
+#define SYNTH_TASK_COUNT            5       // avec la tâche idle
+
+struct synth_task_stat_TypeStruct
+{
+    const char* name;
+    uint32_t priority;
+    uint32_t cpu_permille;      // part du temps depuis le démarrage
+    uint32_t stack_used;        // mots, plus haut niveau atteint
+    uint32_t stack_size;        // mots
+};
+
+// Fournies par main.c
+extern void process_buffer(void);
+extern void midiApplication(void);
+extern void profile_service(void);
+extern void midi_post_packet(const uint8_t* packet, uint32_t tick);
+
+// Crée les tâches, repositionne les priorités d'IRQ et lance l'ordonnanceur (ne revient pas)
+void synth_tasks_start(void);
+
+// Contexte interruption : DMA TX audio, HCD (connexion, URB)
+void synth_tasks_audio_isr(void);
+void synth_tasks_usb_isr(void);
+// Contexte tâche USB : paquets de 4 octets reçus au tick HAL donné ; un paquet
+// qui ne tient pas dans la file est perdu (compté)
+void synth_tasks_midi_rx(const uint8_t* packets, uint32_t numPackets, uint32_t tick);
+
+uint32_t synth_tasks_stats(struct synth_task_stat_TypeStruct* stats, uint32_t count);
+int synth_tasks_format(char* buf, int len);
+// Dump CSV sur l'ITM, à la suite de synth_profile_dump()
+void synth_tasks_dump(void);
+
+// Compteur de temps d'exécution (configGENERATE_RUN_TIME_STATS)
+void synth_tasks_runtime_init(void);
+uint32_t synth_tasks_runtime_counter(void);
+
+#endif /* INC_SYNTH_TASKS_H_ */
@@ -0,0 +1,68 @@
+/*
+ * synth_telemetry.h
+ *
+ *  Santé du flux audio, toujours active (quelques cycles par moitié) :
+ *  moitiés libérées par le DMA TX, moitiés rendues, rendus en retard,
+ *  erreurs SAI, débordements de la file MIDI et charge CPU du rendu.
+ *
+ *  Un rendu est en retard quand le DMA a encore échangé les moitiés avant
+ *  sa fin : la moitié en cours d'écriture est déjà lue par le codec. Le
+ *  retard est mesuré depuis cet échange (plus une moitié par échange
+ *  supplémentaire). dma_halves - blocks = moitiés jamais rendues.
+ *
+ *  Unité de temps : cycles CPU (DWT->CYCCNT) sur la cible, ns sur PC.
+ */
+
+#ifndef INC_SYNTH_TELEMETRY_H_
+#define INC_SYNTH_TELEMETRY_H_
+
+#include <stdint.h>
+
+#define TELEMETRY_MAGIC         0x4C545953u     // "SYTL" en petit-boutiste
+#define TELEMETRY_PERIOD_MS     500             // envoi de l'enregistrement
+#define TELEMETRY_ITM_PORT      1               // port 0 : texte (dumps CSV)
+
+// Enregistrement binaire, petit-boutiste, 48 octets sans remplissage.
+// checksum : somme des 46 octets précédents modulo 2^16
+struct synth_telemetry_record_TypeStruct
+{
+    uint32_t magic;
+    uint32_t tick;              // ms depuis le démarrage
+    uint32_t budget;            // durée d'une moitié (cycles)
+    uint32_t dma_halves;        // callbacks DMA TX
+    uint32_t blocks;            // moitiés rendues
+    uint32_t late;
+    uint32_t late_max;          // pire retard (cycles)
+    uint32_t sai_errors;
+    uint32_t midi_overflows;    // file du synthé, et file USB sous SYNTH_RTOS
+    uint16_t load_last;         // rendu / budget, pour mille
+    uint16_t load_avg;
+    uint16_t load_max;
+    uint8_t voices;             // voix actives à la fin du dernier rendu
+    uint8_t voices_max;
+    uint16_t reserved;
+    uint16_t checksum;
+};
+
+#if defined(USE_HAL_DRIVER)
+#include "stm32f7xx.h"
+#define SYNTH_TELEMETRY_NOW()   (DWT->CYCCNT)
+#endif
+
+// budget : durée d'une moitié rendue ; active le compteur de cycles sur la cible
+void synth_telemetry_init(uint32_t budget);
+// Remet compteurs et maxima à zéro (bouton utilisateur)
+void synth_telemetry_reset(void);
+
+// Contexte interruption
+void synth_telemetry_dma_half(uint32_t now);
+void synth_telemetry_sai_error(void);
+void synth_telemetry_midi_overflow(void);
+
+// Contexte de rendu, autour de chaque moitié
+void synth_telemetry_render_begin(uint32_t now);
+void synth_telemetry_render_end(uint32_t now, uint32_t voices);
+
+void synth_telemetry_snapshot(struct synth_telemetry_record_TypeStruct* rec, uint32_t tick);
+
+#endif /* INC_SYNTH_TELEMETRY_H_ */
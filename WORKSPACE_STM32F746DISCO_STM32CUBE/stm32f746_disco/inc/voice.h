@@ -0,0 +1,147 @@
+/*
+ * voice.h
+ *
+ *  Pool de voix polyphonique pré-alloué.
+ *  Chaque voix possède son accumulateur de phase 32 bits (oscillator.c),
+ *  son enveloppe ADSR, sa vélocité et ses destinations de modulation
+ *  (coupure, gain : modulation.c), l'historique de ses demi-bandes de décimation
+ *  (oversample.c) et son état de filtre. L'état est rangé en tableaux indexés par voix
+ *  (SoA) pour que la boucle de rendu parcoure des données contiguës.
+ *
+ *  Allocation sans malloc : pile des voix libres + liste compacte des voix
+ *  actives, ajout et retrait en O(1).
+ */
+
+#ifndef INC_VOICE_H_
+#define INC_VOICE_H_
+
+#include <stdint.h>
+#include "arm_math.h"
+#include "adsr.h"
+#include "FIR_bank.h"
+#include "IIR_filter.h"
+#include "IIR.h"
+#include "oscillator.h"
+#include "oversample.h"
+#include "modulation.h"
+#include "synth_format.h"
+#include "synth.h"
+
+// Nombre de voix simultanées
+#ifndef VOICE_COUNT
+#define VOICE_COUNT 16
+#endif
+
+// Filtre de chaque voix après la décimation : FIR 64 coefficients (banque),
+// passe-bas biquad résonant, SVF résonant (IIR.h, coupure en rampe par
+// échantillon, par défaut : routes CC7 coupure et CC71 résonance), ou aucun
+// (CC7/CC71 sans effet). Le repliement est traité par le suréchantillonnage
+// (OVERSAMPLE_FACTOR, oversample.h) : le filtre n'est plus un anti-repliement.
+#define VOICE_FILTER_FIR    0
+#define VOICE_FILTER_BIQUAD 1
+#define VOICE_FILTER_NONE   2
+#define VOICE_FILTER_SVF    3
+#ifndef VOICE_FILTER
+#define VOICE_FILTER VOICE_FILTER_SVF
+#endif
+
+// Ordre du FIR anti-repliement de chaque voix
+#define VOICE_FIR_TAPS FIR_BANK_TAPS
+
+// Ordre du passe-bas biquad (VOICE_FILTER_BIQUAD)
+#define VOICE_BIQUAD_ORDER 2
+
+// Sortie du SVF (VOICE_FILTER_SVF) : SVF_LOWPASS, SVF_BANDPASS, SVF_HIGHPASS, SVF_NOTCH
+#ifndef VOICE_SVF_MODE
+#define VOICE_SVF_MODE SVF_LOWPASS
+#endif
+
+// Forme d'onde au démarrage (CC70 pour la changer)
+#ifndef VOICE_WAVE_DEFAULT
+#define VOICE_WAVE_DEFAULT OSC_SQUARE
+#endif
+
+// Politique de vol appliquée quand toutes les voix sont occupées
+#ifndef VOICE_STEAL_DEFAULT
+#define VOICE_STEAL_DEFAULT VOICE_STEAL_OLDEST
+#endif
+
+// Gain de mixage : marge pour la somme des voix avant conversion 16 bits
+#define VOICE_MIX_GAIN 0.5f
+// Q15 : gain de mixage x gain de la voix (MOD_DST_AMP, <= 1)
+#define VOICE_MIX_GAIN_Q15(gain) ((q15_t)(VOICE_MIX_GAIN * (gain) * 32768.0f))
+
+#define VOICE_NONE 0xFF
+
+#if (ADSR_BANK_SIZE < VOICE_COUNT)
+#error "ADSR_BANK_SIZE doit valoir au moins VOICE_COUNT"
+#endif
+#if (VOICE_FILTER == VOICE_FILTER_SVF) && (SVF_BANK_SIZE < VOICE_COUNT)
+#error "SVF_BANK_SIZE doit valoir au moins VOICE_COUNT"
+#endif
+
+typedef enum {
+    VOICE_STEAL_OLDEST = 0,     // note la plus ancienne
+    VOICE_STEAL_QUIETEST,       // niveau d'enveloppe le plus faible
+    VOICE_STEAL_SAME_NOTE       // redéclenche la voix qui joue déjà la note, sinon la plus ancienne
+} voice_steal_t;
+
+struct voice_pool_TypeStruct
+{
+    // État par voix (SoA)
+    uint32_t phase[VOICE_COUNT];        // 2^32 = une période
+    uint32_t increment[VOICE_COUNT];    // à OVERSAMPLE_FACTOR x fe
+    float32_t freq[VOICE_COUNT];
+    uint8_t note[VOICE_COUNT];
+    float32_t velocity[VOICE_COUNT];    // 0..1, source MOD_SRC_VELOCITY
+    uint8_t gate[VOICE_COUNT];          // 1 entre note on et note off
+    uint32_t age[VOICE_COUNT];          // horodatage du dernier note on
+    struct adsr_bank_TypeStruct env;    // niveaux et états des enveloppes, paramètres partagés
+    float32_t gain[VOICE_COUNT];        // MOD_DST_AMP en fin du dernier bloc
+    float32_t cutoff_ratio[VOICE_COUNT];    // MOD_DST_CUTOFF appliqué aux coefficients
+    float32_t resonance[VOICE_COUNT];       // MOD_DST_RESONANCE appliqué (biquad, SVF)
+    uint32_t coeff_elapsed[VOICE_COUNT];    // échantillons depuis le dernier recalcul, saturé
+#if (OVERSAMPLE_FACTOR > 1)
+    struct oversample_TypeStruct os[VOICE_COUNT];
+#endif
+#if (VOICE_FILTER == VOICE_FILTER_BIQUAD) && (SYNTH_FORMAT == SYNTH_FORMAT_Q15)
+    struct iir_q31_TypeStruct iir[VOICE_COUNT];
+#elif (VOICE_FILTER == VOICE_FILTER_BIQUAD)
+    struct iir_TypeStruct iir[VOICE_COUNT];
+#elif (VOICE_FILTER == VOICE_FILTER_SVF)
+    struct svf_bank_TypeStruct svf;     // états et coefficients (SoA), mode partagé
+#elif (VOICE_FILTER == VOICE_FILTER_FIR) && (SYNTH_FORMAT == SYNTH_FORMAT_Q15)
+    arm_fir_instance_q15 fir[VOICE_COUNT];
+    q15_t fir_coeffs[VOICE_COUNT][2][VOICE_FIR_TAPS];
+    q15_t fir_state[VOICE_COUNT][VOICE_FIR_TAPS + AUDIO_BLOCK_SIZE];   // numTaps + blockSize sur Cortex-M4/M7
+#elif (VOICE_FILTER == VOICE_FILTER_FIR)
+    arm_fir_instance_f32 fir[VOICE_COUNT];
+    float32_t fir_coeffs[VOICE_COUNT][2][VOICE_FIR_TAPS];   // double tampon : fir[v].pCoeffs pointe sur l'un des deux
+    float32_t fir_state[VOICE_COUNT][VOICE_FIR_TAPS + AUDIO_BLOCK_SIZE - 1];
+#endif
+
+    // Allocateur
+    uint8_t free_list[VOICE_COUNT];     // pile des voix libres
+    uint8_t free_count;
+    uint8_t active_list[VOICE_COUNT];   // voix en cours de rendu
+    uint8_t active_pos[VOICE_COUNT];    // position de chaque voix dans active_list
+    uint8_t active_count;
+
+    uint32_t clock;
+    voice_steal_t steal_policy;
+    osc_wave_t waveform;
+    float32_t pitch_ratio;              // 2^(MOD_DST_PITCH / 12), commun aux voix du bloc
+    const struct mod_TypeStruct *mod;   // coupure, résonance et gain modulés
+};
+
+extern struct voice_pool_TypeStruct voices;
+
+void voice_pool_init(struct voice_pool_TypeStruct* pool, const struct adsr_TypeStruct* env_ref,
+                     const struct mod_TypeStruct* mod_ref);
+uint8_t voice_note_on(struct voice_pool_TypeStruct* pool, uint8_t note, uint8_t velocity);
+void voice_note_off(struct voice_pool_TypeStruct* pool, uint8_t note);
+void voice_set_steal_policy(struct voice_pool_TypeStruct* pool, voice_steal_t policy);
+void voice_set_waveform(struct voice_pool_TypeStruct* pool, osc_wave_t wave);
+void voice_render_block(struct voice_pool_TypeStruct* pool, synth_sample_t* pDst, uint32_t blockSize);
+
+#endif /* INC_VOICE_H_ */
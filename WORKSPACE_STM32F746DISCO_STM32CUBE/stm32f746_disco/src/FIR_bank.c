@@ -0,0 +1,52 @@
+/*
+ * FIR_bank.c
+ *
+ *  Banque de coefficients FIR : FIR_BANK_SIZE coupures x FIR_BANK_TAPS
+ *  coefficients (64 x 64 x 4 octets = 16 Ko), générée par host/gen_tables.c
+ *  dans synth_fir_bank[] en flash. Rien à calculer au démarrage.
+ */
+
+#include "synth_opt.h"
+#include <string.h>
+#include "FIR_bank.h"
+
+static float32_t FIR_bank_position(float32_t cutoff);
+
+//=======================================================================================
+
+static float32_t FIR_bank_position(float32_t cutoff)
+{
+	if (cutoff <= FIR_BANK_FMIN) return 0.0f;
+	if (cutoff >= FIR_BANK_FMAX) return (float32_t)(FIR_BANK_SIZE - 1);
+	return (logf(cutoff) - SYNTH_FIR_BANK_LOG_FMIN) * SYNTH_FIR_BANK_INV_LOG_STEP;
+}
+
+// Ligne la plus proche : simple échange de pointeur pCoeffs
+const float32_t* FIR_bank_nearest(float32_t cutoff)
+{
+	uint32_t idx = (uint32_t)(FIR_bank_position(cutoff) + 0.5f);
+	return synth_fir_bank[idx];
+}
+
+// Interpolation linéaire entre les deux lignes voisines
+void FIR_bank_interp(float32_t cutoff, float32_t *pDst)
+{
+	float32_t pos = FIR_bank_position(cutoff);
+	uint32_t idx = (uint32_t)pos;
+	float32_t frac = pos - idx;
+	const float32_t *a, *b;
+	uint32_t n;
+
+	if (idx >= FIR_BANK_SIZE - 1)
+	{
+		memcpy(pDst, synth_fir_bank[FIR_BANK_SIZE - 1], sizeof(synth_fir_bank[0]));
+		return;
+	}
+
+	a = synth_fir_bank[idx];
+	b = synth_fir_bank[idx + 1];
+	for (n = 0; n < FIR_BANK_TAPS; n++)
+	{
+		pDst[n] = a[n] + frac * (b[n] - a[n]);
+	}
+}
@@ -5,15 +5,25 @@
  *      Author: kerhoas
  */
 
+#include "synth_opt.h"
+#include <string.h>
+#include <stdio.h>
+#include <stdlib.h>
 #include <FIR_filter.h>
+#include "synth_memory.h"
+#include "synth_profile.h"
+
+static void FIR_kernel_f32(const float32_t *pCoeffs, uint32_t numTaps, const float32_t *pState,
+		float32_t *pDst, uint32_t blockSize);
+static void FIR_kernel_q15(const q15_t *pCoeffs, uint32_t numTaps, const q15_t *pState,
+		q15_t *pDst, uint32_t blockSize);
 
 
 //=======================================================================================
 void FIR_calc_coeff_f32(arm_fir_instance_f32 *S, uint16_t numTaps,float32_t fc1, float32_t fc2, float32_t fe, int filter_type )
 {
 	float32_t *pCoeffs = S->pCoeffs;
-	    const float32_t nyquist = fe / 2.0f;
-	    const float32_t norm_cutoff = fc2 / nyquist; // Normalisation [0, 1]
+	    const float32_t norm_cutoff = fc2 / fe; // fc / fe, [0, 0.5] : h[centre] = 2 fc / fe
 	    const int center = numTaps / 2;             // Coefficient central
 
 	    // 1. Calcul de la réponse impulsionnelle idéale (fonction sinc)
@@ -46,124 +56,370 @@ void FIR_calc_coeff_f32(arm_fir_instance_f32 *S, uint16_t numTaps,float32_t fc1,
 }
 //=======================================================================================
 
-void FIR_init_f32( arm_fir_instance_f32 *S, uint16_t numTaps,float32_t *pCoeffs, float32_t *pState )
+void FIR_init_f32(struct FIR_f32_TypeStruct *S, uint16_t numTaps, const float32_t *pCoeffs, float32_t *pState)
 {
-  uint16_t i;
-
-  S->numTaps = numTaps;
-  S->pCoeffs = pCoeffs;
-  S->pState = pState;
-  for (i = 0; i < S->numTaps; i++)
-  {
-    S->pState[i] = 0;
-  }
+	S->numTaps = numTaps;
+	S->pCoeffs = pCoeffs;
+	S->pState = pState;
+	S->pos = numTaps - 1;
+	memset(pState, 0, FIR_STATE_SIZE(numTaps) * sizeof(float32_t));
 }
 
 //=======================================================================================
-void FIR_filt_f32(arm_fir_instance_f32 *S, float32_t *pSrc, float32_t *pDst) {
-
-	uint16_t i;
-	float32_t acc;
-
-    acc = 0;										// Clear the accumulator/output before filtering
-    S->pState[0] = *pSrc;					 // Place new input sample as first element in the filter state array
-    //Direct form filter each sample using a sum of products
-		for (i = 0; i < S->numTaps; i++)
-    {
-       acc += S->pState[i]*S->pCoeffs[i];
-    }
-	*pDst = acc;
-
-	// Vieillissement des échantillons d'entrée
-    for (i = S->numTaps-1; i > 0; i--)
-    {
-      S->pState[i] = S->pState[i-1];
-    }
+// Quatre sorties par passe : chaque coefficient est chargé une fois pour les
+// quatre fenêtres, les échantillons tournent dans x0..x3 (déroulé par 4 sur
+// les coefficients). Somme dans l'ordre des coefficients, comme arm_fir_f32.
+// pState pointe sur l'échantillon le plus ancien de la fenêtre de pDst[0].
+
+static void FIR_kernel_f32(const float32_t *pCoeffs, uint32_t numTaps, const float32_t *pState,
+		float32_t *pDst, uint32_t blockSize)
+{
+	uint32_t m, k;
+	float32_t c, acc0, acc1, acc2, acc3, x0, x1, x2, x3;
+
+	for (m = 0; m + 4 <= blockSize; m += 4)
+	{
+		const float32_t *x = pState + m;
+
+		acc0 = acc1 = acc2 = acc3 = 0.0f;
+		x0 = x[0];
+		x1 = x[1];
+		x2 = x[2];
+		for (k = 0; k + 4 <= numTaps; k += 4)
+		{
+			c = pCoeffs[k];
+			x3 = x[k + 3];
+			acc0 += c * x0; acc1 += c * x1; acc2 += c * x2; acc3 += c * x3;
+			c = pCoeffs[k + 1];
+			x0 = x[k + 4];
+			acc0 += c * x1; acc1 += c * x2; acc2 += c * x3; acc3 += c * x0;
+			c = pCoeffs[k + 2];
+			x1 = x[k + 5];
+			acc0 += c * x2; acc1 += c * x3; acc2 += c * x0; acc3 += c * x1;
+			c = pCoeffs[k + 3];
+			x2 = x[k + 6];
+			acc0 += c * x3; acc1 += c * x0; acc2 += c * x1; acc3 += c * x2;
+		}
+		for (; k < numTaps; k++)
+		{
+			c = pCoeffs[k];
+			x3 = x[k + 3];
+			acc0 += c * x0; acc1 += c * x1; acc2 += c * x2; acc3 += c * x3;
+			x0 = x1; x1 = x2; x2 = x3;
+		}
+		pDst[m] = acc0;
+		pDst[m + 1] = acc1;
+		pDst[m + 2] = acc2;
+		pDst[m + 3] = acc3;
+	}
+
+	for (; m < blockSize; m++)
+	{
+		const float32_t *x = pState + m;
+
+		acc0 = 0.0f;
+		for (k = 0; k < numTaps; k++)
+		{
+			acc0 += pCoeffs[k] * x[k];
+		}
+		pDst[m] = acc0;
+	}
 }
 
-//=======================================================================================
+// Les entrées sont recopiées à la suite de l'historique avant le calcul :
+// le filtrage en place est possible
+void FIR_filt_f32(struct FIR_f32_TypeStruct *S, const float32_t *pSrc, float32_t *pDst, uint32_t blockSize)
+{
+	uint32_t hist = S->numTaps - 1;
+	uint32_t end = FIR_STATE_SIZE(S->numTaps);
+	uint32_t n;
+
+	while (blockSize > 0)
+	{
+		if (S->pos == end)
+		{
+			memmove(S->pState, S->pState + end - hist, hist * sizeof(float32_t));
+			S->pos = hist;
+		}
+		n = end - S->pos;
+		if (n > blockSize) n = blockSize;
+
+		memcpy(S->pState + S->pos, pSrc, n * sizeof(float32_t));
+		FIR_kernel_f32(S->pCoeffs, S->numTaps, S->pState + S->pos - hist, pDst, n);
+
+		S->pos += n;
+		pSrc += n;
+		pDst += n;
+		blockSize -= n;
+	}
+}
 
-void FIR_filt_f32_circular(arm_fir_instance_f32 *S, float32_t *pSrc, float32_t *pDst) {
+//=======================================================================================
 
-	int16_t i;
-	float32_t acc;
-	static int16_t k=0;	// younger sample index
+void FIR_init_q15(struct FIR_q15_TypeStruct *S, uint16_t numTaps, const q15_t *pCoeffs, q15_t *pState)
+{
+	S->numTaps = numTaps;
+	S->pCoeffs = pCoeffs;
+	S->pState = pState;
+	S->pos = numTaps - 1;
+	memset(pState, 0, FIR_STATE_SIZE(numTaps) * sizeof(q15_t));
+}
 
-    acc = 0;										// Clear the accumulator/output before filtering
-    S->pState[k] = *pSrc;					 // Place new input sample as first element in the filter state array
-    //Direct form filter each sample using a sum of products
-		for (i = 0; i < S->numTaps; i++)
-    {
-       acc += S->pState[k++]*S->pCoeffs[i];
-       if (k >= S->numTaps) k = 0;
+//=======================================================================================
+// Deux coefficients par __SMLALD (accumulateur 64 bits), quatre sorties par
+// passe : les paires d'échantillons aux décalages k+2 et k+3 servent de
+// paires k et k+1 à l'itération suivante. Lectures 32 bits non alignées
+// (autorisées par le Cortex-M7 pour LDR).
 
-    }
-	*pDst = acc;
+static inline q31_t FIR_read_q15x2(const q15_t *p)
+{
+	q31_t v;
 
-	k--;
-	if (k <0) k = S->numTaps-1;
+	memcpy(&v, p, sizeof(v));
+	return v;
 }
 
-//=======================================================================================
+#define FIR_SMLALD(c, x, acc)	((q63_t)__SMLALD((uint32_t)(c), (uint32_t)(x), (uint64_t)(acc)))
+#define FIR_Q15_OUT(acc)		((q15_t)__SSAT((q31_t)((acc) >> 15), 16))
 
-void FIR_init_q15(arm_fir_instance_q15 *S, uint16_t numTaps, q15_t * pCoeffs, q15_t * pState)
+static void FIR_kernel_q15(const q15_t *pCoeffs, uint32_t numTaps, const q15_t *pState,
+		q15_t *pDst, uint32_t blockSize)
 {
-	  uint16_t i;
-	  S->numTaps = numTaps;
-	  S->pCoeffs = pCoeffs;
-	  S->pState = pState;
-	  for (i = 0; i < S->numTaps; i++)
-	  {
-	    S->pState[i] = 0;
-	  }
+	uint32_t m, k;
+	q63_t acc0, acc1, acc2, acc3;
+	q31_t c, x01, x12, x23, x34;
+
+	for (m = 0; m + 4 <= blockSize; m += 4)
+	{
+		const q15_t *x = pState + m;
+
+		acc0 = acc1 = acc2 = acc3 = 0;
+		x01 = FIR_read_q15x2(x);
+		x12 = FIR_read_q15x2(x + 1);
+		for (k = 0; k + 2 <= numTaps; k += 2)
+		{
+			c = FIR_read_q15x2(pCoeffs + k);
+			x23 = FIR_read_q15x2(x + k + 2);
+			x34 = FIR_read_q15x2(x + k + 3);
+			acc0 = FIR_SMLALD(c, x01, acc0);
+			acc1 = FIR_SMLALD(c, x12, acc1);
+			acc2 = FIR_SMLALD(c, x23, acc2);
+			acc3 = FIR_SMLALD(c, x34, acc3);
+			x01 = x23;
+			x12 = x34;
+		}
+		if (k < numTaps)
+		{
+			c = pCoeffs[k];
+			acc0 += (q31_t)c * x[k];
+			acc1 += (q31_t)c * x[k + 1];
+			acc2 += (q31_t)c * x[k + 2];
+			acc3 += (q31_t)c * x[k + 3];
+		}
+		pDst[m] = FIR_Q15_OUT(acc0);
+		pDst[m + 1] = FIR_Q15_OUT(acc1);
+		pDst[m + 2] = FIR_Q15_OUT(acc2);
+		pDst[m + 3] = FIR_Q15_OUT(acc3);
+	}
+
+	for (; m < blockSize; m++)
+	{
+		const q15_t *x = pState + m;
+
+		acc0 = 0;
+		for (k = 0; k + 2 <= numTaps; k += 2)
+		{
+			acc0 = FIR_SMLALD(FIR_read_q15x2(pCoeffs + k), FIR_read_q15x2(x + k), acc0);
+		}
+		if (k < numTaps)
+		{
+			acc0 += (q31_t)pCoeffs[k] * x[k];
+		}
+		pDst[m] = FIR_Q15_OUT(acc0);
+	}
+}
+
+void FIR_filt_q15(struct FIR_q15_TypeStruct *S, const q15_t *pSrc, q15_t *pDst, uint32_t blockSize)
+{
+	uint32_t hist = S->numTaps - 1;
+	uint32_t end = FIR_STATE_SIZE(S->numTaps);
+	uint32_t n;
+
+	while (blockSize > 0)
+	{
+		if (S->pos == end)
+		{
+			memmove(S->pState, S->pState + end - hist, hist * sizeof(q15_t));
+			S->pos = hist;
+		}
+		n = end - S->pos;
+		if (n > blockSize) n = blockSize;
+
+		memcpy(S->pState + S->pos, pSrc, n * sizeof(q15_t));
+		FIR_kernel_q15(S->pCoeffs, S->numTaps, S->pState + S->pos - hist, pDst, n);
+
+		S->pos += n;
+		pSrc += n;
+		pDst += n;
+		blockSize -= n;
+	}
 }
 
 //=======================================================================================
+// Banc de mesure : même passe-bas (Hamming, fc = fe/10) et même bloc pour
+// chaque noyau, premier passage hors mesure. max_err : écart maximal à
+// arm_fir_f32 (unités de 2^-24) ou à arm_fir_q15 (LSB) sur le dernier bloc.
+
+#if defined(SYNTH_PROFILE_ENABLED)
+
+#define BENCH_BLOCK		64
+#define BENCH_RUNS		16
+#define BENCH_TAPS_MAX	128
+
+static const uint16_t bench_taps[] = { 32, 64, 128 };
+
+typedef struct {
+	float32_t in[BENCH_BLOCK];
+	float32_t out[BENCH_BLOCK];
+	float32_t ref[BENCH_BLOCK];
+	float32_t coeffs[BENCH_TAPS_MAX];
+	float32_t state[FIR_STATE_SIZE(BENCH_TAPS_MAX)];
+	q15_t in_q15[BENCH_BLOCK];
+	q15_t out_q15[BENCH_BLOCK];
+	q15_t ref_q15[BENCH_BLOCK];
+	q15_t coeffs_q15[BENCH_TAPS_MAX];
+	q15_t state_q15[FIR_STATE_SIZE(BENCH_TAPS_MAX)];
+} fir_bench_t;
+
+static fir_bench_t bench SYNTH_DTCM;
+
+typedef enum {
+	BENCH_ARM_F32 = 0,
+	BENCH_FIR_F32,
+	BENCH_ARM_Q15,
+	BENCH_ARM_FAST_Q15,
+	BENCH_FIR_Q15,
+	BENCH_KERNEL_COUNT
+} fir_bench_kernel_t;
+
+static const char *const bench_names[BENCH_KERNEL_COUNT] = {
+	"arm_fir_f32", "FIR_filt_f32", "arm_fir_q15", "arm_fir_fast_q15", "FIR_filt_q15"
+};
+
+// Ticks moyens par bloc ; la sortie du dernier bloc reste dans out / out_q15
+static uint32_t FIR_bench_run(fir_bench_kernel_t kernel, uint16_t numTaps)
+{
+	arm_fir_instance_f32 arm_f32;
+	arm_fir_instance_q15 arm_q15;
+	struct FIR_f32_TypeStruct fir_f32;
+	struct FIR_q15_TypeStruct fir_q15;
+	uint32_t run, t0, sum = 0;
+
+	arm_fir_init_f32(&arm_f32, numTaps, bench.coeffs, bench.state, BENCH_BLOCK);
+	arm_fir_init_q15(&arm_q15, numTaps, bench.coeffs_q15, bench.state_q15, BENCH_BLOCK);
+	FIR_init_f32(&fir_f32, numTaps, bench.coeffs, bench.state);
+	FIR_init_q15(&fir_q15, numTaps, bench.coeffs_q15, bench.state_q15);
+
+	for (run = 0; run <= BENCH_RUNS; run++)
+	{
+		t0 = SYNTH_PROFILE_NOW();
+		switch (kernel)
+		{
+		case BENCH_ARM_F32:			arm_fir_f32(&arm_f32, bench.in, bench.out, BENCH_BLOCK); break;
+		case BENCH_FIR_F32:			FIR_filt_f32(&fir_f32, bench.in, bench.out, BENCH_BLOCK); break;
+		case BENCH_ARM_Q15:			arm_fir_q15(&arm_q15, bench.in_q15, bench.out_q15, BENCH_BLOCK); break;
+		case BENCH_ARM_FAST_Q15:	arm_fir_fast_q15(&arm_q15, bench.in_q15, bench.out_q15, BENCH_BLOCK); break;
+		default:					FIR_filt_q15(&fir_q15, bench.in_q15, bench.out_q15, BENCH_BLOCK); break;
+		}
+		if (run) sum += SYNTH_PROFILE_NOW() - t0;
+	}
+	return sum / BENCH_RUNS;
+}
 
-void FIR_filt_q15(arm_fir_instance_q15 *S, q15_t *pSrc, q15_t *pDst) {
-
-	uint16_t i;
-	int32_t acc;
-
-    acc = 0;										// Clear the accumulator/output before filtering
-    S->pState[0] = *pSrc;					 // Place new input sample as first element in the filter state array
-    //Direct form filter each sample using a sum of products
-		for (i = 0; i < S->numTaps; i++)
-    {
-       acc += (int32_t) S->pState[i]*S->pCoeffs[i];
-    }
-	*pDst = (int16_t) (acc >> 16);
-
-	// Vieillissement des échantillons d'entrée
-    for (i = S->numTaps-1; i > 0; i--)
-    {
-      S->pState[i] = S->pState[i-1];
-    }
+int FIR_bench_format(char *buf, int len)
+{
+	arm_fir_instance_f32 S;
+	uint32_t t, k, i, err;
+	int n, pos;
+
+	n = snprintf(buf, len, "# fir bench unit=%s block=%d\nkernel,taps,ticks,max_err\n", SYNTH_PROFILE_UNIT, BENCH_BLOCK);
+	if (n < 0 || n >= len) return len - 1;
+	pos = n;
+
+	// deux sinus non harmoniques à -6 dB : état différent à chaque bloc
+	for (i = 0; i < BENCH_BLOCK; i++)
+	{
+		bench.in[i] = 0.25f * sinf(0.05f * i) + 0.25f * sinf(1.3f * i);
+	}
+	arm_float_to_q15(bench.in, bench.in_q15, BENCH_BLOCK);
+
+	for (t = 0; t < sizeof(bench_taps) / sizeof(bench_taps[0]); t++)
+	{
+		S.pCoeffs = bench.coeffs;
+		FIR_calc_coeff_f32(&S, bench_taps[t], 0, 0.1f, 1.0f, 0);
+		arm_float_to_q15(bench.coeffs, bench.coeffs_q15, bench_taps[t]);
+
+		for (k = 0; k < BENCH_KERNEL_COUNT; k++)
+		{
+			uint32_t ticks = FIR_bench_run((fir_bench_kernel_t)k, bench_taps[t]);
+
+			err = 0;
+			if (k == BENCH_ARM_F32)
+			{
+				memcpy(bench.ref, bench.out, sizeof(bench.ref));
+			}
+			else if (k == BENCH_FIR_F32)
+			{
+				for (i = 0; i < BENCH_BLOCK; i++)
+				{
+					uint32_t e = (uint32_t)ceilf(fabsf(bench.out[i] - bench.ref[i]) * 16777216.0f);
+					if (e > err) err = e;
+				}
+			}
+			else if (k == BENCH_ARM_Q15)
+			{
+				memcpy(bench.ref_q15, bench.out_q15, sizeof(bench.ref_q15));
+			}
+			else
+			{
+				for (i = 0; i < BENCH_BLOCK; i++)
+				{
+					uint32_t e = (uint32_t)abs(bench.out_q15[i] - bench.ref_q15[i]);
+					if (e > err) err = e;
+				}
+			}
+
+			n = snprintf(buf + pos, len - pos, "%s,%u,%lu,%lu\n", bench_names[k], bench_taps[t],
+					(unsigned long)ticks, (unsigned long)err);
+			if (n < 0 || n >= len - pos) return len - 1;
+			pos += n;
+		}
+	}
+	return pos;
 }
 
-//=======================================================================================
+#else
 
-void FIR_filt_q15_circular(arm_fir_instance_q15 *S, q15_t *pSrc, q15_t *pDst) {
-
-	uint16_t i;
-	int32_t acc;
-	static int16_t k=0;	// younger sample index
-
-    acc = 0;										// Clear the accumulator/output before filtering
-    S->pState[k] = *pSrc;					 // Place new input sample as first element in the filter state array
-    //Direct form filter each sample using a sum of products
-		for (i = 0; i < S->numTaps; i++)
-    {
-       acc += (int32_t) S->pState[k++]*S->pCoeffs[i];
-       if (k >= S->numTaps) k = 0;
-    }
-	*pDst = (int16_t) (acc >> 16);
-
-	//k++;
-	//if (k >= S->numTaps) k = 0;
-	k--;
-	if (k <0) k = S->numTaps-1;
+int FIR_bench_format(char *buf, int len)
+{
+	return snprintf(buf, len, "# fir bench : compiler avec SYNTH_PROFILE_DWT ou SYNTH_PROFILE_HOST\n");
 }
 
-//=======================================================================================
+#endif
 
+// Envoie le dump sur la sortie ITM (console SWV de STM32CubeIDE) ou stdout sur PC
+void FIR_bench(void)
+{
+	static char text[512];
+	int i, n = FIR_bench_format(text, sizeof(text));
+
+#if defined(SYNTH_PROFILE_DWT)
+	for (i = 0; i < n; i++)
+	{
+		ITM_SendChar(text[i]);
+	}
+#else
+	(void)i;
+	fwrite(text, 1, n, stdout);
+#endif
+}
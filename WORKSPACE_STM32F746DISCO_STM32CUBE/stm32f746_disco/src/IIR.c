@@ -0,0 +1,341 @@
+/*
+ * IIR.c
+ *
+ *  Filtre à variables d'état TPT (voir IIR.h).
+ *
+ *  Les quatre sorties sont une combinaison de x, v1 et v2 :
+ *      y = c0 x + s1 k v1 + c2 v2
+ *  le mode ne change que les constantes, la boucle est la même.
+ *
+ *  Rampe de coupure : g et k suivent une droite sur le bloc, a1 est corrigé
+ *  à chaque échantillon par a1 <- a1 (2 - d a1), d = 1 + g (g + k). L'erreur
+ *  relative est élevée au carré à chaque pas : partant de la valeur exacte
+ *  du bloc précédent, elle reste de l'ordre du carré de la variation d'un
+ *  échantillon. La valeur exacte est reprise en fin de rampe.
+ *
+ *  La récursion (ic1, ic2) d'un filtre enchaîne des opérations dépendantes :
+ *  le rendu des voix par paires (SVF_bank_process_pair) entrelace deux
+ *  filtres indépendants dans la même boucle.
+ */
+
+#include "synth_opt.h"
+#include "IIR.h"
+
+// Tampon flottant du rendu Q15
+#define SVF_Q15_CHUNK 32
+
+struct svf_mix_TypeStruct
+{
+	float32_t c0, s1, c2;
+};
+
+// Coefficients et état d'un filtre de la banque pendant un rendu
+struct svf_run_TypeStruct
+{
+	float32_t g, k, a1, a2, a3;
+	float32_t dg, dk;			// pas de la rampe
+	float32_t c0, s1, c1, c2;	// c1 = s1 k
+	float32_t ic1, ic2;
+};
+
+static const struct svf_mix_TypeStruct svf_mix[SVF_MODE_COUNT] = {
+	{ 0.0f,  0.0f, 1.0f },		// passe-bas
+	{ 0.0f,  1.0f, 0.0f },		// passe-bande, gain unité à fc
+	{ 1.0f, -1.0f, -1.0f },		// passe-haut
+	{ 1.0f, -1.0f, 0.0f },		// réjecteur
+};
+
+static float32_t SVF_g(float32_t fe, float32_t cutoff);
+static float32_t SVF_k(float32_t resonance);
+static void SVF_bank_run(struct svf_bank_TypeStruct *bank, uint32_t i, const float32_t *pSrc, float32_t *pDst,
+                         uint32_t n, uint32_t remaining);
+static void SVF_bank_run_pair(struct svf_bank_TypeStruct *bank, uint32_t i, uint32_t j, float32_t *pBufI, float32_t *pBufJ,
+                              uint32_t n, uint32_t remaining);
+
+//=====================================================================
+// Coefficients
+
+// Padé [3/4] de tan sur [0, pi/4], tan(x) = 1 / tan(pi/2 - x) au-delà
+float32_t SVF_tan(float32_t x)
+{
+	float32_t x2, y;
+	int inv = 0;
+
+	if (x > 0.25f * PI)
+	{
+		x = 0.5f * PI - x;
+		inv = 1;
+	}
+	x2 = x * x;
+	y = x * (105.0f - 10.0f * x2) / (105.0f - x2 * (45.0f - x2));
+	return inv ? 1.0f / y : y;
+}
+
+static float32_t SVF_g(float32_t fe, float32_t cutoff)
+{
+	if (cutoff > SVF_FC_MAX_RATIO * fe) cutoff = SVF_FC_MAX_RATIO * fe;
+	if (cutoff < 1.0f) cutoff = 1.0f;
+	return SVF_tan(PI * cutoff / fe);
+}
+
+static float32_t SVF_k(float32_t resonance)
+{
+	if (resonance < SVF_Q_MIN) resonance = SVF_Q_MIN;
+	return 1.0f / resonance;
+}
+
+//=====================================================================
+// Filtre seul
+
+void SVF_init(state_variable_filter_t *f, float fe, float cutoff, float resonance)
+{
+	f->ic1eq = 0.0f;
+	f->ic2eq = 0.0f;
+	f->yl = 0.0f;
+	f->yb = 0.0f;
+	f->yh = 0.0f;
+	SVF_set(f, fe, cutoff, resonance);
+}
+
+void SVF_set(state_variable_filter_t *f, float fe, float cutoff, float resonance)
+{
+	float g = SVF_g(fe, cutoff);
+
+	f->fc = cutoff;
+	f->Q = resonance;
+	f->k = SVF_k(resonance);
+	f->a1 = 1.0f / (1.0f + g * (g + f->k));
+	f->a2 = g * f->a1;
+	f->a3 = g * f->a2;
+}
+
+float SVF_process(state_variable_filter_t *f, float x)
+{
+	float v3 = x - f->ic2eq;
+	float v1 = f->a1 * f->ic1eq + f->a2 * v3;
+	float v2 = f->ic2eq + f->a2 * f->ic1eq + f->a3 * v3;
+
+	f->ic1eq = 2.0f * v1 - f->ic1eq;
+	f->ic2eq = 2.0f * v2 - f->ic2eq;
+	f->yl = v2;
+	f->yb = f->k * v1;
+	f->yh = x - f->k * v1 - v2;
+	return v2;
+}
+
+//=====================================================================
+// Banque
+
+void SVF_bank_init(struct svf_bank_TypeStruct *bank, svf_mode_t mode, float32_t fe)
+{
+	uint32_t i;
+
+	bank->fe = fe;
+	SVF_bank_set_mode(bank, mode);
+	for (i = 0; i < SVF_BANK_SIZE; i++)
+	{
+		SVF_bank_reset(bank, i, 1000.0f, 0.70710678f);
+	}
+}
+
+void SVF_bank_set_mode(struct svf_bank_TypeStruct *bank, svf_mode_t mode)
+{
+	bank->mode = (mode < SVF_MODE_COUNT) ? mode : SVF_LOWPASS;
+}
+
+void SVF_bank_set(struct svf_bank_TypeStruct *bank, uint32_t i, float32_t cutoff, float32_t resonance)
+{
+	float32_t g = SVF_g(bank->fe, cutoff);
+	float32_t k = SVF_k(resonance);
+
+	bank->g_target[i] = g;
+	bank->k_target[i] = k;
+	bank->a1_target[i] = 1.0f / (1.0f + g * (g + k));
+}
+
+void SVF_bank_reset(struct svf_bank_TypeStruct *bank, uint32_t i, float32_t cutoff, float32_t resonance)
+{
+	SVF_bank_set(bank, i, cutoff, resonance);
+	bank->g[i] = bank->g_target[i];
+	bank->k[i] = bank->k_target[i];
+	bank->a1[i] = bank->a1_target[i];
+	bank->ic1eq[i] = 0.0f;
+	bank->ic2eq[i] = 0.0f;
+}
+
+// Un filtre de la banque pendant un rendu, en variables locales
+static inline void SVF_run_load(const struct svf_bank_TypeStruct *bank, uint32_t i, struct svf_run_TypeStruct *r,
+                                uint32_t remaining)
+{
+	const struct svf_mix_TypeStruct *m = &svf_mix[bank->mode];
+
+	r->g = bank->g[i];
+	r->k = bank->k[i];
+	r->a1 = bank->a1[i];
+	r->a2 = r->g * r->a1;
+	r->a3 = r->g * r->a2;
+	r->dg = (bank->g_target[i] - r->g) / remaining;
+	r->dk = (bank->k_target[i] - r->k) / remaining;
+	r->c0 = m->c0;
+	r->s1 = m->s1;
+	r->c1 = m->s1 * r->k;
+	r->c2 = m->c2;
+	r->ic1 = bank->ic1eq[i];
+	r->ic2 = bank->ic2eq[i];
+}
+
+// Fin de rampe (done) : reprise des valeurs exactes
+static inline void SVF_run_store(struct svf_bank_TypeStruct *bank, uint32_t i, const struct svf_run_TypeStruct *r,
+                                 int done)
+{
+	if (done)
+	{
+		bank->g[i] = bank->g_target[i];
+		bank->k[i] = bank->k_target[i];
+		bank->a1[i] = bank->a1_target[i];
+	}
+	else
+	{
+		bank->g[i] = r->g;
+		bank->k[i] = r->k;
+		bank->a1[i] = r->a1;
+	}
+	bank->ic1eq[i] = r->ic1;
+	bank->ic2eq[i] = r->ic2;
+}
+
+static inline int SVF_run_fixed(const struct svf_run_TypeStruct *r)
+{
+	return r->dg == 0.0f && r->dk == 0.0f;
+}
+
+// Pas de la rampe : g et k avancent, a1 suit par Newton
+static inline void SVF_run_step(struct svf_run_TypeStruct *r)
+{
+	r->g += r->dg;
+	r->k += r->dk;
+	r->a1 = r->a1 * (2.0f - (1.0f + r->g * (r->g + r->k)) * r->a1);
+	r->a2 = r->g * r->a1;
+	r->a3 = r->g * r->a2;
+	r->c1 = r->s1 * r->k;
+}
+
+static inline float32_t SVF_run_tick(struct svf_run_TypeStruct *r, float32_t x)
+{
+	float32_t v3 = x - r->ic2;
+	float32_t v1 = r->a1 * r->ic1 + r->a2 * v3;
+	float32_t v2 = r->ic2 + r->a2 * r->ic1 + r->a3 * v3;
+
+	r->ic1 = 2.0f * v1 - r->ic1;
+	r->ic2 = 2.0f * v2 - r->ic2;
+	return r->c0 * x + r->c1 * v1 + r->c2 * v2;
+}
+
+// n échantillons d'une rampe qui se termine dans remaining échantillons
+static void SVF_bank_run(struct svf_bank_TypeStruct *bank, uint32_t i, const float32_t *pSrc, float32_t *pDst,
+                         uint32_t n, uint32_t remaining)
+{
+	struct svf_run_TypeStruct r;
+	uint32_t j;
+
+	SVF_run_load(bank, i, &r, remaining);
+	if (SVF_run_fixed(&r))
+	{
+		for (j = 0; j < n; j++)
+		{
+			pDst[j] = SVF_run_tick(&r, pSrc[j]);
+		}
+	}
+	else
+	{
+		for (j = 0; j < n; j++)
+		{
+			SVF_run_step(&r);
+			pDst[j] = SVF_run_tick(&r, pSrc[j]);
+		}
+	}
+	SVF_run_store(bank, i, &r, n == remaining);
+}
+
+// Deux filtres dans la même boucle : les deux récursions indépendantes
+// s'entrelacent et masquent la latence des multiplications-additions
+static void SVF_bank_run_pair(struct svf_bank_TypeStruct *bank, uint32_t i, uint32_t j, float32_t *pBufI, float32_t *pBufJ,
+                              uint32_t n, uint32_t remaining)
+{
+	struct svf_run_TypeStruct ri, rj;
+	uint32_t s;
+
+	SVF_run_load(bank, i, &ri, remaining);
+	SVF_run_load(bank, j, &rj, remaining);
+	if (SVF_run_fixed(&ri) && SVF_run_fixed(&rj))
+	{
+		for (s = 0; s < n; s++)
+		{
+			pBufI[s] = SVF_run_tick(&ri, pBufI[s]);
+			pBufJ[s] = SVF_run_tick(&rj, pBufJ[s]);
+		}
+	}
+	else
+	{
+		for (s = 0; s < n; s++)
+		{
+			SVF_run_step(&ri);
+			SVF_run_step(&rj);
+			pBufI[s] = SVF_run_tick(&ri, pBufI[s]);
+			pBufJ[s] = SVF_run_tick(&rj, pBufJ[s]);
+		}
+	}
+	SVF_run_store(bank, i, &ri, n == remaining);
+	SVF_run_store(bank, j, &rj, n == remaining);
+}
+
+void SVF_bank_process(struct svf_bank_TypeStruct *bank, uint32_t i, const float32_t *pSrc, float32_t *pDst, uint32_t blockSize)
+{
+	if (blockSize == 0) return;
+	SVF_bank_run(bank, i, pSrc, pDst, blockSize, blockSize);
+}
+
+void SVF_bank_process_pair(struct svf_bank_TypeStruct *bank, uint32_t i, uint32_t j, float32_t *pBufI, float32_t *pBufJ,
+                           uint32_t blockSize)
+{
+	if (blockSize == 0) return;
+	SVF_bank_run_pair(bank, i, j, pBufI, pBufJ, blockSize, blockSize);
+}
+
+// Mêmes filtres, entrées et sorties converties par paquets, rampe sur tout le bloc
+void SVF_bank_process_q15(struct svf_bank_TypeStruct *bank, uint32_t i, const q15_t *pSrc, q15_t *pDst, uint32_t blockSize)
+{
+	float32_t chunk[SVF_Q15_CHUNK];
+	uint32_t n;
+
+	while (blockSize > 0)
+	{
+		n = (blockSize > SVF_Q15_CHUNK) ? SVF_Q15_CHUNK : blockSize;
+		arm_q15_to_float((q15_t*)pSrc, chunk, n);
+		SVF_bank_run(bank, i, chunk, chunk, n, blockSize);
+		arm_float_to_q15(chunk, pDst, n);
+		pSrc += n;
+		pDst += n;
+		blockSize -= n;
+	}
+}
+
+void SVF_bank_process_pair_q15(struct svf_bank_TypeStruct *bank, uint32_t i, uint32_t j, q15_t *pBufI, q15_t *pBufJ,
+                               uint32_t blockSize)
+{
+	float32_t chunk_i[SVF_Q15_CHUNK], chunk_j[SVF_Q15_CHUNK];
+	uint32_t n;
+
+	while (blockSize > 0)
+	{
+		n = (blockSize > SVF_Q15_CHUNK) ? SVF_Q15_CHUNK : blockSize;
+		arm_q15_to_float(pBufI, chunk_i, n);
+		arm_q15_to_float(pBufJ, chunk_j, n);
+		SVF_bank_run_pair(bank, i, j, chunk_i, chunk_j, n, blockSize);
+		arm_float_to_q15(chunk_i, pBufI, n);
+		arm_float_to_q15(chunk_j, pBufJ, n);
+		pBufI += n;
+		pBufJ += n;
+		blockSize -= n;
+	}
+}
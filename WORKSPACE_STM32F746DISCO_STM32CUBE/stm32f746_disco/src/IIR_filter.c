@@ -1,54 +1,300 @@
+/*
+ * IIR_filter.c
+ *
+ *  Calcul des sections biquad par transformation bilinéaire (szxform)
+ *  et filtrage par blocs avec les noyaux CMSIS DF2T mono et stéréo.
+ *
+ *  Format des coefficients CMSIS, par section :
+ *      {b0, b1, b2, a1, a2}   y[n] = b0 x[n] + b1 x[n-1] + b2 x[n-2] + a1 y[n-1] + a2 y[n-2]
+ */
+
+#include "synth_opt.h"
 #include "IIR_filter.h"
-#pragma GCC optimize ("O0")
+#include "bilinear.h"
+
+static void IIR_section(float32_t *pCoeffs,
+                        float a0, float a1, float a2,
+                        float b0, float b1, float b2,
+                        float fc, float fe, float gain);
+static void IIR_first_order(float32_t *pCoeffs, int highpass, float32_t K, float32_t gain);
+static int8_t IIR_to_q31(const float32_t *pSrc, uint8_t numStages, q31_t *pDst);
 
 //=====================================================================
-void IIR_calc_coeff_f32(arm_iir_instance_f32 *S, uint16_t numStages,float32_t fc1, float32_t fc2, float32_t fe, int filter_type )
+// Section du second ordre : prototype analogique normalisé (1 rad/s)
+// a0 + a1 s + a2 s^2 / b0 + b1 s + b2 s^2, ramené à fc par szxform()
+
+static void IIR_section(float32_t *pCoeffs,
+                        float a0, float a1, float a2,
+                        float b0, float b1, float b2,
+                        float fc, float fe, float gain)
 {
- // A COMPLETER
+	float k = gain;
+	float coef[4];      // beta1, beta2, alpha1, alpha2
+
+	szxform(&a0, &a1, &a2, &b0, &b1, &b2, fc, fe, &k, coef);
+
+	pCoeffs[0] = k;
+	pCoeffs[1] = k * coef[2];
+	pCoeffs[2] = k * coef[3];
+	pCoeffs[3] = -coef[0];
+	pCoeffs[4] = -coef[1];
 }
+
 //=====================================================================
-void IIR_init_f32( arm_iir_instance_f32 * S,  uint16_t numStages,  float32_t * pCoeffs,  float32_t * pState,  uint32_t blockSize)
+// Section du premier ordre (ordres impairs), K = tan(pi * fc / fe) déjà pré-déformé.
+// Calculée directement : passer b2 = 0 à bilinear() laisserait un pôle en z = -1.
+
+static void IIR_first_order(float32_t *pCoeffs, int highpass, float32_t K, float32_t gain)
 {
-	  S->numStages = numStages;
-	  S->coef = pCoeffs;
-	  S->pState = pState;
+	float32_t norm = 1.0f / (1.0f + K);
+
+	if (highpass)
+	{
+		pCoeffs[0] = gain * norm;
+		pCoeffs[1] = -gain * norm;
+	}
+	else
+	{
+		pCoeffs[0] = gain * K * norm;
+		pCoeffs[1] = gain * K * norm;
+	}
+	pCoeffs[2] = 0.0f;
+	pCoeffs[3] = (1.0f - K) * norm;
+	pCoeffs[4] = 0.0f;
 }
+
 //=====================================================================
-int IIR_filt_f32(arm_iir_instance_f32 *S, float* x, float* y)
+// Remplit pCoeffs (5 coefficients par section) et retourne le nombre de sections.
+//  order  : ordre du filtre (1..2*IIR_MAX_STAGES), ignoré pour plateaux et cloche (1 section)
+//  param  : Q (0.7071 = Butterworth sans résonance) ou ondulation en dB (Chebyshev)
+//  gain_db: gain des plateaux et de la cloche
+
+uint8_t IIR_design_f32(float32_t *pCoeffs, iir_type_t type, uint8_t order,
+                       float32_t fc, float32_t fe, float32_t param, float32_t gain_db)
 {
-    unsigned int i;
-    float *wn_1_ptr,*wn_2_ptr,*coef_ptr;
-    float output=0.0;
-    float wn,wn_1,wn_2;
+	uint8_t numStages = 0;
+	uint8_t i, pairs;
+	float32_t theta, A, sqrtA;
+
+	if (order < 1) order = 1;
+	if (order > 2 * IIR_MAX_STAGES) order = 2 * IIR_MAX_STAGES;
+	if (fc < 1.0f) fc = 1.0f;
+	if (fc > 0.49f * fe) fc = 0.49f * fe;
+	if (param < 0.01f) param = 0.01f;
 
-    coef_ptr = S->coef;                /* coefficient pointer */
+	pairs = order / 2;
 
-    wn_1_ptr = S->pState;            /* first history */
-    wn_2_ptr = wn_1_ptr + 1;           /* next history */
+	switch (type)
+	{
+		case IIR_LOWPASS:
+		case IIR_HIGHPASS:
+		{
+			int highpass = (type == IIR_HIGHPASS);
 
-    output = *x * (*coef_ptr++);
+			// Pôles de Butterworth : s^2 + 2 sin(theta_k) s + 1.
+			// La section la moins amortie (k = 0) porte la résonance.
+			for (i = 0; i < pairs; i++)
+			{
+				theta = PI * (2 * i + 1) / (2.0f * order);
+				float32_t b1 = 2.0f * sinf(theta);
+				if (i == 0) b1 *= (0.70710678f / param);
+				if (highpass)
+					IIR_section(&pCoeffs[5 * numStages], 0.0f, 0.0f, 1.0f, 1.0f, b1, 1.0f, fc, fe, 1.0f);
+				else
+					IIR_section(&pCoeffs[5 * numStages], 1.0f, 0.0f, 0.0f, 1.0f, b1, 1.0f, fc, fe, 1.0f);
+				numStages++;
+			}
+			if (order & 1)
+			{
+				IIR_first_order(&pCoeffs[5 * numStages], highpass, tanf(PI * fc / fe), 1.0f);
+				numStages++;
+			}
+			break;
+		}
 
-    for (i = 0 ; i < S->numStages; i++)
-        {
-        wn_1 = *wn_1_ptr;           /* history values */
-        wn_2 = *wn_2_ptr;
+		case IIR_CHEBYSHEV_LOWPASS:
+		{
+			// Chebyshev type I, fc = fin de la bande passante, param = ondulation (dB)
+			float32_t eps = sqrtf(powf(10.0f, param / 10.0f) - 1.0f);
+			float32_t v0 = asinhf(1.0f / eps) / order;
+			float32_t sh = sinhf(v0), ch = coshf(v0);
+			// Ordre pair : gain continu = 1/sqrt(1+eps^2) (creux de l'ondulation)
+			float32_t gain = (order & 1) ? 1.0f : 1.0f / sqrtf(1.0f + eps * eps);
 
-        output = output - wn_1 * (*coef_ptr++);
-        wn = output - wn_2 * (*coef_ptr++);    /* poles */
+			for (i = 0; i < pairs; i++)
+			{
+				theta = PI * (2 * i + 1) / (2.0f * order);
+				float32_t sigma = sh * sinf(theta);
+				float32_t omega = ch * cosf(theta);
+				float32_t w0 = sigma * sigma + omega * omega;
+				IIR_section(&pCoeffs[5 * numStages], w0, 0.0f, 0.0f, w0, 2.0f * sigma, 1.0f, fc, fe, gain);
+				gain = 1.0f;
+				numStages++;
+			}
+			if (order & 1)
+			{
+				// pôle réel en -sinh(v0), soit une coupure à sinh(v0) * fc
+				IIR_first_order(&pCoeffs[5 * numStages], 0, sh * tanf(PI * fc / fe), 1.0f);
+				numStages++;
+			}
+			break;
+		}
 
-        output = wn + wn_1 * (*coef_ptr++);
-        output = output + wn_2 * (*coef_ptr++);      /* zeros */
+		case IIR_LOWSHELF:
+			A = powf(10.0f, gain_db / 40.0f);
+			sqrtA = sqrtf(A);
+			IIR_section(&pCoeffs[0], A * A, A * sqrtA / param, A, 1.0f, sqrtA / param, A, fc, fe, 1.0f);
+			numStages = 1;
+			break;
 
-        *wn_2_ptr++ = *wn_1_ptr;
-        *wn_1_ptr++ = wn;
-        wn_1_ptr++;
-        wn_2_ptr++;
-    }
-    *y = output;
-    return 0;
+		case IIR_HIGHSHELF:
+			A = powf(10.0f, gain_db / 40.0f);
+			sqrtA = sqrtf(A);
+			IIR_section(&pCoeffs[0], A, A * sqrtA / param, A * A, A, sqrtA / param, 1.0f, fc, fe, 1.0f);
+			numStages = 1;
+			break;
+
+		case IIR_PEAKING:
+			A = powf(10.0f, gain_db / 40.0f);
+			IIR_section(&pCoeffs[0], 1.0f, A / param, 1.0f, 1.0f, 1.0f / (A * param), 1.0f, fc, fe, 1.0f);
+			numStages = 1;
+			break;
+	}
+
+	return numStages;
 }
+
 //=====================================================================
 
+void IIR_init_f32(struct iir_TypeStruct *f, iir_type_t type, uint8_t order,
+                  float32_t fc, float32_t fe, float32_t param, float32_t gain_db)
+{
+	uint8_t numStages = IIR_design_f32(f->coeffs, type, order, fc, fe, param, gain_db);
+	arm_biquad_cascade_df2T_init_f32(&f->S, numStages, f->coeffs, f->state);
+}
+
+// Nouveau réglage sans remise à zéro de l'état (pas de clic),
+// sauf si le nombre de sections change
+void IIR_set_f32(struct iir_TypeStruct *f, iir_type_t type, uint8_t order,
+                 float32_t fc, float32_t fe, float32_t param, float32_t gain_db)
+{
+	uint8_t numStages = IIR_design_f32(f->coeffs, type, order, fc, fe, param, gain_db);
+	if (numStages != f->S.numStages)
+	{
+		arm_biquad_cascade_df2T_init_f32(&f->S, numStages, f->coeffs, f->state);
+	}
+}
+
+void IIR_process_block(struct iir_TypeStruct *f, float32_t *pSrc, float32_t *pDst, uint32_t blockSize)
+{
+	arm_biquad_cascade_df2T_f32(&f->S, pSrc, pDst, blockSize);
+}
 
+void IIR_reset_states(struct iir_TypeStruct *f)
+{
+	memset(f->state, 0, sizeof(f->state));
+}
 
+//=====================================================================
+
+void IIR_stereo_init_f32(struct iir_stereo_TypeStruct *f, iir_type_t type, uint8_t order,
+                         float32_t fc, float32_t fe, float32_t param, float32_t gain_db)
+{
+	uint8_t numStages = IIR_design_f32(f->coeffs, type, order, fc, fe, param, gain_db);
+	arm_biquad_cascade_stereo_df2T_init_f32(&f->S, numStages, f->coeffs, f->state);
+}
 
+void IIR_stereo_set_f32(struct iir_stereo_TypeStruct *f, iir_type_t type, uint8_t order,
+                        float32_t fc, float32_t fe, float32_t param, float32_t gain_db)
+{
+	uint8_t numStages = IIR_design_f32(f->coeffs, type, order, fc, fe, param, gain_db);
+	if (numStages != f->S.numStages)
+	{
+		arm_biquad_cascade_stereo_df2T_init_f32(&f->S, numStages, f->coeffs, f->state);
+	}
+}
+
+// pSrc/pDst entrelacés L,R : blockSize trames stéréo
+void IIR_stereo_process_block(struct iir_stereo_TypeStruct *f, float32_t *pSrc, float32_t *pDst, uint32_t blockSize)
+{
+	arm_biquad_cascade_stereo_df2T_f32(&f->S, pSrc, pDst, blockSize);
+}
+
+//=====================================================================
+// Conversion des coefficients flottants en Q31.
+// Retourne le postShift qui ramène le plus grand coefficient sous 1.
+
+static int8_t IIR_to_q31(const float32_t *pSrc, uint8_t numStages, q31_t *pDst)
+{
+	float32_t max = 0.0f, scale;
+	int8_t postShift = 0;
+	uint8_t i;
+
+	for (i = 0; i < 5 * numStages; i++)
+	{
+		if (fabsf(pSrc[i]) > max) max = fabsf(pSrc[i]);
+	}
+	while (max >= 1.0f && postShift < 4)
+	{
+		max *= 0.5f;
+		postShift++;
+	}
+	scale = 2147483648.0f / (float32_t)(1 << postShift);
+
+	for (i = 0; i < 5 * numStages; i++)
+	{
+		float32_t c = pSrc[i] * scale;
+		if (c >= 2147483647.0f) pDst[i] = 0x7FFFFFFF;
+		else if (c <= -2147483648.0f) pDst[i] = (q31_t)0x80000000;
+		else pDst[i] = (q31_t)c;
+	}
+	return postShift;
+}
+
+void IIR_init_q31(struct iir_q31_TypeStruct *f, iir_type_t type, uint8_t order,
+                  float32_t fc, float32_t fe, float32_t param, float32_t gain_db)
+{
+	float32_t coeffs[5 * IIR_MAX_STAGES];
+	uint8_t numStages = IIR_design_f32(coeffs, type, order, fc, fe, param, gain_db);
+	int8_t postShift = IIR_to_q31(coeffs, numStages, f->coeffs);
+
+	arm_biquad_cascade_df1_init_q31(&f->S, numStages, f->coeffs, f->state, postShift);
+}
+
+// Comme IIR_set_f32 : l'état n'est remis à zéro que si le nombre de sections change
+void IIR_set_q31(struct iir_q31_TypeStruct *f, iir_type_t type, uint8_t order,
+                 float32_t fc, float32_t fe, float32_t param, float32_t gain_db)
+{
+	float32_t coeffs[5 * IIR_MAX_STAGES];
+	uint8_t numStages = IIR_design_f32(coeffs, type, order, fc, fe, param, gain_db);
+	int8_t postShift = IIR_to_q31(coeffs, numStages, f->coeffs);
+
+	if (numStages != f->S.numStages)
+	{
+		arm_biquad_cascade_df1_init_q31(&f->S, numStages, f->coeffs, f->state, postShift);
+	}
+	f->S.postShift = postShift;
+}
+
+void IIR_process_block_q31(struct iir_q31_TypeStruct *f, q31_t *pSrc, q31_t *pDst, uint32_t blockSize)
+{
+	arm_biquad_cascade_df1_q31(&f->S, pSrc, pDst, blockSize);
+}
+
+// Entrée/sortie Q15 : conversion par tranches de 32 échantillons dans la pile
+void IIR_process_block_q15(struct iir_q31_TypeStruct *f, q15_t *pSrc, q15_t *pDst, uint32_t blockSize)
+{
+	q31_t work[32];
+	uint32_t n;
+
+	while (blockSize > 0)
+	{
+		n = (blockSize > 32) ? 32 : blockSize;
+		arm_q15_to_q31(pSrc, work, n);
+		arm_biquad_cascade_df1_q31(&f->S, work, work, n);
+		arm_q31_to_q15(work, pDst, n);
+		pSrc += n;
+		pDst += n;
+		blockSize -= n;
+	}
+}
@@ -3,80 +3,200 @@
  *
  *  Created on: Oct 6, 2022
  *      Author: kerhoas
+ *
+ *  Segments exponentiels à un pôle (une multiplication-addition par
+ *  échantillon). Le rendu d'un bloc calcule la durée restante du segment
+ *  courant, remplit cette plage sans test, puis change d'état.
  */
+#include "synth_opt.h"
 #include "adsr.h"
 #include <stdint.h>
-#pragma GCC optimize ("O0")
+
+// Tampon flottant du rendu Q15, converti par arm_float_to_q15
+#define ADSR_Q15_CHUNK 32
+
+static void adsr_segment_set(struct adsr_segment_TypeStruct* seg, float time_ms, uint32_t sample_rate,
+                             float target, float ratio);
+static uint32_t adsr_segment(const struct adsr_segment_TypeStruct* seg, float32_t* pLevel, float32_t end,
+                             float32_t* pDst, uint32_t blockSize, uint32_t* pDone);
+
+//=======================================================================================
+// Paramètres
+
+// Durée time_ms pour parcourir toute l'échelle (0 -> 1 ou 1 -> 0) ; l'asymptote
+// est placée à ratio au-delà du niveau visé pour que le segment se termine
+static void adsr_segment_set(struct adsr_segment_TypeStruct* seg, float time_ms, uint32_t sample_rate,
+                             float target, float ratio) {
+    float n = time_ms * sample_rate / 1000.0f;
+    float range = logf((1.0f + ratio) / ratio);
+
+    if (n < 1.0f) n = 1.0f;
+    seg->coef = expf(-range / n);
+    seg->target = target;
+    seg->base = target * (1.0f - seg->coef);
+    seg->inv_log_coef = -n / range;
+}
 
 void adsr_init(struct adsr_TypeStruct* adsr, uint32_t sample_rate) {
-    adsr->state = INIT;
-    adsr->current_level = 0.0f;
     adsr->sample_rate = sample_rate;
 
     // Utilise les constantes du .h
     adsr->sustain_level = SUSTAIN_LEVEL;
-    adsr->attack_time_ms = ATTACK_DURATION;
-    adsr->decay_time_ms = DECAY_DURATION;
-    adsr->release_time_ms = RELEASE_DURATION;
-
-    // Calcul des incréments
-    adsr->attack_increment = 1.0f / (adsr->attack_time_ms * sample_rate / 1000.0f);
-    adsr->decay_decrement = (1.0f - adsr->sustain_level) / (adsr->decay_time_ms * sample_rate / 1000.0f);
-    adsr->release_decrement = adsr->sustain_level / (adsr->release_time_ms * sample_rate / 1000.0f);
+    adsr_set_attack(adsr, ATTACK_DURATION);
+    adsr_set_decay(adsr, DECAY_DURATION);
+    adsr_set_release(adsr, RELEASE_DURATION);
+}
+
+void adsr_set_attack(struct adsr_TypeStruct* adsr, float time_ms) {
+    adsr->attack_time_ms = time_ms;
+    adsr_segment_set(&adsr->attack, time_ms, adsr->sample_rate, 1.0f + ADSR_ATTACK_RATIO, ADSR_ATTACK_RATIO);
+}
+
+void adsr_set_decay(struct adsr_TypeStruct* adsr, float time_ms) {
+    adsr->decay_time_ms = time_ms;
+    adsr_segment_set(&adsr->decay, time_ms, adsr->sample_rate, adsr->sustain_level - ADSR_DECAY_RATIO, ADSR_DECAY_RATIO);
+}
+
+void adsr_set_sustain(struct adsr_TypeStruct* adsr, float level) {
+    if (level < 0.0f) level = 0.0f;
+    if (level > 1.0f) level = 1.0f;
+    adsr->sustain_level = level;
+    adsr_set_decay(adsr, adsr->decay_time_ms);
+}
+
+void adsr_set_release(struct adsr_TypeStruct* adsr, float time_ms) {
+    adsr->release_time_ms = time_ms;
+    adsr_segment_set(&adsr->release, time_ms, adsr->sample_rate, -ADSR_DECAY_RATIO, ADSR_DECAY_RATIO);
+}
+
+//=======================================================================================
+// Banque d'enveloppes
+
+void adsr_bank_init(struct adsr_bank_TypeStruct* bank, const struct adsr_TypeStruct* params) {
+    uint32_t i;
+
+    bank->params = params;
+    for (i = 0; i < ADSR_BANK_SIZE; i++) {
+        bank->level[i] = 0.0f;
+        bank->state[i] = INIT;
+    }
 }
 
-void adsr_note_on(struct adsr_TypeStruct* adsr) {
-    adsr->state = ATTACK;
+// L'attaque repart du niveau courant (vol de voix sans clic)
+void adsr_note_on(struct adsr_bank_TypeStruct* bank, uint32_t i) {
+    bank->state[i] = ATTACK;
 }
 
-void adsr_note_off(struct adsr_TypeStruct* adsr) {
-    if (adsr->state != INIT && adsr->state != NOTE_OFF) {
-        adsr->state = RELEASE;
+void adsr_note_off(struct adsr_bank_TypeStruct* bank, uint32_t i) {
+    if (bank->state[i] != INIT && bank->state[i] != NOTE_OFF) {
+        bank->state[i] = RELEASE;
     }
 }
 
-float adsr(struct adsr_TypeStruct* adsr_s) {
-
-    switch (adsr_s->state) {
-
-        case INIT:
-            adsr_s->current_level = 0.0f;
-            break;
-
-        case NOTE_OFF:
-            adsr_s->current_level = 0.0f;
-            break;
-
-        case ATTACK:
-            adsr_s->current_level += adsr_s->attack_increment;
-            if (adsr_s->current_level >= 1.0f) {
-                adsr_s->current_level = 1.0f;
-                adsr_s->state = DECAY;
-            }
-            break;
-
-        case DECAY:
-            adsr_s->current_level -= adsr_s->decay_decrement;
-            if (adsr_s->current_level <= adsr_s->sustain_level) {
-                adsr_s->current_level = adsr_s->sustain_level;
-                adsr_s->state = SUSTAIN;
-            }
-            break;
-
-        case SUSTAIN:
-            adsr_s->current_level = adsr_s->sustain_level;
-            break;
-
-        case RELEASE:
-            adsr_s->current_level -= adsr_s->release_decrement;
-            if (adsr_s->current_level <= 0.0f) {
-                adsr_s->current_level = 0.0f;
-                adsr_s->state = INIT;
-            }
-            break;
+//=======================================================================================
+// Rendu
+
+// Rend au plus blockSize échantillons du segment jusqu'au franchissement de end.
+// Après k pas : level - target = (level0 - target) * coef^k, d'où la durée
+// restante ; le dernier échantillon est forcé à end et *pDone passe à 1.
+static uint32_t adsr_segment(const struct adsr_segment_TypeStruct* seg, float32_t* pLevel, float32_t end,
+                             float32_t* pDst, uint32_t blockSize, uint32_t* pDone) {
+    float32_t level = *pLevel;
+    float32_t coef = seg->coef;
+    float32_t base = seg->base;
+    float32_t r = (end - seg->target) / (level - seg->target);
+    uint32_t span = blockSize, done = 0, i;
+
+    if (!(r > 0.0f && r < 1.0f)) {
+        // end déjà franchi ou hors d'atteinte (sustain modifié pendant le decay)
+        span = 0;
+        done = 1;
+    } else {
+        float32_t k = logf(r) * seg->inv_log_coef;
+        if (k <= (float32_t)blockSize) {
+            span = (k > 1.0f) ? (uint32_t)ceilf(k) : 1;
+            done = 1;
+        }
+    }
+
+    for (i = 0; i + done < span; i++) {
+        level = base + level * coef;
+        pDst[i] = level;
     }
-    if (adsr_s->current_level < 0.0f) adsr_s->current_level = 0.0f;
-    if (adsr_s->current_level > 1.0f) adsr_s->current_level = 1.0f;
+    if (done) {
+        level = end;
+        if (span) pDst[span - 1] = level;
+    }
+
+    *pLevel = level;
+    *pDone = done;
+    return span;
+}
+
+void adsr_process_block(struct adsr_bank_TypeStruct* bank, uint32_t i, float32_t* pDst, uint32_t blockSize) {
+    const struct adsr_TypeStruct *p = bank->params;
+    float32_t level = bank->level[i];
+    uint8_t state = bank->state[i];
+    uint32_t n, done;
+
+    while (blockSize > 0) {
+        switch (state) {
+            case ATTACK:
+                n = adsr_segment(&p->attack, &level, 1.0f, pDst, blockSize, &done);
+                if (done) state = DECAY;
+                break;
 
-    return adsr_s->current_level;
+            case DECAY:
+                n = adsr_segment(&p->decay, &level, p->sustain_level, pDst, blockSize, &done);
+                if (done) state = SUSTAIN;
+                break;
+
+            case RELEASE:
+                n = adsr_segment(&p->release, &level, 0.0f, pDst, blockSize, &done);
+                if (done) state = INIT;
+                break;
+
+            case SUSTAIN:
+                n = blockSize;
+                if (level != p->sustain_level) {
+                    // sustain modulé : rampe linéaire sur le bloc plutôt qu'un saut
+                    float32_t step = (p->sustain_level - level) / n;
+                    uint32_t k;
+                    for (k = 0; k + 1 < n; k++) {
+                        level += step;
+                        pDst[k] = level;
+                    }
+                    level = p->sustain_level;
+                    pDst[n - 1] = level;
+                } else {
+                    arm_fill_f32(level, pDst, n);
+                }
+                break;
+
+            default:    // INIT, NOTE_OFF
+                level = 0.0f;
+                n = blockSize;
+                arm_fill_f32(0.0f, pDst, n);
+                break;
+        }
+        pDst += n;
+        blockSize -= n;
+    }
+
+    bank->level[i] = level;
+    bank->state[i] = state;
+}
+
+// Même rendu, converti par paquets (saturation à 0x7FFF pour 1.0)
+void adsr_process_block_q15(struct adsr_bank_TypeStruct* bank, uint32_t i, q15_t* pDst, uint32_t blockSize) {
+    float32_t chunk[ADSR_Q15_CHUNK];
+    uint32_t n;
+
+    while (blockSize > 0) {
+        n = (blockSize > ADSR_Q15_CHUNK) ? ADSR_Q15_CHUNK : blockSize;
+        adsr_process_block(bank, i, chunk, n);
+        arm_float_to_q15(chunk, pDst, n);
+        pDst += n;
+        blockSize -= n;
+    }
 }
@@ -0,0 +1,103 @@
+/*
+ * audio_buffer.c
+ *
+ *  Conversion en une passe entre les trames entrelacées du DMA et les
+ *  canaux L/R des étages de traitement. Chaque trame est lue ou écrite par
+ *  un seul accès 32 bits : (int16_t)w et w >> 16 donnent SXTH et ASR,
+ *  l'empaquetage utilise PKHBT / PKHTB.
+ */
+
+#include "synth_opt.h"
+#include "audio_buffer.h"
+
+#if defined(USE_HAL_DRIVER)
+#include "stm32f7_wm8994_init.h"
+#include "synth_memory.h"
+
+extern int16_t rx_buffer_proc, tx_buffer_proc;
+#endif
+
+#define AUDIO_Q15_TO_F32 (1.0f / 32768.0f)
+
+//=======================================================================================
+
+#if defined(USE_HAL_DRIVER)
+void audio_buffer_acquire(struct audio_view_TypeStruct* view) {
+    view->rx = (const uint32_t*)((rx_buffer_proc == PING) ? PING_IN : PONG_IN);
+    view->tx = (uint32_t*)((tx_buffer_proc == PING) ? PING_OUT : PONG_OUT);
+    view->frames = PING_PONG_BUFFER_SIZE;
+    synth_dma_invalidate((void*)view->rx, view->frames * sizeof(uint32_t));
+}
+
+void audio_buffer_release(struct audio_view_TypeStruct* view) {
+    synth_dma_clean(view->tx, view->frames * sizeof(uint32_t));
+}
+#endif
+
+//=======================================================================================
+// Entrelacé -> L/R
+
+void audio_deinterleave_f32(const uint32_t* pSrc, float32_t* pDstL, float32_t* pDstR, uint32_t frames) {
+    uint32_t i;
+
+    for (i = 0; i < frames; i++) {
+        int32_t w = (int32_t)*pSrc++;
+        *pDstL++ = (float32_t)(int16_t)w * AUDIO_Q15_TO_F32;
+        *pDstR++ = (float32_t)(w >> 16) * AUDIO_Q15_TO_F32;
+    }
+}
+
+void audio_deinterleave_q15(const uint32_t* pSrc, q15_t* pDstL, q15_t* pDstR, uint32_t frames) {
+    int32_t *pL = (int32_t*)pDstL;
+    int32_t *pR = (int32_t*)pDstR;
+    uint32_t i;
+
+    // Deux trames [R0:L0] [R1:L1] -> [L1:L0] et [R1:R0]
+    for (i = frames >> 1; i > 0; i--) {
+        int32_t w0 = (int32_t)*pSrc++;
+        int32_t w1 = (int32_t)*pSrc++;
+        *pL++ = __PKHBT(w0, w1, 16);
+        *pR++ = __PKHTB(w1, w0, 16);
+    }
+    if (frames & 1) {
+        int32_t w = (int32_t)*pSrc;
+        pDstL[frames - 1] = (q15_t)w;
+        pDstR[frames - 1] = (q15_t)(w >> 16);
+    }
+}
+
+//=======================================================================================
+// L/R -> entrelacé
+
+void audio_interleave_f32(const float32_t* pSrcL, const float32_t* pSrcR, uint32_t* pDst, float32_t gain, uint32_t frames) {
+    uint32_t i;
+
+    for (i = 0; i < frames; i++) {
+        int32_t l = __SSAT((int32_t)(*pSrcL++ * gain), 16);
+        int32_t r = __SSAT((int32_t)(*pSrcR++ * gain), 16);
+        *pDst++ = (uint32_t)__PKHBT(l, r, 16);
+    }
+}
+
+void audio_interleave_q15(const q15_t* pSrcL, const q15_t* pSrcR, uint32_t* pDst, uint32_t shift, uint32_t frames) {
+    const int32_t *pL = (const int32_t*)pSrcL;
+    const int32_t *pR = (const int32_t*)pSrcR;
+    uint32_t i, k;
+
+    // [L1:L0] et [R1:R0] -> [R0:L0] [R1:L1] ; __SHADD16(x, 0) = x >> 1 sur chaque moitié
+    for (i = frames >> 1; i > 0; i--) {
+        int32_t l = *pL++;
+        int32_t r = *pR++;
+        for (k = 0; k < shift; k++) {
+            l = (int32_t)__SHADD16(l, 0);
+            r = (int32_t)__SHADD16(r, 0);
+        }
+        *pDst++ = (uint32_t)__PKHBT(l, r, 16);
+        *pDst++ = (uint32_t)__PKHTB(r, l, 16);
+    }
+    if (frames & 1) {
+        int32_t l = pSrcL[frames - 1] >> shift;
+        int32_t r = pSrcR[frames - 1] >> shift;
+        *pDst = (uint32_t)__PKHBT(l, r, 16);
+    }
+}
@@ -5,8 +5,8 @@
  *      of it.
  * ----------------------------------------------------------
  */
+#include "synth_opt.h"
 #include <math.h>
-#pragma GCC optimize ("O0")
 
 void prewarp(
     float *a0, float *a1, float *a2,
@@ -0,0 +1,170 @@
+/*
+ * conv_reverb.c
+ *
+ *  Convolution partitionnée uniforme (overlap-save) dans le domaine fréquentiel.
+ *  Spectres au format compact de arm_rfft_fast_f32 : [DC, Nyquist, re1, im1, ...],
+ *  DC et Nyquist sont réels et multipliés à part.
+ */
+
+#include "synth_opt.h"
+#include "conv_reverb.h"
+#include "synth_memory.h"
+
+// Tampons de travail d'une partition (une seule instance active à la fois)
+static float32_t fft_buf[CONV_FFT_SIZE] SYNTH_DTCM;
+static float32_t acc_l[CONV_FFT_SIZE] SYNTH_DTCM;
+static float32_t acc_r[CONV_FFT_SIZE] SYNTH_DTCM;
+static float32_t prod[CONV_FFT_SIZE] SYNTH_DTCM;
+
+static void conv_load_partition(struct conv_reverb_TypeStruct* conv, float32_t* pSpectrum,
+                                const float32_t* pIr, uint32_t count);
+static void conv_spectral_mac(const float32_t* pX, const float32_t* pH, float32_t* pAcc);
+static void conv_partition(struct conv_reverb_TypeStruct* conv);
+
+//=======================================================================================
+
+void conv_reverb_init(struct conv_reverb_TypeStruct* conv, float32_t* pMemory, uint32_t partitions) {
+    uint32_t size = partitions * CONV_FFT_SIZE;
+
+    arm_rfft_fast_init_f32(&conv->fft, CONV_FFT_SIZE);
+    conv->partitions = partitions;
+    conv->spectra_l = pMemory;
+    conv->spectra_r = pMemory + size;
+    conv->fdl = pMemory + 2 * size;
+    conv->fdl_index = 0;
+    conv->pos = 0;
+    conv->mix = CONV_MIX_DEFAULT;
+    conv->mix_current = CONV_MIX_DEFAULT;
+
+    arm_fill_f32(0.0f, pMemory, CONV_MEMORY_SIZE(partitions));
+    arm_fill_f32(0.0f, conv->input, CONV_FFT_SIZE);
+    arm_fill_f32(0.0f, conv->out_l, CONV_PARTITION);
+    arm_fill_f32(0.0f, conv->out_r, CONV_PARTITION);
+}
+
+// Une partition de RI : B échantillons complétés par B zéros, puis FFT
+static void conv_load_partition(struct conv_reverb_TypeStruct* conv, float32_t* pSpectrum,
+                                const float32_t* pIr, uint32_t count) {
+    arm_fill_f32(0.0f, fft_buf, CONV_FFT_SIZE);
+    if (count > 0) arm_copy_f32((float32_t*)pIr, fft_buf, count);
+    arm_rfft_fast_f32(&conv->fft, fft_buf, pSpectrum, 0);
+}
+
+void conv_reverb_load_ir(struct conv_reverb_TypeStruct* conv, const float32_t* pIrL, const float32_t* pIrR, uint32_t len) {
+    uint32_t p, offset, count;
+
+    if (pIrR == NULL) pIrR = pIrL;
+    if (len > conv->partitions * CONV_PARTITION) len = conv->partitions * CONV_PARTITION;
+
+    for (p = 0; p < conv->partitions; p++) {
+        offset = p * CONV_PARTITION;
+        count = (offset < len) ? len - offset : 0;
+        if (count > CONV_PARTITION) count = CONV_PARTITION;
+        conv_load_partition(conv, conv->spectra_l + p * CONV_FFT_SIZE, pIrL + offset, count);
+        conv_load_partition(conv, conv->spectra_r + p * CONV_FFT_SIZE, pIrR + offset, count);
+    }
+}
+
+// Bruit blanc uniforme à décroissance exponentielle (-60 dB en rt60), généré
+// partition par partition : la RI complète n'est jamais stockée en temps
+void conv_reverb_load_synthetic(struct conv_reverb_TypeStruct* conv, float rt60, float fe) {
+    static float32_t ir[CONV_PARTITION];
+    uint32_t seed[2] = { 0x12345678u, 0x9E3779B9u };
+    float decay = powf(10.0f, -3.0f / (rt60 * fe));    // amplitude par échantillon
+    // énergie totale = amp^2 * (1/3) / (1 - decay^2) = 1
+    float amp0 = sqrtf(3.0f * (1.0f - decay * decay));
+    uint32_t p, i, c;
+
+    for (c = 0; c < 2; c++) {
+        float32_t *spectra = (c == 0) ? conv->spectra_l : conv->spectra_r;
+        float amp = amp0;
+
+        for (p = 0; p < conv->partitions; p++) {
+            for (i = 0; i < CONV_PARTITION; i++) {
+                // xorshift32 -> [-1, 1)
+                seed[c] ^= seed[c] << 13;
+                seed[c] ^= seed[c] >> 17;
+                seed[c] ^= seed[c] << 5;
+                ir[i] = amp * ((float)(int32_t)seed[c] * (1.0f / 2147483648.0f));
+                amp *= decay;
+            }
+            conv_load_partition(conv, spectra + p * CONV_FFT_SIZE, ir, CONV_PARTITION);
+        }
+    }
+}
+
+//=======================================================================================
+
+// pAcc += pX * pH (spectres compacts)
+static void conv_spectral_mac(const float32_t* pX, const float32_t* pH, float32_t* pAcc) {
+    pAcc[0] += pX[0] * pH[0];
+    pAcc[1] += pX[1] * pH[1];
+    arm_cmplx_mult_cmplx_f32((float32_t*)pX + 2, (float32_t*)pH + 2, prod + 2, CONV_FFT_SIZE / 2 - 1);
+    arm_add_f32(pAcc + 2, prod + 2, pAcc + 2, CONV_FFT_SIZE - 2);
+}
+
+// Une partition d'entrée complète : FFT, FDL, somme des produits, IFFT
+static void conv_partition(struct conv_reverb_TypeStruct* conv) {
+    uint32_t P = conv->partitions;
+    uint32_t p, slot;
+
+    // le spectre le plus récent prend la place du plus ancien
+    conv->fdl_index = (conv->fdl_index == 0) ? P - 1 : conv->fdl_index - 1;
+    arm_copy_f32(conv->input, fft_buf, CONV_FFT_SIZE);     // arm_rfft_fast_f32 écrase son entrée
+    arm_rfft_fast_f32(&conv->fft, fft_buf, conv->fdl + conv->fdl_index * CONV_FFT_SIZE, 0);
+    arm_copy_f32(conv->input + CONV_PARTITION, conv->input, CONV_PARTITION);
+
+    // Y = somme X(k - p) . H(p) ; la FDL est parcourue en deux segments, sans modulo
+    arm_fill_f32(0.0f, acc_l, CONV_FFT_SIZE);
+    arm_fill_f32(0.0f, acc_r, CONV_FFT_SIZE);
+    slot = conv->fdl_index;
+    for (p = 0; p < P; p++) {
+        const float32_t *x = conv->fdl + slot * CONV_FFT_SIZE;
+        conv_spectral_mac(x, conv->spectra_l + p * CONV_FFT_SIZE, acc_l);
+        conv_spectral_mac(x, conv->spectra_r + p * CONV_FFT_SIZE, acc_r);
+        if (++slot == P) slot = 0;
+    }
+
+    // overlap-save : seule la seconde moitié de l'IFFT est valide
+    arm_rfft_fast_f32(&conv->fft, acc_l, fft_buf, 1);
+    arm_copy_f32(fft_buf + CONV_PARTITION, conv->out_l, CONV_PARTITION);
+    arm_rfft_fast_f32(&conv->fft, acc_r, fft_buf, 1);
+    arm_copy_f32(fft_buf + CONV_PARTITION, conv->out_r, CONV_PARTITION);
+}
+
+void conv_reverb_process_block(struct conv_reverb_TypeStruct* conv, const float32_t* pSrc,
+                               float32_t* pDstL, float32_t* pDstR, uint32_t blockSize) {
+    float mix = conv->mix_current;
+    float mix_step = (conv->mix - mix) / blockSize;
+    uint32_t i, n;
+
+    while (blockSize > 0) {
+        n = CONV_PARTITION - conv->pos;
+        if (n > blockSize) n = blockSize;
+
+        for (i = 0; i < n; i++) {
+            float32_t x = pSrc[i];
+            conv->input[CONV_PARTITION + conv->pos + i] = x;
+            mix += mix_step;
+            pDstL[i] = x + mix * conv->out_l[conv->pos + i];
+            pDstR[i] = x + mix * conv->out_r[conv->pos + i];
+        }
+
+        conv->pos += n;
+        if (conv->pos == CONV_PARTITION) {
+            conv_partition(conv);
+            conv->pos = 0;
+        }
+        pSrc += n;
+        pDstL += n;
+        pDstR += n;
+        blockSize -= n;
+    }
+    conv->mix_current = conv->mix;
+}
+
+void conv_reverb_set_mix(struct conv_reverb_TypeStruct* conv, float mix) {
+    if (mix < 0.0f) mix = 0.0f;
+    if (mix > 1.0f) mix = 1.0f;
+    conv->mix = mix;
+}
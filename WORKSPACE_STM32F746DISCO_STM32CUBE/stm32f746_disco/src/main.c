@@ -1,80 +1,78 @@
-#include "FIR_coeff.h"
 #include "system_config.h"
 #include "arm_math.h"
-#include "FIR_filter.h"
-#include "IIR_filter.h"
 #include "stm32f7_wm8994_init.h"
 #include "main.h"
-#include "notes.h"
-#include "arm_math.h"
 #include "tickTimer.h"
-#include "signalTables.h"
-#include "reverb.h"
-#include "adsr.h"
-
-#pragma GCC optimize ("O0")
+#include "synth.h"
+#include "voice.h"
+#include "synth_profile.h"
+#include "audio_buffer.h"
+#include "synth_memory.h"
+#include "synth_telemetry.h"
+#include "sampler.h"
+#if defined(SYNTH_PROFILE_DWT)
+#include "stm32f7_display.h"
+#include "FIR_filter.h"
+#endif
+#if defined(SYNTH_RTOS)
+#include "synth_tasks.h"
+#endif
 
 // ============== Variables globales ==============
 
 USBH_HandleTypeDef hUSBHost;
-static uint8_t midiReceiveBuffer[MIDI_BUF_SIZE];
-static __IO uint32_t USBReceiveAvailable = 0;
+// Réception continue dans l'anneau de la classe MIDI, réarmée par le pilote
+static MIDI_ParserTypeDef midiParser;
 static AppState appState = APP_IDLE;
 
-extern int16_t rx_sample_L;
-extern int16_t rx_sample_R;
-extern int16_t tx_sample_L;
-extern int16_t tx_sample_R;
-
-// Variables synthétiseur
-float Fwave = 0.0f;
-uint8_t note_active = 0;
-uint8_t current_note = 0;
-float k = 1.0f;
+// Drapeaux ping-pong positionnés par les callbacks DMA (stm32f7_wm8994_init.c)
+extern volatile int32_t TX_buffer_empty;
+extern volatile int32_t RX_buffer_full;
 
-uint8_t note_pending = 0;
-uint8_t pending_active = 0;
+// Sorties d'un bloc de rendu (alignées : accès 32 bits par paire en q15)
+static synth_sample_t out_left[AUDIO_BLOCK_SIZE] __ALIGNED(4) SYNTH_DTCM;
+static synth_sample_t out_right[AUDIO_BLOCK_SIZE] __ALIGNED(4) SYNTH_DTCM;
 
-// Variables filtre FIR
-#define N_FILTER 64
-arm_fir_instance_f32 fir;
-float32_t firCoeffs[N_FILTER];
-float32_t firState[N_FILTER + N_FILTER - 1];
+// Écriture dans la moitié TX : pleine échelle de la chaîne -> 16384, saturée
+#if (SYNTH_FORMAT == SYNTH_FORMAT_Q15)
+#define SYNTH_TO_CODEC(pL, pR, pDst, n)  audio_interleave_q15(pL, pR, pDst, 1, n)
+#else
+#define SYNTH_TO_CODEC(pL, pR, pDst, n)  audio_interleave_f32(pL, pR, pDst, 16384.0f, n)
+#endif
 
-struct adsr_TypeStruct adsr_envelope;
-struct reverb_TypeStruct reverb_left;
-struct reverb_TypeStruct reverb_right;
-
-#define FILTER_COEFFS h_low_0_4500__f32
-#define CARRE_TABLE_SIZE 20
-#define TRIANGLE_TABLE_SIZE 20
-#define SAWTOOTH_TABLE_SIZE 20
+// Horodatage MIDI : horloge d'échantillons et tick HAL au dernier échange ping-pong.
+// swap_seq est impair pendant la mise à jour (lecteur préemptible sous SYNTH_RTOS)
+static volatile uint32_t swap_clock = 0;
+static volatile uint32_t swap_tick = 0;
+static volatile uint32_t swap_seq = 0;
 
 static void usbUserProcess(USBH_HandleTypeDef *pHost, uint8_t vId);
-static void midiApplication(void);
-void update_filter_cutoff(float note_freq);
+void midiApplication(void);
 void processMidiPackets(void);
-void init_synthesizer(void);
-void debug_adsr_visual(void);
-
-void update_filter_cutoff(float note_freq) {
-    float cutoff = k * note_freq;
-    if (cutoff > 4000.0f) cutoff = 4000.0f;
-    if (cutoff < 20.0f) cutoff = 20.0f;
-    FIR_calc_coeff_f32(&fir, N_FILTER, 0, cutoff, 44100.0f, 0);
-}
+void midi_post_packet(const uint8_t* packet, uint32_t tick);
+void process_buffer(void);
+void debug_adsr_visual(uint32_t nb_samples);
+void profile_service(void);
+static void telemetry_send(const struct synth_telemetry_record_TypeStruct* rec);
 
-void debug_adsr_visual() {
+void debug_adsr_visual(uint32_t nb_samples) {
     static uint32_t debug_counter = 0;
 
-    debug_counter++;
-    if (debug_counter % 22050 == 0) {
-        if(pending_active) {
-            if (debug_counter % 2205 == 0) BSP_LED_Toggle(LED1);
+    // Appelée une fois par buffer DMA : on teste le passage des périodes
+    // plutôt qu'une égalité stricte du compteur
+    debug_counter += nb_samples;
+    if (debug_counter % 22050 < nb_samples) {
+        // Plusieurs voix : clignotement, une seule voix : état de son enveloppe
+        if(voices.active_count > 1) {
+            BSP_LED_Toggle(LED1);
+        }
+        else if(voices.active_count == 0) {
+            BSP_LED_Off(LED1);
         }
         else {
-            switch(adsr_envelope.state) {
+            switch(voices.env.state[voices.active_list[0]]) {
                 case INIT:
+                case NOTE_OFF:
                     BSP_LED_Off(LED1);
                     break;
                 case ATTACK:
@@ -84,191 +82,97 @@ void debug_adsr_visual() {
                     BSP_LED_Toggle(LED1);
                     break;
                 case SUSTAIN:
-                    if (debug_counter % 44100 == 0) BSP_LED_Toggle(LED1);
+                    if (debug_counter % 44100 < nb_samples) BSP_LED_Toggle(LED1);
                     break;
                 case RELEASE:
-                    if (debug_counter % 11025 == 0) BSP_LED_Toggle(LED1);
+                    BSP_LED_Toggle(LED1);
                     break;
             }
         }
     }
 }
 
-void BSP_AUDIO_SAI_Interrupt_CallBack() {
-    static float phase = 0.0f;
-    static float step = 0.0f;
-    float32_t input, filtered_output, adsr_output, reverb_output_L, reverb_output_R;
-    float envelope_level;
-    int16_t sample;
-
-    if (Fwave > 0.0f) {
-        step = Fwave * CARRE_TABLE_SIZE / 44100.0f;
-        phase += step;
-        if (phase >= CARRE_TABLE_SIZE) {
-            phase -= CARRE_TABLE_SIZE;
-        }
-        sample = carre_int[(int)phase];
-    } else {
-        sample = 0;
-        phase = 0.0f;
+//###########################################
+// 				DMA
+//###########################################
+
+void process_buffer(void) // rend une moitié de buffer DMA, bloc par bloc
+{
+    struct audio_view_TypeStruct view;
+    uint32_t offset;
+
+    synth_telemetry_render_begin(SYNTH_TELEMETRY_NOW());
+    audio_buffer_acquire(&view);
+
+    // La moitié rendue ici sera jouée juste après celle qui part maintenant
+    swap_seq++;
+    swap_clock = synth_sample_clock();
+    swap_tick = HAL_GetTick();
+    swap_seq++;
+
+    // Chaque bloc est entrelacé directement dans la moitié TX que le DMA ne lit pas
+    for (offset = 0; offset < view.frames; offset += AUDIO_BLOCK_SIZE)
+    {
+        synth_render_block(out_left, out_right, AUDIO_BLOCK_SIZE);
+        SYNTH_TO_CODEC(out_left, out_right, view.tx + offset, AUDIO_BLOCK_SIZE);
     }
 
-    input = (float32_t)sample / 32768.0f;
-    arm_fir_f32(&fir, &input, &filtered_output, 1);
+    audio_buffer_release(&view);
+    synth_telemetry_render_end(SYNTH_TELEMETRY_NOW(), voices.active_count);
+    debug_adsr_visual(view.frames);
 
-    envelope_level = adsr(&adsr_envelope);
-    adsr_output = filtered_output * envelope_level;
-
-    reverb_output_L = reverb_process(&reverb_left, adsr_output);
-    reverb_output_R = reverb_process(&reverb_right, adsr_output);
-
-    debug_adsr_visual();
-
-    tx_sample_L = (int16_t)(reverb_output_L * 16384.0f);
-    tx_sample_R = (int16_t)(reverb_output_R * 16384.0f);
+    RX_buffer_full = 0;
+    TX_buffer_empty = 0;
 }
 
-void BSP_AUDIO_SAI_Interrupt_CallBack_TEST_ENVELOPE() {
-    static uint32_t test_counter = 0;
-    float envelope_level;
-    float final_output;
-
-    envelope_level = adsr(&adsr_envelope);
-    final_output = envelope_level * 0.8f;
-
-    test_counter++;
-    if (test_counter % 44100 == 0) {
-        BSP_LED_Toggle(LED1);
-    }
-
-    tx_sample_L = (int16_t)(final_output * 32767.0f);
-    tx_sample_R = tx_sample_L;
+// Les messages sont seulement horodatés et mis en file, synth_render_block()
+// les applique. Latence constante d'une moitié de buffer : un message reçu
+// t échantillons après l'échange est joué t échantillons après le début de
+// la moitié rendue à l'échange suivant (synth_midi_stamp, résolution 1 ms
+// du tick HAL).
+void midi_post_packet(const uint8_t* packet, uint32_t tick) {
+    uint32_t seq, clock, last_tick, elapsed = 0;
+    int32_t dt;
+
+    do {
+        seq = swap_seq;
+        clock = swap_clock;
+        last_tick = swap_tick;
+    } while ((seq & 1) || seq != swap_seq);
+
+    // Sous SYNTH_RTOS, un échange a pu avoir lieu depuis la réception
+    dt = (int32_t)(tick - last_tick);
+    if (dt > 0) elapsed = (uint32_t)dt * (uint32_t)SYNTH_SAMPLE_RATE / 1000u;
+
+    synth_midi_post(packet[1], packet[2], packet[3], synth_midi_stamp(clock, PING_PONG_BUFFER_SIZE, elapsed));
 }
 
+// Contexte USB (callback de réception ou tâche USB). Chaque tampon rempli est
+// décodé paquet par paquet selon son CIN puis rendu à l'anneau ; seuls les
+// messages de canal vont au synthé. Sous SYNTH_RTOS ils passent par la tâche
+// de contrôle
 void processMidiPackets() {
-    uint8_t *ptr = midiReceiveBuffer;
-    uint16_t numPackets = USBH_MIDI_GetLastReceivedDataSize(&hUSBHost) / 4;
-
-    while (numPackets--) {
-        ptr++;
-        uint8_t type = *ptr++ & 0xF0;
-        uint8_t note = *ptr++;
-        uint8_t velocity = *ptr++;
-
-        switch(type) {
-            case 0x90:
-                if(velocity > 0) {
-                    if(note_active) {
-                        adsr_note_off(&adsr_envelope);
-                        note_pending = note;
-                        pending_active = 1;
-                    } else {
-                        Fwave = table_freq[note];
-                        current_note = note;
-                        note_active = 1;
-                        update_filter_cutoff(Fwave);
-                        adsr_note_on(&adsr_envelope);
-                    }
-                } else {
-                    if(current_note == note) {
-                        note_active = 0;
-                        if(pending_active) {
-                            Fwave = table_freq[note_pending];
-                            current_note = note_pending;
-                            note_active = 1;
-                            update_filter_cutoff(Fwave);
-                            adsr_note_on(&adsr_envelope);
-                            pending_active = 0;
-                            note_pending = 0;
-                        } else {
-                            adsr_note_off(&adsr_envelope);
-                        }
-                    }
-                }
-                break;
-
-            case 0x80:
-                if(current_note == note) {
-                    note_active = 0;
-                    if(pending_active) {
-                        Fwave = table_freq[note_pending];
-                        current_note = note_pending;
-                        note_active = 1;
-                        update_filter_cutoff(Fwave);
-                        adsr_note_on(&adsr_envelope);
-                        pending_active = 0;
-                        note_pending = 0;
-                    } else {
-                        adsr_note_off(&adsr_envelope);
-                    }
-                }
-                else if(pending_active && note_pending == note) {
-                    pending_active = 0;
-                    note_pending = 0;
-                }
-                break;
-
-            case 0xB0:
-                if(note == 7) {
-                    k = 0.5f + (velocity / 127.0f) * 3.5f;
-                    if(note_active && Fwave > 0.0f) {
-                        update_filter_cutoff(Fwave);
-                    }
-                }
-                else if(note == 1) {
-                    float feedback_amount = (velocity / 127.0f) * 0.85f;
-                    reverb_set_feedback(&reverb_left, feedback_amount);
-                    reverb_set_feedback(&reverb_right, feedback_amount);
-                }
-                else if(note == 2) {
-                    adsr_envelope.decay_time_ms = 100.0f + (velocity / 127.0f) * 4900.0f;
-                    adsr_envelope.decay_decrement = (1.0f - adsr_envelope.sustain_level) / (adsr_envelope.decay_time_ms * adsr_envelope.sample_rate / 1000.0f);
-                }
-                else if(note == 3) {
-                    adsr_envelope.sustain_level = velocity / 127.0f;
-                    adsr_envelope.decay_decrement = (1.0f - adsr_envelope.sustain_level) / (adsr_envelope.decay_time_ms * adsr_envelope.sample_rate / 1000.0f);
-                    adsr_envelope.release_decrement = adsr_envelope.sustain_level / (adsr_envelope.release_time_ms * adsr_envelope.sample_rate / 1000.0f);
-                }
-                else if(note == 4) {
-                    adsr_envelope.release_time_ms = 100.0f + (velocity / 127.0f) * 4900.0f;
-                    adsr_envelope.release_decrement = adsr_envelope.sustain_level / (adsr_envelope.release_time_ms * adsr_envelope.sample_rate / 1000.0f);
-                }
-                break;
-
-            case 0xE0:
-                {
-                    uint16_t pitchbend_value = note | (velocity << 7);
-                    float pitchbend_normalized = pitchbend_value / 16383.0f;
-
-                    reverb_set_delay_mix(&reverb_left, pitchbend_normalized);
-                    reverb_set_delay_mix(&reverb_right, pitchbend_normalized);
-                }
-                break;
+    uint8_t *ptr;
+    uint16_t length;
+    uint32_t tick = HAL_GetTick();
+    midi_package_t msg;
+
+    while ((ptr = USBH_MIDI_GetRxBuffer(&hUSBHost, &length)) != NULL) {
+        for (; length >= 4; length -= 4, ptr += 4) {
+            if (USBH_MIDI_ParsePacket(&midiParser, ptr, &msg) != MIDI_PARSE_CHANNEL) continue;
+#if defined(SYNTH_RTOS)
+            synth_tasks_midi_rx((const uint8_t*)&msg, 1, tick);
+#else
+            midi_post_packet((const uint8_t*)&msg, tick);
+#endif
         }
+        USBH_MIDI_ReleaseRxBuffer(&hUSBHost);
     }
 }
 
 void USBH_MIDI_ReceiveCallback(USBH_HandleTypeDef *phost) {
+    UNUSED(phost);
     processMidiPackets();
-    USBReceiveAvailable = 1;
-}
-
-void init_synthesizer(void) {
-    Fwave = 0.0f;
-    note_active = 0;
-    current_note = 0;
-    k = 1.0f;
-
-    note_pending = 0;
-    pending_active = 0;
-
-    memset(firState, 0, sizeof(firState));
-    arm_fir_init_f32(&fir, N_FILTER, firCoeffs, firState, 1);
-    FIR_calc_coeff_f32(&fir, N_FILTER, 0, 1000.0f, 44100.0f, 0);
-
-    adsr_init(&adsr_envelope, 44100);
-    reverb_init(&reverb_left);
-    reverb_init(&reverb_right);
 }
 
 int main(void) {
@@ -282,14 +186,26 @@ int main(void) {
     BSP_PB_Init(BUTTON_KEY, BUTTON_MODE_GPIO);
     BSP_SDRAM_Init();
 
-    init_synthesizer();
+    synth_init();
+#if (SYNTH_SAMPLER)
+    // Banque QSPI et carte SD ; sans banque le canal 10 reste aux voix
+    sampler_storage_init(&sampler);
+#endif
+    synth_profile_init();
+    // budget d'une moitié ping-pong, en cycles
+    synth_telemetry_init((uint32_t)((float)SystemCoreClock / SYNTH_SAMPLE_RATE * PING_PONG_BUFFER_SIZE));
+#if defined(SYNTH_PROFILE_DWT)
+    synth_memory_bench();
+    FIR_bench();
+    init_LCD(0, "Synth - profil DWT", IO_METHOD_DMA, NOGRAPH);
+#endif
 
     USBH_Init(&hUSBHost, usbUserProcess, 0);
     USBH_RegisterClass(&hUSBHost, USBH_MIDI_CLASS);
     USBH_Start(&hUSBHost);
 
     stm32f7_wm8994_init(AUDIO_FREQUENCY_44K,
-                       IO_METHOD_INTR,
+                       IO_METHOD_DMA,
                        INPUT_DEVICE_INPUT_LINE_1,
                        OUTPUT_DEVICE_HEADPHONE,
                        WM8994_HP_OUT_ANALOG_GAIN_0DB,
@@ -297,9 +213,82 @@ int main(void) {
                        WM8994_DMIC_GAIN_9DB,
                        0, 0);
 
+#if defined(SYNTH_RTOS)
+    // Rendu, contrôle, USB et affichage dans leurs tâches (synth_tasks.c)
+    synth_tasks_start();
+#else
     while(1) {
         midiApplication();
-        USBH_Process(&hUSBHost);
+        SYNTH_PROFILE_COUNT(PROF_USB, 0, USBH_Process(&hUSBHost));
+
+        // DMA : le rendu ne bloque pas l'USB, on traite dès qu'une moitié est libre
+        if (TX_buffer_empty) {
+            process_buffer();
+        }
+
+        profile_service();
+    }
+#endif
+}
+
+//###########################################
+// 				PROFIL
+//###########################################
+
+// Toutes les 500 ms : enregistrement de télémétrie sur l'ITM (port 1) ; avec
+// SYNTH_PROFILE_DWT, vide l'anneau de mesures et rafraîchit l'overlay LCD.
+// À l'appui du bouton utilisateur, dump CSV sur l'ITM (console SWV, port 0) du
+// profil et, sous SYNTH_RTOS, des tâches, puis remise à zéro des statistiques
+void profile_service(void) {
+    static uint32_t was_pressed = 0;
+    static uint32_t last_refresh = 0;
+    uint32_t pressed = (BSP_PB_GetState(BUTTON_KEY) != RESET);
+    struct synth_telemetry_record_TypeStruct rec;
+#if defined(SYNTH_PROFILE_DWT)
+    // cycles disponibles pour un bloc de AUDIO_BLOCK_SIZE échantillons
+    uint32_t budget = (uint32_t)((float)SystemCoreClock / SYNTH_SAMPLE_RATE * AUDIO_BLOCK_SIZE);
+
+    synth_profile_poll();
+#endif
+
+    if (HAL_GetTick() - last_refresh >= TELEMETRY_PERIOD_MS) {
+        last_refresh = HAL_GetTick();
+        synth_telemetry_snapshot(&rec, last_refresh);
+        telemetry_send(&rec);
+#if defined(SYNTH_PROFILE_DWT)
+        displayProfile(synth_profile_names, synth_profile_stats(), PROF_STAGE_COUNT, budget, synth_profile_dropped());
+        displayTelemetry(&rec);
+#endif
+    }
+
+    // Front d'appui : pas d'attente active du relâchement
+    if (pressed && !was_pressed) {
+#if defined(SYNTH_PROFILE_DWT)
+        synth_profile_dump();
+        synth_profile_reset();
+#endif
+#if defined(SYNTH_RTOS)
+        synth_tasks_dump();
+#endif
+        synth_telemetry_reset();
+    }
+    was_pressed = pressed;
+}
+
+// Octets bruts sur un port de stimulus séparé du texte ; rien si le
+// débogueur n'a pas activé le port
+static void telemetry_send(const struct synth_telemetry_record_TypeStruct* rec) {
+    const uint8_t *p = (const uint8_t*)rec;
+    uint32_t i;
+
+    if ((ITM->TCR & ITM_TCR_ITMENA_Msk) == 0 || (ITM->TER & (1UL << TELEMETRY_ITM_PORT)) == 0) {
+        return;
+    }
+    for (i = 0; i < sizeof(*rec); i++) {
+        while (ITM->PORT[TELEMETRY_ITM_PORT].u32 == 0) {
+            __NOP();
+        }
+        ITM->PORT[TELEMETRY_ITM_PORT].u8 = p[i];
     }
 }
 
@@ -327,14 +316,13 @@ void usbUserProcess(USBH_HandleTypeDef *usbHost, uint8_t eventID) {
 void midiApplication(void) {
     switch (appState) {
     case APP_READY:
-        USBH_MIDI_Receive(&hUSBHost, midiReceiveBuffer, MIDI_BUF_SIZE);
-        appState = APP_RUNNING;
+        USBH_MIDI_ParserInit(&midiParser);
+        if (USBH_MIDI_StartReception(&hUSBHost) == USBH_OK) {
+            appState = APP_RUNNING;
+        }
         break;
     case APP_RUNNING:
-        if (USBReceiveAvailable) {
-            USBReceiveAvailable = 0;
-            USBH_MIDI_Receive(&hUSBHost, midiReceiveBuffer, MIDI_BUF_SIZE);
-        }
+        // Réarmement immédiat dans MIDI_ProcessReception
         break;
     case APP_DISCONNECT:
         appState = APP_IDLE;
@@ -9,7 +9,8 @@
 #include "notes.h"
 #include "arm_math.h"
 #include "tickTimer.h"
-#include "signalTables.h"
+#include "audio_buffer.h"
+#include "synth_memory.h"
 
 #define SOURCE_FILE_NAME "Titre Graphe"
 
@@ -31,17 +32,14 @@ float32_t h_average[5];
 uint8_t noteOn=0;
 uint8_t noteOff=0;
 
-arm_fir_instance_f32 ARM_FIR_F32;
-float32_t state_f32[N_FILTER];
-
 extern volatile int32_t TX_buffer_empty; // these may not need to be int32_t
 extern volatile int32_t RX_buffer_full; // they were extern volatile int16_t in F4 version
-extern int16_t rx_buffer_proc, tx_buffer_proc; // will be assigned token values PING or PONG
 void process_buffer(void);
 
-float32_t x[N_FILTER], y[PING_PONG_BUFFER_SIZE];
-float32_t xright[PING_PONG_BUFFER_SIZE], xleft[PING_PONG_BUFFER_SIZE], y[PING_PONG_BUFFER_SIZE], state[N_FILTER+PING_PONG_BUFFER_SIZE-1];
-arm_fir_instance_f32 S;
+// Un FIR par canal, filtrage sur place dans les vues désentrelacées
+arm_fir_instance_f32 fir_left, fir_right;
+float32_t xleft[PING_PONG_BUFFER_SIZE] SYNTH_DTCM, xright[PING_PONG_BUFFER_SIZE] SYNTH_DTCM;
+float32_t state_left[N_FILTER+PING_PONG_BUFFER_SIZE-1] SYNTH_DTCM, state_right[N_FILTER+PING_PONG_BUFFER_SIZE-1] SYNTH_DTCM;
 
 
 int main(void)
@@ -60,7 +58,8 @@ int main(void)
 	//#############################################
 	// 			FILTRE  INIT
 	//#############################################
-	 arm_fir_init_f32(&ARM_FIR_F32, N_FILTER, FILTER_COEFFS, state, PING_PONG_BUFFER_SIZE); // DMA
+	 arm_fir_init_f32(&fir_left, N_FILTER, FILTER_COEFFS, state_left, PING_PONG_BUFFER_SIZE); // DMA
+	 arm_fir_init_f32(&fir_right, N_FILTER, FILTER_COEFFS, state_right, PING_PONG_BUFFER_SIZE);
 	//#############################################
 
 	USBH_Init(&hUSBHost, usbUserProcess, 0);
@@ -95,30 +94,21 @@ int main(void)
 
 void process_buffer(void) // this function processes one DMA transfer block worth of data
 {
-  int i,k;
-  int16_t *rx_buf, *tx_buf;
+  struct audio_view_TypeStruct view;
 
-  if (rx_buffer_proc == PING) {rx_buf = (int16_t *)PING_IN;}
-  else {rx_buf = (int16_t *)PONG_IN;}
-  if (tx_buffer_proc == PING) {tx_buf = (int16_t *)PING_OUT;}
-  else {tx_buf = (int16_t *)PONG_OUT;}
-  BSP_LED_On(LED1);
+  audio_buffer_acquire(&view);
 
-  for (i=0 ; i<(PING_PONG_BUFFER_SIZE) ; i++)
-  {
-	  xleft[i] = *rx_buf++;
-	  xleft[i] = *rx_buf++;
-  }
+  // RX entrelacé -> L/R en une passe, filtrage stéréo sur place, L/R -> TX en une passe
+  audio_deinterleave_f32(view.rx, xleft, xright, view.frames);
 
   BSP_LED_On(LED1);
-  arm_fir_f32(&ARM_FIR_F32,xleft,y,PING_PONG_BUFFER_SIZE);
+  arm_fir_f32(&fir_left, xleft, xleft, view.frames);
+  arm_fir_f32(&fir_right, xright, xright, view.frames);
   BSP_LED_Off(LED1);
 
-  for (i=0 ; i<(PING_PONG_BUFFER_SIZE) ; i++)
-  {
-    *tx_buf++ = (short)(y[i]);
-    *tx_buf++ = (short)(y[i]);
-  }
+  audio_interleave_f32(xleft, xright, view.tx, 32768.0f, view.frames);
+  audio_buffer_release(&view);
+
   RX_buffer_full = 0;
   TX_buffer_empty = 0;
 }
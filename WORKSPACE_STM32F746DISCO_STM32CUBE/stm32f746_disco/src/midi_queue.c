@@ -0,0 +1,61 @@
+/*
+ * midi_queue.c
+ *
+ *  Anneau SPSC : push() n'écrit que head, peek()/pop() n'écrivent que tail.
+ *  La barrière garantit que l'événement est en mémoire avant la publication
+ *  de head (et qu'il est lu avant la libération de la case par tail).
+ */
+
+#include "midi_queue.h"
+
+#if defined(__arm__)
+#include "arm_math.h"
+#define MIDI_QUEUE_BARRIER()    __DMB()
+#else
+#define MIDI_QUEUE_BARRIER()    __sync_synchronize()
+#endif
+
+//=======================================================================================
+
+void midi_queue_init(struct midi_queue_TypeStruct* q) {
+    q->head = 0;
+    q->tail = 0;
+    q->dropped = 0;
+}
+
+// Producteur : retourne 0 (et compte l'événement perdu) si la file est pleine
+int midi_queue_push(struct midi_queue_TypeStruct* q, const midi_event_t* ev) {
+    uint32_t head = q->head;
+    uint32_t next = (head + 1) & (MIDI_QUEUE_SIZE - 1);
+
+    if (next == q->tail) {
+        q->dropped++;
+        return 0;
+    }
+    q->events[head] = *ev;
+    MIDI_QUEUE_BARRIER();
+    q->head = next;
+    return 1;
+}
+
+// Consommateur : copie l'événement le plus ancien sans le retirer, 0 si la file est vide
+int midi_queue_peek(struct midi_queue_TypeStruct* q, midi_event_t* ev) {
+    uint32_t tail = q->tail;
+
+    if (tail == q->head) {
+        return 0;
+    }
+    MIDI_QUEUE_BARRIER();
+    *ev = q->events[tail];
+    return 1;
+}
+
+void midi_queue_pop(struct midi_queue_TypeStruct* q) {
+    uint32_t tail = q->tail;
+
+    if (tail == q->head) {
+        return;
+    }
+    MIDI_QUEUE_BARRIER();
+    q->tail = (tail + 1) & (MIDI_QUEUE_SIZE - 1);
+}
@@ -0,0 +1,300 @@
+/*
+ * modulation.c
+ *
+ *  Sources, routage et lissage des destinations, évalués une fois par segment
+ *  de rendu : le coût ne dépend pas du nombre de messages MIDI reçus.
+ *  Lissage à un pôle sur un segment de n échantillons :
+ *      value = target + (value - target) * exp(-n / time)
+ *  (exp précalculé pour un bloc complet).
+ */
+
+#include "synth_opt.h"
+#include <math.h>
+#include <string.h>
+#include "modulation.h"
+#include "oscillator.h"
+#include "adsr.h"
+#include "reverb.h"
+#include "conv_reverb.h"
+#include "synth_memory.h"
+
+// Écart à la cible, en fraction de [min, max], en dessous duquel le lissage à un pôle s'arrête
+#define MOD_SETTLE 1e-4f
+
+#define MOD_PHASE_TO_RAD 1.4629180792671596e-9f     // 2 pi / 2^32
+
+#if (SYNTH_REVERB == SYNTH_REVERB_CONV)
+#define MOD_REVERB_MIX_DEFAULT CONV_MIX_DEFAULT
+#else
+#define MOD_REVERB_MIX_DEFAULT REVERB_MIX_DEFAULT
+#endif
+
+// ============== Variables globales ==============
+
+struct mod_TypeStruct modulation SYNTH_DTCM;
+
+struct mod_dest_default
+{
+    float init;                 // réglage par défaut du module piloté
+    float base;
+    float min;
+    float max;
+    float time_ms;
+    uint8_t smooth;
+};
+
+static const struct mod_dest_default mod_dest_defaults[MOD_DST_COUNT] = {
+    //  init                        base                    min     max       ms     lissage
+    { 1.0f,                         0.5f,                   0.25f,  8.0f,     20.0f, MOD_SMOOTH_ONEPOLE },  // CUTOFF
+    { 0.70710678f,                  0.5f,                   0.5f,   8.0f,     20.0f, MOD_SMOOTH_ONEPOLE },  // RESONANCE
+    { 1.0f,                         1.0f,                   0.0f,   1.0f,     5.0f,  MOD_SMOOTH_LINEAR },   // AMP
+    { REVERB_FEEDBACK_DEFAULT,      0.0f,                   0.0f,   0.98f,    50.0f, MOD_SMOOTH_ONEPOLE },  // REVERB_FEEDBACK
+    { MOD_REVERB_MIX_DEFAULT,       MOD_REVERB_MIX_DEFAULT, 0.0f,   1.0f,     20.0f, MOD_SMOOTH_LINEAR },   // REVERB_MIX
+    { (float)ATTACK_DURATION,       (float)ATTACK_DURATION, 1.0f,   10000.0f, 50.0f, MOD_SMOOTH_ONEPOLE },  // ATTACK
+    { (float)DECAY_DURATION,        100.0f,                 1.0f,   10000.0f, 50.0f, MOD_SMOOTH_ONEPOLE },  // DECAY
+    { (float)SUSTAIN_LEVEL,         0.0f,                   0.0f,   1.0f,     20.0f, MOD_SMOOTH_ONEPOLE },  // SUSTAIN
+    { (float)RELEASE_DURATION,      100.0f,                 1.0f,   10000.0f, 50.0f, MOD_SMOOTH_ONEPOLE },  // RELEASE
+    { 0.0f,                         0.0f,                   -24.0f, 24.0f,    5.0f,  MOD_SMOOTH_ONEPOLE },  // PITCH
+};
+
+// Correspondances CC -> paramètre reprises de l'ancien synth_midi_message()
+static const struct mod_route_TypeStruct mod_default_routes[] = {
+    { MOD_SRC_CC,        7,  MOD_DST_CUTOFF,          3.5f },
+    { MOD_SRC_CC,        71, MOD_DST_RESONANCE,       7.5f },
+    { MOD_SRC_CC,        1,  MOD_DST_REVERB_FEEDBACK, 0.85f },
+    { MOD_SRC_PITCHBEND, 0,  MOD_DST_PITCH,           MOD_PITCHBEND_RANGE },
+    { MOD_SRC_CC,        2,  MOD_DST_DECAY,           4900.0f },
+    { MOD_SRC_CC,        3,  MOD_DST_SUSTAIN,         1.0f },
+    { MOD_SRC_CC,        4,  MOD_DST_RELEASE,         4900.0f },
+};
+#define MOD_DEFAULT_ROUTES (sizeof(mod_default_routes) / sizeof(mod_default_routes[0]))
+
+static int mod_source_is_voice(uint8_t source);
+static float mod_clamp(const struct mod_param_TypeStruct* p, float value);
+static float mod_source(const struct mod_TypeStruct* mod, const struct mod_route_TypeStruct* route);
+static void mod_targets(const struct mod_TypeStruct* mod, float* pTarget);
+static void mod_count_voice_routes(struct mod_TypeStruct* mod);
+static void mod_param_advance(struct mod_param_TypeStruct* p, float target, uint32_t blockSize);
+
+//=======================================================================================
+
+static int mod_source_is_voice(uint8_t source) {
+    return (source == MOD_SRC_VELOCITY) || (source == MOD_SRC_ENVELOPE);
+}
+
+static float mod_clamp(const struct mod_param_TypeStruct* p, float value) {
+    if (value < p->min) value = p->min;
+    if (value > p->max) value = p->max;
+    return value;
+}
+
+// Valeur courante d'une source globale
+static float mod_source(const struct mod_TypeStruct* mod, const struct mod_route_TypeStruct* route) {
+    switch (route->source) {
+        case MOD_SRC_CC:        return mod->cc[route->cc & 0x7F];
+        case MOD_SRC_PITCHBEND: return mod->pitchbend;
+        case MOD_SRC_LFO1:      return mod->lfo[0].value;
+        case MOD_SRC_LFO2:      return mod->lfo[1].value;
+        default:                return 0.0f;
+    }
+}
+
+// Cibles de toutes les destinations, sources globales seulement
+static void mod_targets(const struct mod_TypeStruct* mod, float* pTarget) {
+    uint32_t i;
+
+    for (i = 0; i < MOD_DST_COUNT; i++) {
+        pTarget[i] = mod->param[i].base;
+    }
+    for (i = 0; i < MOD_ROUTE_COUNT; i++) {
+        const struct mod_route_TypeStruct *r = &mod->route[i];
+        if (r->source != MOD_SRC_NONE && !mod_source_is_voice(r->source)) {
+            pTarget[r->dest] += r->depth * mod_source(mod, r);
+        }
+    }
+    for (i = 0; i < MOD_DST_COUNT; i++) {
+        pTarget[i] = mod_clamp(&mod->param[i], pTarget[i]);
+    }
+}
+
+static void mod_count_voice_routes(struct mod_TypeStruct* mod) {
+    uint32_t i;
+
+    for (i = 0; i < MOD_DST_COUNT; i++) {
+        mod->param[i].voice_routes = 0;
+    }
+    for (i = 0; i < MOD_ROUTE_COUNT; i++) {
+        if (mod_source_is_voice(mod->route[i].source)) {
+            mod->param[mod->route[i].dest].voice_routes++;
+        }
+    }
+}
+
+//=======================================================================================
+
+void mod_init(struct mod_TypeStruct* mod) {
+    float target[MOD_DST_COUNT];
+    uint32_t i;
+
+    memset(mod, 0, sizeof(*mod));
+
+    for (i = 0; i < MOD_DST_COUNT; i++) {
+        const struct mod_dest_default *d = &mod_dest_defaults[i];
+        struct mod_param_TypeStruct *p = &mod->param[i];
+
+        p->base = d->base;
+        p->min = d->min;
+        p->max = d->max;
+        p->smooth = d->smooth;
+        p->time = d->time_ms * SYNTH_SAMPLE_RATE / 1000.0f;
+        p->coef_block = expf(-(float)AUDIO_BLOCK_SIZE / p->time);
+    }
+
+    // Positions initiales des sources : base + profondeur x position = réglage par défaut
+    for (i = 0; i < MOD_DEFAULT_ROUTES; i++) {
+        const struct mod_route_TypeStruct *r = &mod_default_routes[i];
+        float position = (mod_dest_defaults[r->dest].init - mod_dest_defaults[r->dest].base) / r->depth;
+
+        mod->route[i] = *r;
+        if (r->source == MOD_SRC_CC) {
+            mod->cc[r->cc] = position;
+        } else if (r->source == MOD_SRC_PITCHBEND) {
+            mod->pitchbend = position;
+        }
+    }
+    if (MOD_VIBRATO_DEPTH != 0.0f) {
+        mod->route[MOD_DEFAULT_ROUTES].source = MOD_SRC_LFO1;
+        mod->route[MOD_DEFAULT_ROUTES].dest = MOD_DST_PITCH;
+        mod->route[MOD_DEFAULT_ROUTES].depth = MOD_VIBRATO_DEPTH;
+    }
+    mod_count_voice_routes(mod);
+
+    mod_set_lfo_rate(mod, 0, MOD_LFO1_RATE_DEFAULT);
+    mod_set_lfo_rate(mod, 1, MOD_LFO2_RATE_DEFAULT);
+
+    // Pas de lissage au démarrage
+    mod_targets(mod, target);
+    for (i = 0; i < MOD_DST_COUNT; i++) {
+        struct mod_param_TypeStruct *p = &mod->param[i];
+        p->target = p->value = p->applied = target[i];
+        p->elapsed = MOD_COEFF_INTERVAL;
+    }
+}
+
+int mod_route_set(struct mod_TypeStruct* mod, uint32_t slot, mod_source_t source, uint8_t cc,
+                  mod_dest_t dest, float depth) {
+    struct mod_route_TypeStruct *r;
+
+    if (slot >= MOD_ROUTE_COUNT || source >= MOD_SRC_COUNT || dest >= MOD_DST_COUNT) return -1;
+    // Vélocité et enveloppe n'existent que dans le rendu d'une voix
+    if (mod_source_is_voice(source) && dest != MOD_DST_CUTOFF && dest != MOD_DST_AMP) return -1;
+
+    r = &mod->route[slot];
+    r->source = source;
+    r->cc = cc & 0x7F;
+    r->dest = dest;
+    r->depth = depth;
+    mod_count_voice_routes(mod);
+    return 0;
+}
+
+void mod_route_clear(struct mod_TypeStruct* mod, uint32_t slot) {
+    if (slot >= MOD_ROUTE_COUNT) return;
+    mod->route[slot].source = MOD_SRC_NONE;
+    mod_count_voice_routes(mod);
+}
+
+void mod_set_lfo_rate(struct mod_TypeStruct* mod, uint32_t i, float freq) {
+    if (i >= MOD_LFO_COUNT) return;
+    mod->lfo[i].increment = osc_phase_increment(freq, SYNTH_SAMPLE_RATE);
+}
+
+void mod_set_cc(struct mod_TypeStruct* mod, uint8_t cc, uint8_t value) {
+    mod->cc[cc & 0x7F] = (value & 0x7F) / 127.0f;
+}
+
+// 14 bits, 8192 au centre
+void mod_set_pitchbend(struct mod_TypeStruct* mod, uint16_t value) {
+    mod->pitchbend = ((int32_t)(value & 0x3FFF) - 8192) / 8192.0f;
+}
+
+//=======================================================================================
+
+// Une nouvelle cible relance la rampe linéaire pour une durée time
+static void mod_param_advance(struct mod_param_TypeStruct* p, float target, uint32_t blockSize) {
+    if (target != p->target) {
+        p->target = target;
+        p->step = (target - p->value) / p->time;
+    }
+
+    if (p->value != p->target) {
+        if (p->smooth == MOD_SMOOTH_LINEAR) {
+            float next = p->value + p->step * blockSize;
+            // cible atteinte ou dépassée
+            if (p->step == 0.0f || ((p->step > 0.0f) ? (next >= p->target) : (next <= p->target))) {
+                next = p->target;
+            }
+            p->value = next;
+        } else {
+            float c = (blockSize == AUDIO_BLOCK_SIZE) ? p->coef_block : expf(-(float)blockSize / p->time);
+            p->value = p->target + (p->value - p->target) * c;
+            if (fabsf(p->value - p->target) < MOD_SETTLE * (p->max - p->min)) {
+                p->value = p->target;
+            }
+        }
+    }
+
+    if (p->elapsed < MOD_COEFF_INTERVAL) p->elapsed += blockSize;
+}
+
+void mod_update(struct mod_TypeStruct* mod, uint32_t blockSize) {
+    float target[MOD_DST_COUNT];
+    uint32_t i;
+
+    // LFO : valeur en fin de segment, comme les destinations lissées
+    for (i = 0; i < MOD_LFO_COUNT; i++) {
+        struct mod_lfo_TypeStruct *lfo = &mod->lfo[i];
+        lfo->phase += lfo->increment * blockSize;
+        lfo->value = arm_sin_f32((float)lfo->phase * MOD_PHASE_TO_RAD);
+    }
+
+    mod_targets(mod, target);
+    for (i = 0; i < MOD_DST_COUNT; i++) {
+        mod_param_advance(&mod->param[i], target[i], blockSize);
+    }
+}
+
+float mod_value(const struct mod_TypeStruct* mod, mod_dest_t dest) {
+    return mod->param[dest].value;
+}
+
+float mod_voice_value(const struct mod_TypeStruct* mod, mod_dest_t dest, float velocity, float envelope) {
+    const struct mod_param_TypeStruct *p = &mod->param[dest];
+    float value = p->value;
+    uint32_t i;
+
+    if (p->voice_routes == 0) return value;
+
+    for (i = 0; i < MOD_ROUTE_COUNT; i++) {
+        const struct mod_route_TypeStruct *r = &mod->route[i];
+        if (r->dest != dest) continue;
+        if (r->source == MOD_SRC_VELOCITY) {
+            value += r->depth * velocity;
+        } else if (r->source == MOD_SRC_ENVELOPE) {
+            value += r->depth * envelope;
+        }
+    }
+    return mod_clamp(p, value);
+}
+
+int mod_due(struct mod_TypeStruct* mod, mod_dest_t dest) {
+    struct mod_param_TypeStruct *p = &mod->param[dest];
+
+    if (p->value == p->applied) return 0;
+    // Pendant le lissage, un recalcul par intervalle ; la valeur finale est appliquée dès qu'elle est atteinte
+    if (p->elapsed < MOD_COEFF_INTERVAL && p->value != p->target) return 0;
+
+    p->applied = p->value;
+    p->elapsed = 0;
+    return 1;
+}
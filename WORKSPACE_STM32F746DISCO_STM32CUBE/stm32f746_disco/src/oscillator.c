@@ -0,0 +1,263 @@
+/*
+ * oscillator.c
+ *
+ *  PolyBLEP / PolyBLAMP : la discontinuité de la forme naïve est corrigée
+ *  par un polynôme sur un échantillon de part et d'autre du saut, ce qui
+ *  supprime l'essentiel du repliement sans FIR en aval.
+ */
+
+#include "synth_opt.h"
+#include <stdlib.h>
+#include "oscillator.h"
+#include "synth_tables.h"
+
+#define PHASE_TO_FLOAT  2.3283064e-10f      // 2^-32
+
+// Sinus : index sur les bits de poids fort, fraction sur les SINE_SHIFT suivants
+#define SINE_SHIFT      (32 - SYNTH_SINE_TABLE_BITS)
+#define SINE_MASK       (SYNTH_SINE_TABLE_SIZE - 1)
+#define SINE_FRAC_MASK  ((1u << SINE_SHIFT) - 1)
+#define SINE_FRAC_SCALE (1.0f / (float32_t)(1u << SINE_SHIFT))
+
+#if (SINE_SHIFT < 15)
+#error "SYNTH_SINE_TABLE_BITS > 17 : fraction Q15 du sinus impossible"
+#endif
+
+static inline float32_t osc_polyblep(float32_t t, float32_t dt);
+static inline float32_t osc_polyblamp(float32_t t, float32_t dt);
+static inline int32_t osc_polyblep_q15(int32_t t, int32_t dt);
+static inline int32_t osc_polyblamp_q15(int32_t t, int32_t dt);
+static inline float32_t osc_sine(uint32_t phase);
+static inline int32_t osc_sine_q15(uint32_t phase);
+
+//=======================================================================================
+
+uint32_t osc_phase_increment(float32_t freq, float32_t fe) {
+    float32_t ratio = freq / fe;
+
+    if (ratio < 0.0f) ratio = 0.0f;
+    if (ratio > 0.5f) ratio = 0.5f;
+    return (uint32_t)(ratio * 4294967296.0f);
+}
+
+uint32_t osc_increment_scale(uint32_t increment, float32_t ratio) {
+    float32_t inc;
+
+    if (ratio == 1.0f) return increment;
+    inc = (float32_t)increment * ratio;
+    if (inc > 2147483648.0f) inc = 2147483648.0f;
+    if (inc < 0.0f) inc = 0.0f;
+    return (uint32_t)inc;
+}
+
+//=======================================================================================
+// Sinus tabulé, crête 16384 ; synth_sine_table[SIZE] = [0] évite le test de
+// bouclage de l'interpolation linéaire
+
+static inline float32_t osc_sine(uint32_t phase) {
+    uint32_t idx = phase >> SINE_SHIFT;
+    float32_t f = (float32_t)(phase & SINE_FRAC_MASK) * SINE_FRAC_SCALE;
+    float32_t y0 = synth_sine_table[idx];
+    float32_t y1 = synth_sine_table[idx + 1];
+#if (OSC_SINE_INTERP == OSC_INTERP_CUBIC)
+    float32_t ym1 = synth_sine_table[(idx - 1) & SINE_MASK];
+    float32_t y2 = synth_sine_table[(idx + 2) & SINE_MASK];
+    float32_t c1 = 0.5f * (y1 - ym1);
+    float32_t c2 = ym1 - 2.5f * y0 + 2.0f * y1 - 0.5f * y2;
+    float32_t c3 = 0.5f * (y2 - ym1) + 1.5f * (y0 - y1);
+
+    return ((c3 * f + c2) * f + c1) * f + y0;
+#else
+    return y0 + f * (y1 - y0);
+#endif
+}
+
+// Fraction en Q15 ; coefficients cubiques doublés (sans 0.5), petits pour un
+// sinus échantillonné : pas de débordement 32 bits
+static inline int32_t osc_sine_q15(uint32_t phase) {
+    uint32_t idx = phase >> SINE_SHIFT;
+    int32_t f = (int32_t)((phase & SINE_FRAC_MASK) >> (SINE_SHIFT - 15));
+    int32_t y0 = synth_sine_table[idx];
+    int32_t y1 = synth_sine_table[idx + 1];
+#if (OSC_SINE_INTERP == OSC_INTERP_CUBIC)
+    int32_t ym1 = synth_sine_table[(idx - 1) & SINE_MASK];
+    int32_t y2 = synth_sine_table[(idx + 2) & SINE_MASK];
+    int32_t c1 = y1 - ym1;
+    int32_t c2 = 2 * ym1 - 5 * y0 + 4 * y1 - y2;
+    int32_t c3 = (y2 - ym1) + 3 * (y0 - y1);
+
+    return y0 + (((((((c3 * f) >> 15) + c2) * f) >> 15) + c1) * f >> 16);
+#else
+    return y0 + (((y1 - y0) * f) >> 15);
+#endif
+}
+
+//=======================================================================================
+// t : phase normalisée [0, 1[, dt : incrément normalisé
+
+// Résidu d'un échelon unité à bande limitée (discontinuité en t = 0)
+static inline float32_t osc_polyblep(float32_t t, float32_t dt) {
+    if (t < dt) {
+        t = t / dt;
+        return t + t - t * t - 1.0f;
+    }
+    if (t > 1.0f - dt) {
+        t = (t - 1.0f) / dt;
+        return t * t + t + t + 1.0f;
+    }
+    return 0.0f;
+}
+
+// Résidu d'une rampe à bande limitée (rupture de pente en t = 0)
+static inline float32_t osc_polyblamp(float32_t t, float32_t dt) {
+    if (t < dt) {
+        t = t / dt - 1.0f;
+        return -t * t * t / 3.0f;
+    }
+    if (t > 1.0f - dt) {
+        t = (t - 1.0f) / dt + 1.0f;
+        return t * t * t / 3.0f;
+    }
+    return 0.0f;
+}
+
+//=======================================================================================
+
+void osc_render_block(osc_wave_t wave, uint32_t *pPhase, uint32_t increment, float32_t *pDst, uint32_t blockSize) {
+    uint32_t phase = *pPhase;
+    float32_t dt = (float32_t)increment * PHASE_TO_FLOAT;
+    float32_t t, t2, y;
+    uint32_t i;
+
+    switch (wave) {
+        case OSC_SAW:
+            for (i = 0; i < blockSize; i++) {
+                t = (float32_t)phase * PHASE_TO_FLOAT;
+                y = 2.0f * t - 1.0f - osc_polyblep(t, dt);
+                pDst[i] = OSC_AMPLITUDE * y;
+                phase += increment;
+            }
+            break;
+
+        case OSC_TRIANGLE:
+            // Sommets en t = 0 (creux) et t = 0.5 (crête), rupture de pente de 8 par période
+            for (i = 0; i < blockSize; i++) {
+                t = (float32_t)phase * PHASE_TO_FLOAT;
+                t2 = (float32_t)(phase + 0x80000000u) * PHASE_TO_FLOAT;
+                y = 4.0f * fabsf(t - 0.5f) - 1.0f;
+                y = -y + 4.0f * dt * (osc_polyblamp(t, dt) - osc_polyblamp(t2, dt));
+                pDst[i] = OSC_AMPLITUDE * y;
+                phase += increment;
+            }
+            break;
+
+        case OSC_SINE:
+            for (i = 0; i < blockSize; i++) {
+                pDst[i] = osc_sine(phase) * (OSC_AMPLITUDE / SYNTH_SINE_TABLE_PEAK);
+                phase += increment;
+            }
+            break;
+
+        case OSC_SQUARE:
+        default:
+            for (i = 0; i < blockSize; i++) {
+                t = (float32_t)phase * PHASE_TO_FLOAT;
+                t2 = (float32_t)(phase + 0x80000000u) * PHASE_TO_FLOAT;
+                y = (phase < 0x80000000u) ? 1.0f : -1.0f;
+                y += osc_polyblep(t, dt) - osc_polyblep(t2, dt);
+                pDst[i] = OSC_AMPLITUDE * y;
+                phase += increment;
+            }
+            break;
+    }
+
+    *pPhase = phase;
+}
+
+//=======================================================================================
+// Version virgule fixe : t et dt en Q16 (16 bits de poids fort de la phase),
+// résidus en Q15. La division n'a lieu que sur les deux échantillons
+// qui encadrent chaque discontinuité.
+
+static inline int32_t osc_polyblep_q15(int32_t t, int32_t dt) {
+    int32_t x;
+
+    if (t < dt) {
+        x = (t << 15) / dt;                         // [0, 1[
+        return x + x - ((x * x) >> 15) - 32768;
+    }
+    if (t > 65536 - dt) {
+        x = ((t - 65536) * 32768) / dt;             // ]-1, 0]
+        return ((x * x) >> 15) + x + x + 32768;
+    }
+    return 0;
+}
+
+static inline int32_t osc_polyblamp_q15(int32_t t, int32_t dt) {
+    int32_t x;
+
+    if (t < dt) {
+        x = ((t << 15) / dt) - 32768;               // ]-1, 0]
+        return -((((x * x) >> 15) * x) >> 15) / 3;
+    }
+    if (t > 65536 - dt) {
+        x = (((t - 65536) * 32768) / dt) + 32768;   // [0, 1[
+        return ((((x * x) >> 15) * x) >> 15) / 3;
+    }
+    return 0;
+}
+
+void osc_render_block_q15(osc_wave_t wave, uint32_t *pPhase, uint32_t increment, q15_t *pDst, uint32_t blockSize) {
+    uint32_t phase = *pPhase;
+    int32_t dt = (int32_t)(increment >> 16);
+    int32_t t, t2, y;
+    uint32_t i;
+
+    if (dt < 1) dt = 1;
+
+    // Amplitude OSC_AMPLITUDE = 0.5 : décalage d'un bit en sortie
+    switch (wave) {
+        case OSC_SAW:
+            for (i = 0; i < blockSize; i++) {
+                t = (int32_t)(phase >> 16);
+                y = t - 32768 - osc_polyblep_q15(t, dt);
+                pDst[i] = (q15_t)(y >> 1);
+                phase += increment;
+            }
+            break;
+
+        case OSC_TRIANGLE:
+            for (i = 0; i < blockSize; i++) {
+                t = (int32_t)(phase >> 16);
+                t2 = (int32_t)((phase + 0x80000000u) >> 16);
+                y = 32768 - 2 * abs(t - 32768);
+                // 4 dt (blamp(t) - blamp(t2)), dt en Q16
+                y += (dt * (osc_polyblamp_q15(t, dt) - osc_polyblamp_q15(t2, dt))) >> 14;
+                pDst[i] = (q15_t)__SSAT(y >> 1, 16);
+                phase += increment;
+            }
+            break;
+
+        case OSC_SINE:
+            // synth_sine_table[] a déjà une crête de 16384 (0.5 en Q15)
+            for (i = 0; i < blockSize; i++) {
+                pDst[i] = (q15_t)osc_sine_q15(phase);
+                phase += increment;
+            }
+            break;
+
+        case OSC_SQUARE:
+        default:
+            for (i = 0; i < blockSize; i++) {
+                t = (int32_t)(phase >> 16);
+                t2 = (int32_t)((phase + 0x80000000u) >> 16);
+                y = (t < 32768) ? 32768 : -32768;
+                y += osc_polyblep_q15(t, dt) - osc_polyblep_q15(t2, dt);
+                pDst[i] = (q15_t)__SSAT(y >> 1, 16);
+                phase += increment;
+            }
+            break;
+    }
+
+    *pPhase = phase;
+}
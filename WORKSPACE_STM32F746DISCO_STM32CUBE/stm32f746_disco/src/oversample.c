@@ -0,0 +1,138 @@
+/*
+ * oversample.c
+ *
+ *  Décimation 2:1 par demi-bande, forme repliée :
+ *    y[m] = 0.5 x[c] + somme_j g[j] (x[c + 2j+1] + x[c - 2j-1]),  c = 2m + 2K
+ *  sur un tampon [historique 4K-2 | entrées], comme l'état de arm_fir_f32.
+ *  Le tampon d'entrée est partagé : les voix sont rendues l'une après l'autre.
+ */
+
+#include "synth_opt.h"
+#include "oversample.h"
+#include "synth_memory.h"
+
+#if (OVERSAMPLE_FACTOR > 1)
+
+#define HB_HIST     (OVERSAMPLE_HB_TAPS(OVERSAMPLE_HB_K) - 1)
+#define HB4_HIST    (OVERSAMPLE_HB_TAPS(OVERSAMPLE_HB4_K) - 1)
+
+// Atténuation visée ~80 dB : beta = 0.1102 (A - 8.7)
+#define HB_KAISER_BETA  7.9f
+
+static synth_sample_t hb_work[HB_HIST + 2 * AUDIO_BLOCK_SIZE] SYNTH_DTCM;
+static synth_sample_t hb_coeffs[OVERSAMPLE_HB_K];
+#if (OVERSAMPLE_FACTOR == 4)
+static synth_sample_t hb4_work[HB4_HIST + 4 * AUDIO_BLOCK_SIZE] SYNTH_DTCM;
+static synth_sample_t hb4_coeffs[OVERSAMPLE_HB4_K];
+#endif
+
+static float32_t bessel_i0(float32_t x);
+static void halfband_design(synth_sample_t* pCoeffs, uint32_t K);
+static void halfband_decimate(const synth_sample_t* g, uint32_t K, const synth_sample_t* pSrc,
+                              synth_sample_t* pDst, uint32_t outSize);
+
+//=======================================================================================
+
+// Fonction de Bessel modifiée d'ordre 0 (série entière)
+static float32_t bessel_i0(float32_t x) {
+    float32_t sum = 1.0f, term = 1.0f, q = 0.25f * x * x;
+    uint32_t k;
+
+    for (k = 1; k < 32; k++) {
+        term *= q / (float32_t)(k * k);
+        sum += term;
+        if (term < 1e-9f * sum) break;
+    }
+    return sum;
+}
+
+// Sinus cardinal demi-bande sin(pi d / 2) / (pi d) aux décalages impairs d,
+// fenêtré par Kaiser ; somme des coefficients ramenée à 1 (gain unité en continu)
+static void halfband_design(synth_sample_t* pCoeffs, uint32_t K) {
+    float32_t g[OVERSAMPLE_HB_K];
+    float32_t L = 2.0f * K, inv_i0 = 1.0f / bessel_i0(HB_KAISER_BETA), sum = 0.0f;
+    uint32_t j;
+
+    for (j = 0; j < K; j++) {
+        float32_t d = (float32_t)(2 * j + 1);
+        float32_t r = d / L;
+        float32_t w = bessel_i0(HB_KAISER_BETA * sqrtf(1.0f - r * r)) * inv_i0;
+        g[j] = ((j & 1) ? -w : w) / (PI * d);
+        sum += g[j];
+    }
+    for (j = 0; j < K; j++) {
+        g[j] *= 0.25f / sum;
+    }
+#if (SYNTH_FORMAT == SYNTH_FORMAT_Q15)
+    arm_float_to_q15(g, pCoeffs, K);
+#else
+    arm_copy_f32(g, pCoeffs, K);
+#endif
+}
+
+void oversample_init(void) {
+    halfband_design(hb_coeffs, OVERSAMPLE_HB_K);
+#if (OVERSAMPLE_FACTOR == 4)
+    halfband_design(hb4_coeffs, OVERSAMPLE_HB4_K);
+#endif
+}
+
+void oversample_reset(struct oversample_TypeStruct* os) {
+    memset(os, 0, sizeof(*os));
+}
+
+synth_sample_t* oversample_input(void) {
+#if (OVERSAMPLE_FACTOR == 4)
+    return hb4_work + HB4_HIST;
+#else
+    return hb_work + HB_HIST;
+#endif
+}
+
+//=======================================================================================
+
+#if (SYNTH_FORMAT == SYNTH_FORMAT_Q15)
+// Produits 16 x 17 bits accumulés sur 64 bits, centre 0.5 = facteur 2^14
+static void halfband_decimate(const synth_sample_t* g, uint32_t K, const synth_sample_t* pSrc,
+                              synth_sample_t* pDst, uint32_t outSize) {
+    uint32_t m, j;
+
+    for (m = 0; m < outSize; m++) {
+        const q15_t *c = pSrc + 2 * m + 2 * K;
+        q63_t acc = (q63_t)c[0] * 16384;
+        for (j = 0; j < K; j++) {
+            acc += (q31_t)g[j] * ((q31_t)c[2 * j + 1] + c[-(int32_t)(2 * j + 1)]);
+        }
+        pDst[m] = (q15_t)__SSAT((q31_t)(acc >> 15), 16);
+    }
+}
+#else
+static void halfband_decimate(const synth_sample_t* g, uint32_t K, const synth_sample_t* pSrc,
+                              synth_sample_t* pDst, uint32_t outSize) {
+    uint32_t m, j;
+
+    for (m = 0; m < outSize; m++) {
+        const float32_t *c = pSrc + 2 * m + 2 * K;
+        float32_t acc = 0.5f * c[0];
+        for (j = 0; j < K; j++) {
+            acc += g[j] * (c[2 * j + 1] + c[-(int32_t)(2 * j + 1)]);
+        }
+        pDst[m] = acc;
+    }
+}
+#endif
+
+// Les entrées ont été rendues dans oversample_input() ; l'historique de la
+// voix est replacé devant, puis les 4K-2 dernières entrées sont sauvegardées
+void oversample_decimate(struct oversample_TypeStruct* os, synth_sample_t* pDst, uint32_t blockSize) {
+#if (OVERSAMPLE_FACTOR == 4)
+    memcpy(hb4_work, os->hist4, sizeof(os->hist4));
+    halfband_decimate(hb4_coeffs, OVERSAMPLE_HB4_K, hb4_work, hb_work + HB_HIST, 2 * blockSize);
+    memcpy(os->hist4, hb4_work + 4 * blockSize, sizeof(os->hist4));
+#endif
+    memcpy(hb_work, os->hist, sizeof(os->hist));
+    halfband_decimate(hb_coeffs, OVERSAMPLE_HB_K, hb_work, pDst, blockSize);
+    memcpy(os->hist, hb_work + 2 * blockSize, sizeof(os->hist));
+}
+
+#endif /* OVERSAMPLE_FACTOR > 1 */
@@ -1,43 +1,186 @@
+/*
+ * reverb.c
+ *
+ *  FDN à 8 lignes. Pour chaque échantillon :
+ *      x_i = ligne_i[n - d_i]                 (lecture masquée)
+ *      L = somme sL_i x_i, R = somme sR_i x_i (vecteurs orthogonaux : décorrélation)
+ *      y_i = g_i * passe-bas(x_i)             (amortissement des aigus)
+ *      ligne_i[n] = (H y)_i + entrée          (H : Hadamard 8x8 normalisée)
+ *  g_i = feedback^(d_i / REVERB_DELAY_REF) : même décroissance par seconde
+ *  pour toutes les lignes, boucle stable pour feedback < 1, sans écrêtage interne.
+ *  Un changement de mix est interpolé linéairement sur le bloc suivant.
+ */
+
+#include "synth_opt.h"
+#include <math.h>
 #include "reverb.h"
-#pragma GCC optimize ("O0")
 
-void reverb_init(struct reverb_TypeStruct* reverb) {
-    for(int i = 0; i < REVERB_DELAY_MAX; i++) {
-        reverb->delay_buffer[i] = 0.0f;
+#define HADAMARD_NORM 0.35355339f       // 1 / sqrt(REVERB_LINES)
+
+// Longueurs premières entre elles (23 à 66 ms à 44,1 kHz)
+static const uint16_t reverb_delays[REVERB_LINES] = {
+    1051, 1307, 1571, 1787, 2053, 2311, 2557, 2903
+};
+
+// Signes des prises de sortie : lignes 1 et 2 de la matrice de Hadamard
+static const int8_t tap_left[REVERB_LINES]  = { 1, -1,  1, -1,  1, -1,  1, -1 };
+static const int8_t tap_right[REVERB_LINES] = { 1,  1, -1, -1,  1,  1, -1, -1 };
+
+static void reverb_update_gains(struct reverb_TypeStruct* reverb);
+
+//=======================================================================================
+
+void reverb_init(struct reverb_TypeStruct* reverb, synth_sample_t* pLines) {
+    uint32_t i;
+
+    reverb->lines = pLines;
+    for(i = 0; i < REVERB_LINES * REVERB_LINE_SIZE; i++) {
+        reverb->lines[i] = 0;
     }
 
     reverb->write_index = 0;
-    reverb->delay_samples = REVERB_DELAY_MAX;
-    reverb->feedback_gain = 0.8f;
-    reverb->delay_mix = 0.9f;
+    for(i = 0; i < REVERB_LINES; i++) {
+        reverb->delay[i] = reverb_delays[i];
+        reverb->damp_state[i] = 0;
+    }
+    reverb->feedback_gain = REVERB_FEEDBACK_DEFAULT;
+    reverb->delay_mix = REVERB_MIX_DEFAULT;
+    reverb->wet = REVERB_MIX_DEFAULT * HADAMARD_NORM;
+    reverb->damping = REVERB_DAMPING_DEFAULT;
+    reverb_update_gains(reverb);
+}
+
+static void reverb_update_gains(struct reverb_TypeStruct* reverb) {
+    for(uint32_t i = 0; i < REVERB_LINES; i++) {
+        reverb->gain[i] = powf(reverb->feedback_gain, reverb->delay[i] / REVERB_DELAY_REF);
+    }
+}
+
+//=======================================================================================
+
+#if (SYNTH_FORMAT == SYNTH_FORMAT_Q15)
+void reverb_process_block(struct reverb_TypeStruct* reverb, const synth_sample_t* pSrc,
+                          synth_sample_t* pDstL, synth_sample_t* pDstR, uint32_t blockSize) {
+    synth_sample_t *lines = reverb->lines;
+    uint32_t w = reverb->write_index;
+    q31_t gain[REVERB_LINES], x[REVERB_LINES], y[REVERB_LINES], a, b;
+    q31_t damp = (q31_t)((1.0f - reverb->damping) * 32767.0f);
+    q31_t wet_acc, wet_step, wet;
+    q31_t norm = (q31_t)(HADAMARD_NORM * 32767.0f);
+    uint32_t i, k, h;
+
+    if(blockSize == 0) return;
+
+    // gain humide sur 16 bits de plus pour la rampe
+    wet_acc = (q31_t)(reverb->wet * 32767.0f) << 16;
+    wet_step = (((q31_t)(reverb->delay_mix * HADAMARD_NORM * 32767.0f) << 16) - wet_acc) / (q31_t)blockSize;
+
+    for(k = 0; k < REVERB_LINES; k++) {
+        gain[k] = (q31_t)(reverb->gain[k] * 32767.0f);
+    }
+
+    for(i = 0; i < blockSize; i++) {
+        q31_t input = pSrc[i];
+        q31_t out_l = 0, out_r = 0;
+
+        for(k = 0; k < REVERB_LINES; k++) {
+            x[k] = lines[k * REVERB_LINE_SIZE + ((w - reverb->delay[k]) & REVERB_LINE_MASK)];
+            out_l += tap_left[k] * x[k];
+            out_r += tap_right[k] * x[k];
+
+            // passe-bas à un pôle, état sur 32 bits pour éviter les cycles limites ;
+            // l'écart de deux valeurs proches de la pleine échelle dépasse 32 bits
+            reverb->damp_state[k] += (q31_t)((((int64_t)x[k] * 65536 - (int64_t)reverb->damp_state[k]) * damp) >> 15);
+            y[k] = ((reverb->damp_state[k] >> 16) * gain[k]) >> 15;
+        }
+
+        // Hadamard rapide : 3 étages de papillons
+        for(h = 1; h < REVERB_LINES; h <<= 1) {
+            for(k = 0; k < REVERB_LINES; k += h << 1) {
+                for(uint32_t j = k; j < k + h; j++) {
+                    a = y[j];
+                    b = y[j + h];
+                    y[j] = a + b;
+                    y[j + h] = a - b;
+                }
+            }
+        }
+
+        for(k = 0; k < REVERB_LINES; k++) {
+            // somme de 8 lignes : jusqu'à 2^18, produit sur 64 bits
+            lines[k * REVERB_LINE_SIZE + w] = (q15_t)__SSAT((q31_t)(((int64_t)y[k] * norm) >> 15) + input, 16);
+        }
+
+        wet_acc += wet_step;
+        wet = wet_acc >> 16;
+        pDstL[i] = (q15_t)__SSAT(input + (q31_t)(((int64_t)out_l * wet) >> 15), 16);
+        pDstR[i] = (q15_t)__SSAT(input + (q31_t)(((int64_t)out_r * wet) >> 15), 16);
+
+        w = (w + 1) & REVERB_LINE_MASK;
+    }
+
+    reverb->write_index = w;
+    reverb->wet = reverb->delay_mix * HADAMARD_NORM;
 }
+#else
+void reverb_process_block(struct reverb_TypeStruct* reverb, const synth_sample_t* pSrc,
+                          synth_sample_t* pDstL, synth_sample_t* pDstR, uint32_t blockSize) {
+    synth_sample_t *lines = reverb->lines;
+    uint32_t w = reverb->write_index;
+    float x[REVERB_LINES], y[REVERB_LINES], a, b;
+    float damping = reverb->damping;
+    float wet = reverb->wet;
+    float wet_step = (reverb->delay_mix * HADAMARD_NORM - wet) / blockSize;
+    uint32_t i, k, h;
+
+    for(i = 0; i < blockSize; i++) {
+        float input = pSrc[i];
+        float out_l = 0.0f, out_r = 0.0f;
+
+        for(k = 0; k < REVERB_LINES; k++) {
+            x[k] = lines[k * REVERB_LINE_SIZE + ((w - reverb->delay[k]) & REVERB_LINE_MASK)];
+            out_l += tap_left[k] * x[k];
+            out_r += tap_right[k] * x[k];
 
-float reverb_process(struct reverb_TypeStruct* reverb, float input) {
-    uint16_t read_index = (reverb->write_index - reverb->delay_samples + REVERB_DELAY_MAX) % REVERB_DELAY_MAX;
-
-    float delayed_signal = reverb->delay_buffer[read_index];
-    float u = input + (reverb->feedback_gain * delayed_signal);
-    
-    if(u > 1.0f) u = 1.0f;
-    if(u < -1.0f) u = -1.0f;
-
-    reverb->delay_buffer[reverb->write_index] = u;
-    
-    float delay_output = delayed_signal * reverb->delay_mix;
-    float output = input + delay_output;
-    
-    reverb->write_index = (reverb->write_index + 1) % REVERB_DELAY_MAX;
-    
-    if(output > 1.0f) output = 1.0f;
-    if(output < -1.0f) output = -1.0f;
-    
-    return output;
+            reverb->damp_state[k] = x[k] + damping * (reverb->damp_state[k] - x[k]);
+            y[k] = reverb->damp_state[k] * reverb->gain[k];
+        }
+
+        // Hadamard rapide : 3 étages de papillons
+        for(h = 1; h < REVERB_LINES; h <<= 1) {
+            for(k = 0; k < REVERB_LINES; k += h << 1) {
+                for(uint32_t j = k; j < k + h; j++) {
+                    a = y[j];
+                    b = y[j + h];
+                    y[j] = a + b;
+                    y[j + h] = a - b;
+                }
+            }
+        }
+
+        for(k = 0; k < REVERB_LINES; k++) {
+            lines[k * REVERB_LINE_SIZE + w] = y[k] * HADAMARD_NORM + input;
+        }
+
+        wet += wet_step;
+        pDstL[i] = input + out_l * wet;
+        pDstR[i] = input + out_r * wet;
+
+        w = (w + 1) & REVERB_LINE_MASK;
+    }
+
+    reverb->write_index = w;
+    reverb->wet = reverb->delay_mix * HADAMARD_NORM;
 }
+#endif
+
+//=======================================================================================
 
 void reverb_set_feedback(struct reverb_TypeStruct* reverb, float feedback) {
     if(feedback < 0.0f) feedback = 0.0f;
     if(feedback > 0.98f) feedback = 0.98f;
     reverb->feedback_gain = feedback;
+    reverb_update_gains(reverb);
 }
 
 void reverb_set_delay_mix(struct reverb_TypeStruct* reverb, float delay_mix) {
@@ -45,3 +188,10 @@ void reverb_set_delay_mix(struct reverb_TypeStruct* reverb, float delay_mix) {
     if(delay_mix > 1.0f) delay_mix = 1.0f;
     reverb->delay_mix = delay_mix;
 }
+
+// 0 : pas d'amortissement, proche de 1 : queue très sombre
+void reverb_set_damping(struct reverb_TypeStruct* reverb, float damping) {
+    if(damping < 0.0f) damping = 0.0f;
+    if(damping > 0.95f) damping = 0.95f;
+    reverb->damping = damping;
+}
@@ -0,0 +1,670 @@
+/*
+ * sampler.c
+ *
+ *  Lecteur d'échantillons (voir sampler.h). Une zone QSPI est lue en place
+ *  dans la fenêtre mappée ; une zone SD est lue dans sa tête QSPI puis dans
+ *  l'anneau SDRAM de la voix, rempli par la chaîne de lectures DMA.
+ *
+ *  Le rendu lit les échantillons par segments contigus (tête, anneau jusqu'à
+ *  son bouclage ou aux dernières données reçues, zone jusqu'à sa fin de
+ *  boucle) : la boucle interne n'a pas de test, seul l'échantillon dont le
+ *  voisin est hors du segment passe par sampler_sample_at().
+ *
+ *  Partage avec l'interruption de fin de lecture : le rendu publie
+ *  stream_read et stream_speed de chaque voix, la fin de lecture avance
+ *  stream_end. Une voix réaffectée change de stream_gen : une lecture
+ *  lancée pour l'ancienne note est jetée à son arrivée.
+ */
+
+#include <string.h>
+#include "synth_opt.h"
+#include "synth.h"
+#include "sampler.h"
+#include "synth_memory.h"
+#if defined(USE_HAL_DRIVER)
+#include "main.h"
+#endif
+
+#if (SYNTH_SAMPLER)
+
+#if defined(__arm__)
+#define SAMPLER_BARRIER()       __DMB()
+#else
+#define SAMPLER_BARRIER()       __sync_synchronize()
+#endif
+
+// Section critique contre la fin de lecture (interruptions SDMMC et DMA)
+#if defined(USE_HAL_DRIVER)
+#define SAMPLER_LOCK(m)         do { (m) = __get_PRIMASK(); __disable_irq(); } while (0)
+#define SAMPLER_UNLOCK(m)       __set_PRIMASK(m)
+#else
+#define SAMPLER_LOCK(m)         ((m) = 0)
+#define SAMPLER_UNLOCK(m)       ((void)(m))
+#endif
+
+#define SAMPLER_NONE            0xFFu
+#define SAMPLER_FRAC_TO_FLOAT   2.3283064e-10f      // 2^-32
+#define SAMPLER_PCM_SCALE       (1.0f / 32768.0f)
+#define SAMPLER_RING_MASK       (SAMPLER_RING_SAMPLES - 1)
+#define SAMPLER_HEAD_BLOCKS     (SAMPLER_STREAM_HEAD / SAMPLER_SD_BLOCK_SAMPLES)
+#define SAMPLER_BLOCK_BYTES     (SAMPLER_SD_BLOCK_SAMPLES * 2)
+
+// Pire attente d'un flux éligible, en échantillons source : SAMPLER_VOICES
+// lectures devant lui et une moitié ping-pong avant la relance
+#define SAMPLER_WAIT_SAMPLES    ((uint32_t)SAMPLER_PITCH_MAX * \
+                                 ((uint32_t)SYNTH_SAMPLE_RATE / 1000u * SAMPLER_VOICES * SAMPLER_SD_READ_US / 1000u + \
+                                  SAMPLER_KICK_SAMPLES))
+
+_Static_assert(sizeof(struct sampler_zone_TypeStruct) == 28, "format du répertoire de la banque");
+_Static_assert(SAMPLER_STREAM_HEAD >= SAMPLER_WAIT_SAMPLES,
+               "SAMPLER_STREAM_HEAD ne couvre pas l'amorçage d'un flux");
+_Static_assert(SAMPLER_RING_SAMPLES - SAMPLER_READ_BLOCKS * SAMPLER_SD_BLOCK_SAMPLES >= SAMPLER_WAIT_SAMPLES,
+               "SAMPLER_RING_BLOCKS ne couvre pas l'attente d'une lecture");
+_Static_assert((uint64_t)SAMPLER_KICK_SAMPLES * 1000000u / (uint32_t)SYNTH_SAMPLE_RATE > SAMPLER_SD_READ_US,
+               "SAMPLER_READ_DEADLINE avant la fin d'une lecture normale");
+_Static_assert((uint32_t)SAMPLER_PITCH_MAX * (uint32_t)SYNTH_SAMPLE_RATE / 1000u * SAMPLER_VOICES * SAMPLER_SD_READ_US / 1000u
+               <= SAMPLER_READ_BLOCKS * SAMPLER_SD_BLOCK_SAMPLES,
+               "débit SD insuffisant pour SAMPLER_VOICES flux");
+
+// ============== Variables globales ==============
+
+struct sampler_TypeStruct sampler SYNTH_DTCM;
+
+// Anneaux des flux : SDRAM write-back, écrits par le DMA du SDMMC seulement
+static int16_t sampler_rings[SAMPLER_VOICES][SAMPLER_RING_SAMPLES] SYNTH_SDRAM;
+
+// Lecteur servi par la fin de lecture SD
+static struct sampler_TypeStruct* sampler_sd_owner = NULL;
+
+#if !defined(USE_HAL_DRIVER)
+static const uint8_t* sampler_host_sd = NULL;
+static uint32_t sampler_host_sd_size = 0;
+static int sampler_host_pending = 0;
+static uint32_t sampler_host_fault_every = 0;
+static uint32_t sampler_host_issued = 0;
+#endif
+
+static int sampler_zone_valid(const struct sampler_zone_TypeStruct* z, uint32_t size);
+static const struct sampler_zone_TypeStruct* sampler_find_zone(const struct sampler_TypeStruct* s, uint8_t note);
+static uint8_t sampler_alloc(struct sampler_TypeStruct* s);
+static void sampler_free(struct sampler_TypeStruct* s, uint8_t v);
+static uint64_t sampler_increment(float32_t speed);
+static const int16_t* sampler_segment(const struct sampler_TypeStruct* s, uint8_t v, uint32_t idx, uint32_t* pCount);
+static int sampler_sample_at(const struct sampler_TypeStruct* s, uint8_t v, uint32_t idx, int32_t* pValue);
+static int sampler_voice_render(struct sampler_TypeStruct* s, uint8_t v, uint64_t inc, float32_t gain, float32_t step,
+                                synth_sample_t* pDst, uint32_t blockSize);
+static uint32_t sampler_stream_block(const struct sampler_zone_TypeStruct* z, uint32_t k);
+static uint32_t sampler_stream_blocks(const struct sampler_zone_TypeStruct* z, uint32_t end, uint32_t read);
+static void sampler_stream_start(struct sampler_TypeStruct* s);
+static int sampler_sd_read(int16_t* pDst, uint32_t block, uint32_t count);
+static void sampler_sd_abort(void);
+
+//=======================================================================================
+
+void sampler_init(struct sampler_TypeStruct* s, const struct mod_TypeStruct* mod_ref) {
+    uint8_t v;
+
+    memset(s, 0, sizeof(*s));
+    s->mod = mod_ref;
+    s->req_voice = SAMPLER_NONE;
+    s->release_step = 1000.0f / (SAMPLER_RELEASE_MS * SYNTH_SAMPLE_RATE);
+    for (v = 0; v < SAMPLER_VOICES; v++) {
+        s->ring[v] = sampler_rings[v];
+    }
+}
+
+static int sampler_zone_valid(const struct sampler_zone_TypeStruct* z, uint32_t size) {
+    uint32_t stored = (z->flags & SAMPLER_ZONE_SD) ? SAMPLER_STREAM_HEAD : z->length;
+
+    if (z->rate == 0 || z->length < 2 || (z->offset & 1) || z->note_lo > z->note_hi || z->root > 127) return 0;
+    if (z->offset > size || stored > (size - z->offset) / 2) return 0;
+    if ((z->flags & SAMPLER_ZONE_LOOP) && (z->loop_start >= z->loop_end || z->loop_end > z->length)) return 0;
+    if (z->flags & SAMPLER_ZONE_SD) {
+        if (z->length <= SAMPLER_STREAM_HEAD) return 0;
+        // Boucles dépliées par blocs entiers, après la tête
+        if ((z->flags & SAMPLER_ZONE_LOOP) && (z->loop_start < SAMPLER_STREAM_HEAD ||
+            (z->loop_start % SAMPLER_SD_BLOCK_SAMPLES) || (z->loop_end % SAMPLER_SD_BLOCK_SAMPLES))) return 0;
+    }
+    return 1;
+}
+
+int sampler_load(struct sampler_TypeStruct* s, const uint8_t* bank, uint32_t size) {
+    const struct sampler_bank_TypeStruct *h = (const struct sampler_bank_TypeStruct*)bank;
+    const struct sampler_zone_TypeStruct *zones;
+    uint32_t i;
+
+    s->zone_count = 0;
+    if (size < sizeof(*h) || h->magic != SAMPLER_BANK_MAGIC || h->version != SAMPLER_BANK_VERSION) return -1;
+    if (h->size > size || h->zone_count == 0 ||
+        h->zone_count > (h->size - sizeof(*h)) / sizeof(struct sampler_zone_TypeStruct)) return -1;
+
+    zones = (const struct sampler_zone_TypeStruct*)(bank + sizeof(*h));
+    for (i = 0; i < h->zone_count; i++) {
+        if (!sampler_zone_valid(&zones[i], h->size)) return -1;
+    }
+    s->bank = bank;
+    s->zones = zones;
+    s->zone_count = h->zone_count;
+    return (int)s->zone_count;
+}
+
+int sampler_ready(const struct sampler_TypeStruct* s) {
+    return s->zone_count > 0;
+}
+
+uint32_t sampler_active_count(const struct sampler_TypeStruct* s) {
+    uint32_t n = 0;
+    uint8_t v;
+
+    for (v = 0; v < SAMPLER_VOICES; v++) {
+        if (s->zone[v] != NULL) n++;
+    }
+    return n;
+}
+
+//=======================================================================================
+// Notes
+
+// Première zone qui couvre la note ; une zone SD sans carte est muette
+static const struct sampler_zone_TypeStruct* sampler_find_zone(const struct sampler_TypeStruct* s, uint8_t note) {
+    uint32_t i;
+
+    for (i = 0; i < s->zone_count; i++) {
+        const struct sampler_zone_TypeStruct *z = &s->zones[i];
+        if (note >= z->note_lo && note <= z->note_hi) {
+            return ((z->flags & SAMPLER_ZONE_SD) && !s->sd_ready) ? NULL : z;
+        }
+    }
+    return NULL;
+}
+
+// Voix libre, sinon la plus ancienne relâchée, sinon la plus ancienne
+static uint8_t sampler_alloc(struct sampler_TypeStruct* s) {
+    uint8_t v, best = SAMPLER_NONE;
+
+    for (v = 0; v < SAMPLER_VOICES; v++) {
+        if (s->zone[v] == NULL) return v;
+        if (best == SAMPLER_NONE || (s->gate[v] < s->gate[best]) ||
+            (s->gate[v] == s->gate[best] && (int32_t)(s->age[v] - s->age[best]) < 0)) {
+            best = v;
+        }
+    }
+    return best;
+}
+
+// Le flux est coupé avant la voix : la fin de lecture ne la sert plus
+static void sampler_free(struct sampler_TypeStruct* s, uint8_t v) {
+    s->stream_on[v] = 0;
+    SAMPLER_BARRIER();
+    s->stream_gen[v]++;
+    s->zone[v] = NULL;
+}
+
+void sampler_note_on(struct sampler_TypeStruct* s, uint8_t note, uint8_t velocity) {
+    const struct sampler_zone_TypeStruct *z = sampler_find_zone(s, note & 0x7F);
+    uint8_t v;
+
+    if (z == NULL) return;
+    v = sampler_alloc(s);
+    sampler_free(s, v);
+
+    s->data[v] = (const int16_t*)(s->bank + z->offset);
+    s->pos[v] = 0;
+    s->ratio[v] = (float32_t)z->rate / SYNTH_SAMPLE_RATE * exp2f((float32_t)((int32_t)note - (int32_t)z->root) / 12.0f);
+    s->gain[v] = (float32_t)velocity / 127.0f * SAMPLER_GAIN;
+    s->level[v] = 0.0f;         // attaque en rampe sur le premier bloc
+    s->note[v] = note;
+    s->gate[v] = 1;
+    s->age[v] = s->clock++;
+    s->zone[v] = z;
+
+    if (z->flags & SAMPLER_ZONE_SD) {
+        s->stream_end[v] = SAMPLER_STREAM_HEAD;
+        s->stream_read[v] = 0;
+        s->stream_speed[v] = s->ratio[v];
+        s->stream_wait[v] = 0;
+        SAMPLER_BARRIER();
+        s->stream_on[v] = 1;
+    }
+}
+
+void sampler_note_off(struct sampler_TypeStruct* s, uint8_t note) {
+    uint8_t v;
+
+    for (v = 0; v < SAMPLER_VOICES; v++) {
+        if (s->zone[v] != NULL && s->gate[v] && s->note[v] == note) {
+            s->gate[v] = 0;
+        }
+    }
+}
+
+//=======================================================================================
+// Lecture des échantillons
+
+// Pas de lecture 32.32 ; fraction sur 24 bits significatifs
+static uint64_t sampler_increment(float32_t speed) {
+    uint32_t ip = (uint32_t)speed;
+    uint64_t inc = ((uint64_t)ip << 32) | (uint32_t)((speed - (float32_t)ip) * 4294967296.0f);
+
+    return (inc != 0) ? inc : 1;
+}
+
+// Échantillons contigus disponibles à partir de idx (idx avant la fin de zone
+// ou de boucle) ; NULL si le flux n'a pas encore reçu idx
+static const int16_t* sampler_segment(const struct sampler_TypeStruct* s, uint8_t v, uint32_t idx, uint32_t* pCount) {
+    const struct sampler_zone_TypeStruct *z = s->zone[v];
+    uint32_t end, r;
+
+    if (!(z->flags & SAMPLER_ZONE_SD)) {
+        end = (z->flags & SAMPLER_ZONE_LOOP) ? z->loop_end : z->length;
+        *pCount = end - idx;
+        return s->data[v] + idx;
+    }
+    if (idx < SAMPLER_STREAM_HEAD) {
+        *pCount = SAMPLER_STREAM_HEAD - idx;
+        return s->data[v] + idx;
+    }
+    end = s->stream_end[v];
+    if (!(z->flags & SAMPLER_ZONE_LOOP) && end > z->length) end = z->length;
+    if (idx >= end) return NULL;
+
+    r = (idx - SAMPLER_STREAM_HEAD) & SAMPLER_RING_MASK;
+    *pCount = SAMPLER_RING_SAMPLES - r;
+    if (*pCount > end - idx) *pCount = end - idx;
+    return s->ring[v] + r;
+}
+
+// Voisin d'un échantillon en fin de segment : début de boucle, silence après
+// la fin, 0 si le flux ne l'a pas encore reçu
+static int sampler_sample_at(const struct sampler_TypeStruct* s, uint8_t v, uint32_t idx, int32_t* pValue) {
+    const struct sampler_zone_TypeStruct *z = s->zone[v];
+    const int16_t *p;
+    uint32_t count;
+
+    if (!(z->flags & SAMPLER_ZONE_SD) && (z->flags & SAMPLER_ZONE_LOOP) && idx >= z->loop_end) {
+        idx = z->loop_start + (idx - z->loop_end);
+    } else if (!(z->flags & SAMPLER_ZONE_LOOP) && idx >= z->length) {
+        *pValue = 0;
+        return 1;
+    }
+    p = sampler_segment(s, v, idx, &count);
+    if (p == NULL) return 0;
+    *pValue = p[0];
+    return 1;
+}
+
+#if (SYNTH_FORMAT == SYNTH_FORMAT_Q15)
+
+// p[k] = échantillon base + k ; gain en Q30, rampe par échantillon
+static void sampler_mix(const int16_t* p, uint32_t base, uint64_t* pPos, uint64_t inc, int32_t* pGain, int32_t step,
+                        q15_t* pDst, uint32_t n) {
+    uint64_t pos = *pPos;
+    int32_t g = *pGain;
+    uint32_t i;
+
+    for (i = 0; i < n; i++) {
+        uint32_t k = (uint32_t)(pos >> 32) - base;
+        int32_t frac = (int32_t)((uint32_t)pos >> 17);
+        int32_t y = p[k] + (((p[k + 1] - p[k]) * frac) >> 15);
+        pDst[i] = (q15_t)__SSAT(pDst[i] + ((y * (g >> 15)) >> 15), 16);
+        g += step;
+        pos += inc;
+    }
+    *pPos = pos;
+    *pGain = g;
+}
+
+#else
+
+// p[k] = échantillon base + k ; gain déjà mis à l'échelle du PCM 16 bits
+static void sampler_mix(const int16_t* p, uint32_t base, uint64_t* pPos, uint64_t inc, float32_t* pGain, float32_t step,
+                        float32_t* pDst, uint32_t n) {
+    uint64_t pos = *pPos;
+    float32_t g = *pGain;
+    uint32_t i;
+
+    for (i = 0; i < n; i++) {
+        uint32_t k = (uint32_t)(pos >> 32) - base;
+        float32_t frac = (float32_t)(uint32_t)pos * SAMPLER_FRAC_TO_FLOAT;
+        float32_t s0 = p[k];
+        pDst[i] += (s0 + frac * ((float32_t)p[k + 1] - s0)) * g;
+        g += step;
+        pos += inc;
+    }
+    *pPos = pos;
+    *pGain = g;
+}
+
+#endif
+
+// Une voix sur le bloc, gain de gain à gain + blockSize x step ; 1 si
+// l'échantillon est fini. Sans données, la voix attend au même point.
+static int sampler_voice_render(struct sampler_TypeStruct* s, uint8_t v, uint64_t inc, float32_t gain, float32_t step,
+                                synth_sample_t* pDst, uint32_t blockSize) {
+    const struct sampler_zone_TypeStruct *z = s->zone[v];
+    uint64_t pos = s->pos[v];
+    uint32_t i = 0;
+    int ended = 0;
+#if (SYNTH_FORMAT == SYNTH_FORMAT_Q15)
+    int32_t g = (int32_t)(gain * 1073741824.0f);
+    int32_t dg = (int32_t)(step * 1073741824.0f);
+#else
+    float32_t g = gain * SAMPLER_PCM_SCALE;
+    float32_t dg = step * SAMPLER_PCM_SCALE;
+#endif
+
+    while (i < blockSize) {
+        uint32_t idx = (uint32_t)(pos >> 32);
+        uint32_t count, n;
+        const int16_t *p;
+        int32_t next;
+
+        if (!(z->flags & SAMPLER_ZONE_LOOP) && idx >= z->length) {
+            ended = 1;
+            break;
+        }
+        if (!(z->flags & SAMPLER_ZONE_SD) && (z->flags & SAMPLER_ZONE_LOOP) && idx >= z->loop_end) {
+            pos -= (uint64_t)(z->loop_end - z->loop_start) << 32;
+            continue;
+        }
+        p = sampler_segment(s, v, idx, &count);
+        if (p == NULL) {
+            s->stats.underruns++;
+            break;
+        }
+
+        if (count >= 2) {
+            // Pas tant que idx + 1 reste dans le segment
+            uint64_t last = (uint64_t)(idx + count - 1) << 32;
+            n = (uint32_t)((last - pos + inc - 1) / inc);
+            if (n > blockSize - i) n = blockSize - i;
+            sampler_mix(p, idx, &pos, inc, &g, dg, pDst + i, n);
+            i += n;
+        } else {
+            int16_t pair[2];
+
+            if (!sampler_sample_at(s, v, idx + 1, &next)) {
+                s->stats.underruns++;
+                break;
+            }
+            pair[0] = p[0];
+            pair[1] = (int16_t)next;
+            sampler_mix(pair, idx, &pos, inc, &g, dg, pDst + i, 1);
+            i++;
+        }
+    }
+    s->pos[v] = pos;
+    return ended;
+}
+
+void sampler_render_block(struct sampler_TypeStruct* s, synth_sample_t* pDst, uint32_t blockSize) {
+    float32_t pitch, pitch_ratio;
+    uint8_t v;
+
+    if (s->zone_count == 0) return;
+
+    // Pitch bend et vibrato partagés avec les voix du synthé
+    pitch = mod_value(s->mod, MOD_DST_PITCH);
+    pitch_ratio = (pitch == 0.0f) ? 1.0f : exp2f(pitch * (1.0f / 12.0f));
+
+    for (v = 0; v < SAMPLER_VOICES; v++) {
+        float32_t target, speed;
+        int ended;
+
+        if (s->zone[v] == NULL) continue;
+
+        target = s->gate[v] ? s->gain[v] : s->level[v] - s->release_step * (float32_t)blockSize;
+        if (target < 0.0f) target = 0.0f;
+        speed = s->ratio[v] * pitch_ratio;
+        if (speed > SAMPLER_PITCH_MAX) speed = SAMPLER_PITCH_MAX;
+
+        ended = sampler_voice_render(s, v, sampler_increment(speed), s->level[v],
+                                     (target - s->level[v]) / (float32_t)blockSize, pDst, blockSize);
+        s->level[v] = target;
+
+        if (s->zone[v]->flags & SAMPLER_ZONE_SD) {
+            s->stream_read[v] = (uint32_t)(s->pos[v] >> 32);
+            s->stream_speed[v] = speed;
+        }
+        if (ended || (!s->gate[v] && target == 0.0f)) {
+            sampler_free(s, v);
+        }
+    }
+}
+
+//=======================================================================================
+// Flux SD
+
+// Bloc de l'échantillon lu au bloc k de la ligne déroulée
+static uint32_t sampler_stream_block(const struct sampler_zone_TypeStruct* z, uint32_t k) {
+    if (z->flags & SAMPLER_ZONE_LOOP) {
+        uint32_t ls = z->loop_start / SAMPLER_SD_BLOCK_SAMPLES;
+        uint32_t le = z->loop_end / SAMPLER_SD_BLOCK_SAMPLES;
+        if (k >= le) k = ls + (k - ls) % (le - ls);
+    }
+    return k;
+}
+
+// Taille de la prochaine lecture d'un flux, 0 s'il n'est pas éligible. Une
+// lecture s'arrête au bouclage de l'anneau, à la fin de boucle ou de
+// l'échantillon ; le flux attend d'avoir la place d'une lecture entière.
+static uint32_t sampler_stream_blocks(const struct sampler_zone_TypeStruct* z, uint32_t end, uint32_t read) {
+    uint32_t k = end / SAMPLER_SD_BLOCK_SAMPLES;
+    uint32_t sb = sampler_stream_block(z, k);
+    uint32_t free_blocks, limit, n;
+
+    if (read < SAMPLER_STREAM_HEAD) read = SAMPLER_STREAM_HEAD;
+    free_blocks = (SAMPLER_RING_SAMPLES - (end - read)) / SAMPLER_SD_BLOCK_SAMPLES;
+
+    if (z->flags & SAMPLER_ZONE_LOOP) {
+        limit = z->loop_end / SAMPLER_SD_BLOCK_SAMPLES - sb;
+    } else {
+        uint32_t total = (z->length + SAMPLER_SD_BLOCK_SAMPLES - 1) / SAMPLER_SD_BLOCK_SAMPLES;
+        if (sb >= total) return 0;
+        limit = total - sb;
+    }
+
+    n = SAMPLER_RING_BLOCKS - ((k - SAMPLER_HEAD_BLOCKS) & (SAMPLER_RING_BLOCKS - 1));
+    if (n > SAMPLER_READ_BLOCKS) n = SAMPLER_READ_BLOCKS;
+    if (n > limit) n = limit;
+    return (n <= free_blocks) ? n : 0;
+}
+
+// Lecture du flux éligible qui s'épuise le plus tôt ; chaîne arrêtée si aucun
+static void sampler_stream_start(struct sampler_TypeStruct* s) {
+    uint8_t v, best = SAMPLER_NONE;
+    uint32_t best_blocks = 0;
+    float32_t best_time = 0.0f;
+
+    for (v = 0; v < SAMPLER_VOICES; v++) {
+        uint32_t end, read, n;
+        float32_t time;
+
+        if (!s->stream_on[v]) continue;
+        end = s->stream_end[v];
+        read = s->stream_read[v];
+        n = sampler_stream_blocks(s->zone[v], end, read);
+        if (n == 0) {
+            s->stream_wait[v] = 0;
+            continue;
+        }
+        s->stream_wait[v]++;
+        time = (float32_t)(end - read) / s->stream_speed[v];
+        if (best == SAMPLER_NONE || time < best_time) {
+            best = v;
+            best_time = time;
+            best_blocks = n;
+        }
+    }
+
+    if (best == SAMPLER_NONE) return;
+
+    {
+        const struct sampler_zone_TypeStruct *z = s->zone[best];
+        uint32_t k = s->stream_end[best] / SAMPLER_SD_BLOCK_SAMPLES;
+        int16_t *dst = s->ring[best] + (((k - SAMPLER_HEAD_BLOCKS) * SAMPLER_SD_BLOCK_SAMPLES) & SAMPLER_RING_MASK);
+        uint32_t mask;
+        int accepted;
+
+        // La requête n'est publiée qu'une fois la lecture acceptée : une fin
+        // tardive ou en double ne trouve jamais celle d'une lecture refusée,
+        // et la fin de cette lecture ne peut pas précéder sa publication
+        SAMPLER_LOCK(mask);
+        accepted = (sampler_sd_read(dst, z->sd_block + sampler_stream_block(z, k), best_blocks) == 0);
+        if (accepted) {
+            s->req_voice = best;
+            s->req_gen = s->stream_gen[best];
+            s->req_blocks = best_blocks;
+            s->req_dst = dst;
+            s->req_age = 0;
+            s->busy = 1;
+        }
+        SAMPLER_UNLOCK(mask);
+
+        if (!accepted) {
+            // Nouvel essai au service suivant
+            s->stats.read_errors++;
+            return;
+        }
+    }
+
+    if (s->stream_wait[best] > s->stats.wait_max) s->stats.wait_max = s->stream_wait[best];
+    s->stream_wait[best] = 0;
+}
+
+// Contexte interruption. Sans lecture en cours (doublon du HAL : erreur de la
+// commande d'arrêt puis fin du même transfert, ou fin après l'échéance) la
+// fin est ignorée. Après une erreur la chaîne attend le service suivant : le
+// HAL peut encore signaler ce transfert.
+void sampler_stream_complete(struct sampler_TypeStruct* s, int error) {
+    uint8_t v = s->req_voice;
+
+    if (!s->busy) {
+        s->stats.stray++;
+        return;
+    }
+    s->busy = 0;
+
+    if (error) {
+        s->stats.read_errors++;
+        return;
+    }
+    if (!s->stream_on[v] || s->stream_gen[v] != s->req_gen) {
+        s->stats.discarded++;
+    } else {
+#if defined(USE_HAL_DRIVER)
+        synth_dma_invalidate(s->req_dst, s->req_blocks * SAMPLER_BLOCK_BYTES);
+#endif
+        SAMPLER_BARRIER();
+        s->stream_end[v] += s->req_blocks * SAMPLER_SD_BLOCK_SAMPLES;
+        s->stats.reads++;
+    }
+    sampler_stream_start(s);
+}
+
+// Chaîne arrêtée (aucun flux n'avait la place d'une lecture, erreur) : relance.
+// Lecture échue : comptée en erreur, transfert annulé puis relancé
+void sampler_stream_service(struct sampler_TypeStruct* s, uint32_t blockSize) {
+    uint32_t mask;
+    int expired = 0;
+
+    if (!s->sd_ready) return;
+#if !defined(USE_HAL_DRIVER)
+    if (sampler_host_pending) {
+        sampler_host_pending = 0;
+        if (sampler_host_fault_every && sampler_host_issued % sampler_host_fault_every == 0) {
+            sampler_stream_complete(s, 1);
+            sampler_stream_complete(s, 0);
+        } else {
+            sampler_stream_complete(s, 0);
+        }
+        return;
+    }
+#endif
+    if (s->busy) {
+        s->req_age += blockSize;
+        if (s->req_age < SAMPLER_READ_DEADLINE) return;
+
+        // La fin de lecture peut arriver entre le test et l'annulation
+        SAMPLER_LOCK(mask);
+        if (s->busy) {
+            s->busy = 0;
+            s->stats.read_errors++;
+            expired = 1;
+        }
+        SAMPLER_UNLOCK(mask);
+        if (expired) sampler_sd_abort();
+    }
+    sampler_stream_start(s);
+}
+
+//=======================================================================================
+// Stockage
+
+#if defined(USE_HAL_DRIVER)
+
+static int sampler_sd_read(int16_t* pDst, uint32_t block, uint32_t count) {
+    return (BSP_SD_ReadBlocks_DMA((uint32_t*)pDst, block, count) == MSD_OK) ? 0 : -1;
+}
+
+// Transfert sans fin signalée : DMA et commande arrêtés, HAL de nouveau prêt
+static void sampler_sd_abort(void) {
+    extern SD_HandleTypeDef uSdHandle;
+
+    HAL_SD_Abort(&uSdHandle);
+}
+
+int sampler_storage_init(struct sampler_TypeStruct* s) {
+    if (BSP_QSPI_Init() != QSPI_OK || BSP_QSPI_EnableMemoryMappedMode() != QSPI_OK) return -1;
+    sampler_sd_owner = s;
+    s->sd_ready = (BSP_SD_Init() == MSD_OK);
+    return sampler_load(s, (const uint8_t*)SAMPLER_QSPI_BASE, SAMPLER_QSPI_SIZE);
+}
+
+// Callbacks du BSP et du HAL, contexte interruption SDMMC / DMA2 stream 3
+void BSP_SD_ReadCpltCallback(void) {
+    if (sampler_sd_owner != NULL) sampler_stream_complete(sampler_sd_owner, 0);
+}
+
+void BSP_SD_AbortCallback(void) {
+    if (sampler_sd_owner != NULL) sampler_stream_complete(sampler_sd_owner, 1);
+}
+
+void HAL_SD_ErrorCallback(SD_HandleTypeDef* hsd) {
+    (void)hsd;
+    if (sampler_sd_owner != NULL) sampler_stream_complete(sampler_sd_owner, 1);
+}
+
+#else
+
+static int sampler_sd_read(int16_t* pDst, uint32_t block, uint32_t count) {
+    uint64_t offset = (uint64_t)block * SAMPLER_BLOCK_BYTES;
+
+    if (sampler_host_sd == NULL || offset + count * SAMPLER_BLOCK_BYTES > sampler_host_sd_size) return -1;
+    memcpy(pDst, sampler_host_sd + offset, count * SAMPLER_BLOCK_BYTES);
+    sampler_host_issued++;
+    // Panne simulée : une lecture sur deux en faute perd sa fin, l'autre la double
+    sampler_host_pending = !(sampler_host_fault_every &&
+                             sampler_host_issued % (2 * sampler_host_fault_every) == sampler_host_fault_every);
+    return 0;
+}
+
+static void sampler_sd_abort(void) {
+    sampler_host_pending = 0;
+}
+
+void sampler_host_set_faults(uint32_t every) {
+    sampler_host_fault_every = every;
+    sampler_host_issued = 0;
+}
+
+void sampler_host_set_sd(struct sampler_TypeStruct* s, const uint8_t* image, uint32_t size) {
+    sampler_host_sd = image;
+    sampler_host_sd_size = size;
+    sampler_sd_owner = s;
+    s->sd_ready = (image != NULL);
+}
+
+#endif
+
+#endif /* SYNTH_SAMPLER */
@@ -978,3 +978,69 @@ void proceed_statement(){
 	
 	while(CheckForUserInput() != 1){}	
 }
+
+/**
+  * @brief  Display the per-stage profiling overlay : min/avg/max ticks of
+	*					each stage and its share of the block budget
+  * @param  names: stage names
+  * @param  stats: per-stage statistics, see synth_profile_stats()
+  * @param  num_stages: number of stages
+  * @param  budget: ticks available for one audio block (same unit as stats)
+  * @param  dropped: measurements lost because the ring was full
+  * @retval none
+  */
+
+void displayProfile(const char *const names[], const synth_profile_stat_t *stats, int num_stages, uint32_t budget, uint32_t dropped) {
+	uint8_t line[48];
+	uint32_t avg, total = 0;
+	int i, y = 80;
+
+	BSP_LCD_SelectLayer(LTDC_ACTIVE_LAYER);
+	BSP_LCD_SetFont(&Font12);
+	BSP_LCD_SetBackColor(BACKGROUND_COLOUR);
+	BSP_LCD_SetTextColor(TEXT_COLOUR);
+
+	sprintf((char*)line, "%-13s %7s %7s %7s %5s", "stage", "min", "avg", "max", "%blk");
+	BSP_LCD_DisplayStringAt(10, y, line, LEFT_MODE);
+	y += 14;
+
+	for(i = 0; i < num_stages; i++) {
+		avg = stats[i].count ? (uint32_t)(stats[i].sum / stats[i].count) : 0;
+		// seuls les étages de rendu (qui couvrent des échantillons) comptent dans le total
+		if(stats[i].samples) total += avg;
+		sprintf((char*)line, "%-13s %7lu %7lu %7lu %4lu%%", names[i],
+				stats[i].count ? (unsigned long)stats[i].min : 0UL, (unsigned long)avg,
+				(unsigned long)stats[i].max, budget ? (unsigned long)(100UL * avg / budget) : 0UL);
+		BSP_LCD_DisplayStringAt(10, y, line, LEFT_MODE);
+		y += 14;
+	}
+
+	sprintf((char*)line, "render %lu/%lu (%lu%%) lost %lu        ", (unsigned long)total, (unsigned long)budget,
+			budget ? (unsigned long)(100UL * total / budget) : 0UL, (unsigned long)dropped);
+	BSP_LCD_SetTextColor(total > budget ? IMAGINARY_COLOUR : TEXT_COLOUR);
+	BSP_LCD_DisplayStringAt(10, y + 4, line, LEFT_MODE);
+	BSP_LCD_SetTextColor(TEXT_COLOUR);
+}
+
+// Sous l'overlay du profil : échéances DMA et charge par moitié ping-pong,
+// en couleur d'alerte dès qu'un rendu a manqué son échéance
+void displayTelemetry(const struct synth_telemetry_record_TypeStruct *rec) {
+	uint8_t line[72];
+	int y = 222;
+
+	BSP_LCD_SelectLayer(LTDC_ACTIVE_LAYER);
+	BSP_LCD_SetFont(&Font12);
+	BSP_LCD_SetBackColor(BACKGROUND_COLOUR);
+	BSP_LCD_SetTextColor((rec->late || rec->sai_errors) ? IMAGINARY_COLOUR : TEXT_COLOUR);
+
+	sprintf((char*)line, "DMA %lu rendu %lu retard %lu (max %lu cyc) SAI %lu     ",
+			(unsigned long)rec->dma_halves, (unsigned long)rec->blocks, (unsigned long)rec->late,
+			(unsigned long)rec->late_max, (unsigned long)rec->sai_errors);
+	BSP_LCD_DisplayStringAt(10, y, line, LEFT_MODE);
+
+	sprintf((char*)line, "charge %u/%u/%u%% voix %u/%u MIDI perdus %lu     ",
+			rec->load_last / 10u, rec->load_avg / 10u, rec->load_max / 10u,
+			rec->voices, rec->voices_max, (unsigned long)rec->midi_overflows);
+	BSP_LCD_DisplayStringAt(10, y + 14, line, LEFT_MODE);
+	BSP_LCD_SetTextColor(TEXT_COLOUR);
+}
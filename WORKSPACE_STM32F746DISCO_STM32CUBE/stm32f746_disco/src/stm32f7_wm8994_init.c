@@ -4,6 +4,11 @@
 // of audio in and out on F7 Discovery
 
 #include "stm32f7_wm8994_init.h"
+#include "synth_memory.h"
+#include "synth_telemetry.h"
+#if defined(SYNTH_RTOS)
+#include "synth_tasks.h"
+#endif
 
 // structures and functions used to generate PRBS sequence
  typedef union 
@@ -70,6 +75,9 @@ volatile int32_t TX_buffer_empty = 0; // these may not need to be int32_t
 volatile int32_t RX_buffer_full = 0; // they were extern volatile int16_t in F4 version
 int16_t rx_buffer_proc, tx_buffer_proc; // will be assigned token values PING or PONG
 
+// PING_IN, PING_OUT, PONG_IN, PONG_OUT : non cacheable, no stale data seen by the CPU
+int16_t audio_dma_buffer[4 * 2 * PING_PONG_BUFFER_SIZE] SYNTH_DMA_NC;
+
 int16_t rx_sample_L;
 int16_t rx_sample_R;
 int16_t tx_sample_L;
@@ -93,16 +101,10 @@ void BSP_AUDIO_IN_TransferCompleteM1_CallBack(void)
   return;
 }
 
+// Erreur DMA ou SAI (débordement, synchro de trame) : comptée par la télémétrie
 void BSP_AUDIO_IN_Error_CallBack(void)
 {
-  /* This function is called when an Interrupt due to transfer error on or peripheral
-     error occurs. */
-  while (BSP_PB_GetState(BUTTON_KEY) != RESET)
-  {
-    return;
-  }
-  /* could also generate a system reset to recover from the error */
-  /* .... */
+  synth_telemetry_sai_error();
 }
 
 // essentially this is the interrupt service routine called when output DMA transfer from
@@ -111,6 +113,10 @@ void BSP_AUDIO_OUT_TransferComplete_CallBack(void)
 {
   tx_buffer_proc = PING;
   TX_buffer_empty = 1;
+  synth_telemetry_dma_half(SYNTH_TELEMETRY_NOW());
+#if defined(SYNTH_RTOS)
+  synth_tasks_audio_isr();   // réveille la tâche de rendu
+#endif
   return;
 }
 
@@ -120,16 +126,18 @@ void BSP_AUDIO_OUT_TransferCompleteM1_CallBack(void)
 {
 	tx_buffer_proc = PONG;
   TX_buffer_empty = 1;
+  synth_telemetry_dma_half(SYNTH_TELEMETRY_NOW());
+#if defined(SYNTH_RTOS)
+  synth_tasks_audio_isr();   // réveille la tâche de rendu
+#endif
   return;
 }
 
+// Erreur DMA ou SAI (sous-alimentation du FIFO, synchro de trame) : comptée
+// par la télémétrie, visible à l'écran et dans l'enregistrement binaire
 void BSP_AUDIO_OUT_Error_CallBack(void)
 {
-  /* Stop the program with an infinite loop */
-  while (BSP_PB_GetState(BUTTON_KEY) != RESET)
-  {
-    return;
-  }
+  synth_telemetry_sai_error();
 }
 
 
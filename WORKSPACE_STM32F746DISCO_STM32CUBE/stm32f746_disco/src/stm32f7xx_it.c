@@ -40,6 +40,12 @@
 /* Includes ------------------------------------------------------------------*/
 #include "main.h"
 #include "stm32f7xx_it.h"
+#if defined(SYNTH_RTOS)
+#include "FreeRTOS.h"
+#include "task.h"
+
+extern void xPortSysTickHandler(void);
+#endif
 
 extern HCD_HandleTypeDef hhcd;
 extern DMA_HandleTypeDef   hdma;
@@ -47,6 +53,7 @@ extern uint32_t uwDMA_Transfer_Complete;
 extern SAI_HandleTypeDef haudio_out_sai;
 extern SAI_HandleTypeDef haudio_in_sai;
 extern SDRAM_HandleTypeDef sdramHandle;
+extern SD_HandleTypeDef uSdHandle;
 extern TIM_HandleTypeDef    TimHandle_period;
 
 
@@ -115,9 +122,11 @@ void UsageFault_Handler(void)
   * @param  None
   * @retval None
   */
+#if !defined(SYNTH_RTOS)    /* SYNTH_RTOS : vPortSVCHandler (FreeRTOSConfig.h) */
 void SVC_Handler(void)
 {
 }
+#endif
 
 /**
   * @brief  This function handles Debug Monitor exception.
@@ -133,9 +142,11 @@ void DebugMon_Handler(void)
   * @param  None
   * @retval None
   */
+#if !defined(SYNTH_RTOS)    /* SYNTH_RTOS : xPortPendSVHandler */
 void PendSV_Handler(void)
 {
 }
+#endif
 
 /**
   * @brief  This function handles SysTick Handler.
@@ -145,6 +156,12 @@ void PendSV_Handler(void)
 void SysTick_Handler(void)
 {
   HAL_IncTick();
+#if defined(SYNTH_RTOS)
+  if (xTaskGetSchedulerState() != taskSCHEDULER_NOT_STARTED)
+  {
+    xPortSysTickHandler();
+  }
+#endif
 }
 
 /******************************************************************************/
@@ -211,6 +228,19 @@ void BSP_SDRAM_DMA_IRQHandler(void)
 }
 
 
+/* SD card : commands and DMA reception of the sampler streams */
+void BSP_SDMMC_IRQHandler(void)
+{
+  HAL_SD_IRQHandler(&uSdHandle);
+}
+
+
+void BSP_SDMMC_DMA_Rx_IRQHandler(void)
+{
+  HAL_DMA_IRQHandler(uSdHandle.hdmarx);
+}
+
+
 void DMA2_Stream1_IRQHandler(void)
 {
   BSP_CAMERA_DMA_IRQHandler();
@@ -0,0 +1,252 @@
+/*
+ * synth.c
+ *
+ *  Moteur du synthétiseur, rendu par blocs de AUDIO_BLOCK_SIZE échantillons.
+ *  Chaque étage (oscillateur, FIR, ADSR, reverb) traite un bloc complet
+ *  par appel au lieu d'un échantillon par interruption SAI.
+ *  Les voix (voice.c) et le sampler (sampler.c, canal SAMPLER_MIDI_CHANNEL)
+ *  sont sommés avant la reverb FDN stéréo commune.
+ *
+ *  Les messages MIDI arrivent horodatés par synth_midi_post() dans une file
+ *  sans verrou ; synth_render_block() la vide en début de bloc et découpe
+ *  le bloc aux positions des événements. Tous les paramètres (voix, ADSR,
+ *  reverb, coefficients de filtre) ne sont donc modifiés que par le rendu.
+ *
+ *  Les CC et le pitch bend ne font que déplacer une source de la matrice de
+ *  modulation (modulation.c) ; chaque segment avance les lissages puis
+ *  transmet les destinations aux modules (synth_modulate).
+ */
+
+#include "synth_opt.h"
+#include "synth.h"
+#include "synth_profile.h"
+#include "voice.h"
+#include "modulation.h"
+#include "midi_queue.h"
+#include "synth_memory.h"
+#include "sampler.h"
+
+// ============== Variables globales ==============
+
+// Paramètres d'enveloppe partagés par toutes les voix, modifiés par les CC2-4
+struct adsr_TypeStruct adsr_envelope SYNTH_DTCM;
+#if (SYNTH_REVERB == SYNTH_REVERB_CONV)
+struct conv_reverb_TypeStruct conv_reverb SYNTH_DTCM;
+
+// Spectres de la RI et ligne à retard fréquentielle : SDRAM externe write-back sur la cible
+static float32_t conv_memory[CONV_MEMORY_SIZE(CONV_PARTITIONS(CONV_IR_LENGTH))] SYNTH_SDRAM;
+#else
+struct reverb_TypeStruct reverb SYNTH_DTCM;
+
+// Lignes à retard de la reverb : SDRAM externe write-back sur la cible
+static synth_sample_t reverb_lines[REVERB_LINES * REVERB_LINE_SIZE] SYNTH_SDRAM;
+#endif
+
+// Somme des voix d'un bloc
+static synth_sample_t voice_block[AUDIO_BLOCK_SIZE] SYNTH_DTCM;
+
+// Événements MIDI en attente et position du prochain échantillon rendu
+static struct midi_queue_TypeStruct midi_queue;
+static volatile uint32_t sample_clock = 0;
+
+static void synth_modulate(void);
+#if (SYNTH_SAMPLER)
+static int synth_to_sampler(uint8_t status);
+#endif
+static void synth_render_segment(synth_sample_t *pDstL, synth_sample_t *pDstR, uint32_t offset, uint32_t len);
+
+//=======================================================================================
+
+void synth_init(void) {
+    sample_clock = 0;
+
+    midi_queue_init(&midi_queue);
+#if (OVERSAMPLE_FACTOR > 1)
+    oversample_init();
+#endif
+    adsr_init(&adsr_envelope, (uint32_t)SYNTH_SAMPLE_RATE);
+    mod_init(&modulation);
+    voice_pool_init(&voices, &adsr_envelope, &modulation);
+#if (SYNTH_SAMPLER)
+    sampler_init(&sampler, &modulation);
+#endif
+#if (SYNTH_REVERB == SYNTH_REVERB_CONV)
+    conv_reverb_init(&conv_reverb, conv_memory, CONV_PARTITIONS(CONV_IR_LENGTH));
+    conv_reverb_load_synthetic(&conv_reverb, SYNTH_CONV_RT60, SYNTH_SAMPLE_RATE);
+#else
+    reverb_init(&reverb, reverb_lines);
+#endif
+}
+
+//=======================================================================================
+
+uint32_t synth_sample_clock(void) {
+    return sample_clock;
+}
+
+// Appelée par le producteur (callback USB) : ne fait que copier l'événement
+int synth_midi_post(uint8_t status, uint8_t data1, uint8_t data2, uint32_t sample) {
+    midi_event_t ev;
+
+    ev.sample = sample;
+    ev.status = status;
+    ev.data1 = data1;
+    ev.data2 = data2;
+    return midi_queue_push(&midi_queue, &ev);
+}
+
+// La moitié half_clock est rendue d'un bloc juste après l'échange : un
+// horodatage dedans serait déjà passé et appliqué en début de bloc suivant
+uint32_t synth_midi_stamp(uint32_t half_clock, uint32_t half_size, uint32_t elapsed) {
+    if (elapsed >= half_size) elapsed = half_size - 1;
+    return half_clock + half_size + elapsed;
+}
+
+uint32_t synth_midi_dropped(void) {
+    return midi_queue.dropped;
+}
+
+//=======================================================================================
+
+#if (SYNTH_SAMPLER)
+// Notes du canal du sampler, s'il a une banque ; sinon aux voix du synthé
+static int synth_to_sampler(uint8_t status) {
+    return ((status & 0x0F) == SAMPLER_MIDI_CHANNEL) && sampler_ready(&sampler);
+}
+#endif
+
+// Application immédiate d'un message : réservée au contexte de rendu
+void synth_midi_message(uint8_t status, uint8_t data1, uint8_t data2) {
+    uint8_t note = data1;
+    uint8_t velocity = data2;
+
+    switch(status & 0xF0) {
+        case 0x90:
+#if (SYNTH_SAMPLER)
+            if (synth_to_sampler(status)) {
+                if (velocity > 0) {
+                    sampler_note_on(&sampler, note, velocity);
+                } else {
+                    sampler_note_off(&sampler, note);
+                }
+                break;
+            }
+#endif
+            if(velocity > 0) {
+                voice_note_on(&voices, note, velocity);
+            } else {
+                voice_note_off(&voices, note);
+            }
+            break;
+
+        case 0x80:
+#if (SYNTH_SAMPLER)
+            if (synth_to_sampler(status)) {
+                sampler_note_off(&sampler, note);
+                break;
+            }
+#endif
+            voice_note_off(&voices, note);
+            break;
+
+        case 0xB0:
+            if(note == 70) {
+                // Forme d'onde : 0-31 carré, 32-63 dent de scie, 64-95 triangle, 96-127 sinus
+                voice_set_waveform(&voices, (osc_wave_t)(velocity >> 5));
+            }
+            else {
+                // Routage par défaut : CC7 coupure, CC71 résonance, CC1 feedback, CC2-4 ADSR
+                mod_set_cc(&modulation, note, velocity);
+            }
+            break;
+
+        case 0xE0:
+            // Routage par défaut : hauteur, ± MOD_PITCHBEND_RANGE demi-tons
+            mod_set_pitchbend(&modulation, note | (velocity << 7));
+            break;
+    }
+}
+
+// Destinations globales de la matrice : gains transmis à chaque segment (rampe
+// dans le module), coefficients recalculés seulement quand mod_due() le permet
+static void synth_modulate(void) {
+    if (mod_due(&modulation, MOD_DST_ATTACK)) {
+        adsr_set_attack(&adsr_envelope, mod_value(&modulation, MOD_DST_ATTACK));
+    }
+    if (mod_due(&modulation, MOD_DST_DECAY)) {
+        adsr_set_decay(&adsr_envelope, mod_value(&modulation, MOD_DST_DECAY));
+    }
+    if (mod_due(&modulation, MOD_DST_SUSTAIN)) {
+        adsr_set_sustain(&adsr_envelope, mod_value(&modulation, MOD_DST_SUSTAIN));
+    }
+    if (mod_due(&modulation, MOD_DST_RELEASE)) {
+        adsr_set_release(&adsr_envelope, mod_value(&modulation, MOD_DST_RELEASE));
+    }
+
+#if (SYNTH_REVERB == SYNTH_REVERB_CONV)
+    // La RI de la convolution est fixe : MOD_DST_REVERB_FEEDBACK sans effet
+    conv_reverb_set_mix(&conv_reverb, mod_value(&modulation, MOD_DST_REVERB_MIX));
+#else
+    if (mod_due(&modulation, MOD_DST_REVERB_FEEDBACK)) {
+        reverb_set_feedback(&reverb, mod_value(&modulation, MOD_DST_REVERB_FEEDBACK));
+    }
+    reverb_set_delay_mix(&reverb, mod_value(&modulation, MOD_DST_REVERB_MIX));
+#endif
+}
+
+//=======================================================================================
+
+void synth_render_block(synth_sample_t *pDstL, synth_sample_t *pDstR, uint32_t blockSize) {
+    uint32_t block_start = sample_clock;
+    uint32_t offset = 0;
+    midi_event_t ev;
+
+    // Événements échus avant la fin du bloc ; un événement en retard
+    // (horodatage déjà passé) est appliqué en début de bloc
+    while (midi_queue_peek(&midi_queue, &ev) && (int32_t)(ev.sample - block_start) < (int32_t)blockSize) {
+        int32_t pos = (int32_t)(ev.sample - block_start);
+
+        if (pos > (int32_t)offset) {
+            synth_render_segment(pDstL, pDstR, offset, pos - offset);
+            offset = pos;
+        }
+        SYNTH_PROFILE_COUNT(PROF_MIDI, 0, synth_midi_message(ev.status, ev.data1, ev.data2));
+        midi_queue_pop(&midi_queue);
+    }
+
+    if (offset < blockSize) {
+        synth_render_segment(pDstL, pDstR, offset, blockSize - offset);
+    }
+
+    sample_clock = block_start + blockSize;
+
+#if (SYNTH_SAMPLER)
+    // Lectures SD du bloc suivant, si la chaîne s'est arrêtée
+    sampler_stream_service(&sampler, blockSize);
+#endif
+}
+
+static void synth_render_segment(synth_sample_t *pDstL, synth_sample_t *pDstR, uint32_t offset, uint32_t len) {
+    SYNTH_PROFILE_BEGIN(PROF_MOD);
+    mod_update(&modulation, len);
+    synth_modulate();
+    SYNTH_PROFILE_END(PROF_MOD, len);
+
+    // Oscillateur -> FIR -> ADSR de chaque voix, profilés dans voice_render_block()
+    voice_render_block(&voices, voice_block + offset, len);
+#if (SYNTH_SAMPLER)
+    if (sampler_ready(&sampler)) {
+        SYNTH_PROFILE_BEGIN(PROF_SAMPLER);
+        sampler_render_block(&sampler, voice_block + offset, len);
+        SYNTH_PROFILE_END(PROF_SAMPLER, len);
+    }
+#endif
+
+    SYNTH_PROFILE_BEGIN(PROF_REVERB);
+#if (SYNTH_REVERB == SYNTH_REVERB_CONV)
+    conv_reverb_process_block(&conv_reverb, voice_block + offset, pDstL + offset, pDstR + offset, len);
+#else
+    reverb_process_block(&reverb, voice_block + offset, pDstL + offset, pDstR + offset, len);
+#endif
+    SYNTH_PROFILE_END(PROF_REVERB, len);
+}
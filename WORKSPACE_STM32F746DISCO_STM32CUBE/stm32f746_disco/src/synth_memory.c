@@ -0,0 +1,141 @@
+/*
+ * synth_memory.c
+ *
+ *  Maintenance du D-cache pour les tampons DMA et banc de mesure des
+ *  régions mémoire (DTCM, SRAM, SRAM non cacheable, SDRAM).
+ */
+
+#include <stdio.h>
+#include "stm32f7xx.h"
+#include "arm_math.h"
+#include "synth_memory.h"
+#include "synth_profile.h"
+
+#define DCACHE_LINE 32u
+
+//=======================================================================================
+
+synth_mem_region_t synth_mem_region(const void* addr) {
+    uint32_t a = (uint32_t)addr;
+
+    if (a - SYNTH_DTCM_BASE < SYNTH_DTCM_SIZE) return MEM_DTCM;
+    if (a - SYNTH_SRAM_NC_BASE < SYNTH_SRAM_NC_SIZE) return MEM_SRAM_NC;
+    if (a >= SYNTH_SRAM_BASE && a < SYNTH_SRAM_NC_BASE) return MEM_SRAM;
+    if (a - SYNTH_SDRAM_AUDIO_BASE < SYNTH_SDRAM_AUDIO_SIZE) return MEM_SDRAM;
+    if (a - SYNTH_SDRAM_BASE < SYNTH_SDRAM_SIZE) return MEM_SDRAM_DEVICE;
+    if (a - SYNTH_QSPI_BASE < SYNTH_QSPI_SIZE) return MEM_QSPI;
+    return MEM_OTHER;
+}
+
+// Avant un départ DMA depuis la mémoire : seule la SDRAM write-back peut
+// retenir des écritures dans le cache (la SRAM est write-through)
+void synth_dma_clean(const void* addr, uint32_t len) {
+    uint32_t start, end;
+
+    if (synth_mem_region(addr) != MEM_SDRAM) return;
+
+    start = (uint32_t)addr & ~(DCACHE_LINE - 1);
+    end = (uint32_t)addr + len;
+    SCB_CleanDCache_by_Addr((uint32_t*)start, (int32_t)(end - start));
+}
+
+// Après une réception DMA : jette les lignes du cache qui masqueraient les
+// nouvelles données. Le tampon doit être aligné sur 32 octets et occuper des
+// lignes entières, sinon les données voisines sont perdues.
+void synth_dma_invalidate(void* addr, uint32_t len) {
+    synth_mem_region_t region = synth_mem_region(addr);
+    uint32_t start, end;
+
+    if (region != MEM_SRAM && region != MEM_SDRAM) return;
+
+    start = (uint32_t)addr & ~(DCACHE_LINE - 1);
+    end = (uint32_t)addr + len;
+    SCB_InvalidateDCache_by_Addr((uint32_t*)start, (int32_t)(end - start));
+}
+
+//=======================================================================================
+// Banc de mesure : mêmes noyaux que le rendu, données placées dans chaque région.
+//   fir   : arm_fir_f32 64 coefficients sur un bloc de 64 échantillons
+//   delay : lecture/écriture d'une ligne à retard masquée de 8 Ko (le double
+//           du D-cache), un bloc de 64 échantillons, comme la reverb FDN
+// Dump CSV sur l'ITM (console SWV) :
+//   # memory bench unit=cycles
+//   region,fir,delay
+
+#if defined(SYNTH_PROFILE_DWT)
+
+#define BENCH_BLOCK     64
+#define BENCH_TAPS      64
+#define BENCH_LINE      2048    // puissance de 2
+#define BENCH_DELAY     1307
+#define BENCH_RUNS      16
+
+typedef struct {
+    float32_t in[BENCH_BLOCK];
+    float32_t out[BENCH_BLOCK];
+    float32_t coeffs[BENCH_TAPS];
+    float32_t state[BENCH_TAPS + BENCH_BLOCK - 1];
+    float32_t line[BENCH_LINE];
+} bench_buf_t;
+
+static bench_buf_t bench_dtcm SYNTH_DTCM;
+static bench_buf_t bench_sram;
+static bench_buf_t bench_nc SYNTH_DMA_NC;
+static bench_buf_t bench_sdram SYNTH_SDRAM;
+// SDRAM libre entre le calque LCD (0xC0400000) et la région audio, hors MPU
+#define bench_device ((bench_buf_t*)0xC0500000)
+
+static const char *const bench_names[] = {
+    "DTCM", "SRAM (WT)", "SRAM non cacheable", "SDRAM (WB)", "SDRAM device"
+};
+
+static void bench_region(bench_buf_t* b, uint32_t* fir_cycles, uint32_t* delay_cycles) {
+    arm_fir_instance_f32 fir;
+    uint32_t i, run, w = 0, t0, fir_sum = 0, delay_sum = 0;
+
+    for (i = 0; i < BENCH_BLOCK; i++) b->in[i] = (float32_t)i / BENCH_BLOCK;
+    for (i = 0; i < BENCH_TAPS; i++) b->coeffs[i] = 1.0f / BENCH_TAPS;
+    for (i = 0; i < BENCH_LINE; i++) b->line[i] = 0.0f;
+    arm_fir_init_f32(&fir, BENCH_TAPS, b->coeffs, b->state, BENCH_BLOCK);
+
+    // premier passage hors mesure : remplit le cache comme en régime établi
+    for (run = 0; run <= BENCH_RUNS; run++) {
+        t0 = DWT->CYCCNT;
+        arm_fir_f32(&fir, b->in, b->out, BENCH_BLOCK);
+        if (run) fir_sum += DWT->CYCCNT - t0;
+
+        t0 = DWT->CYCCNT;
+        for (i = 0; i < BENCH_BLOCK; i++) {
+            float32_t d = b->line[(w - BENCH_DELAY) & (BENCH_LINE - 1)];
+            b->line[w] = b->in[i] + 0.5f * d;
+            w = (w + 1) & (BENCH_LINE - 1);
+        }
+        if (run) delay_sum += DWT->CYCCNT - t0;
+    }
+    *fir_cycles = fir_sum / BENCH_RUNS;
+    *delay_cycles = delay_sum / BENCH_RUNS;
+}
+
+void synth_memory_bench(void) {
+    bench_buf_t *const regions[] = { &bench_dtcm, &bench_sram, &bench_nc, &bench_sdram, bench_device };
+    char line[64];
+    uint32_t r, fir_cycles, delay_cycles;
+    int i, n;
+
+    n = snprintf(line, sizeof(line), "# memory bench unit=cycles\nregion,fir,delay\n");
+    for (i = 0; i < n; i++) ITM_SendChar(line[i]);
+
+    for (r = 0; r < sizeof(regions) / sizeof(regions[0]); r++) {
+        bench_region(regions[r], &fir_cycles, &delay_cycles);
+        n = snprintf(line, sizeof(line), "%s,%lu,%lu\n", bench_names[r],
+                     (unsigned long)fir_cycles, (unsigned long)delay_cycles);
+        for (i = 0; i < n; i++) ITM_SendChar(line[i]);
+    }
+}
+
+#else
+
+void synth_memory_bench(void) {
+}
+
+#endif
@@ -0,0 +1,150 @@
+/*
+ * synth_profile.c
+ *
+ *  Anneau de mesures sans verrou et statistiques min/moy/max par étage.
+ *  Le producteur (rendu) n'écrit que ring_head, le consommateur
+ *  (synth_profile_poll) n'écrit que ring_tail : aucune section critique.
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include "synth_profile.h"
+
+#if defined(SYNTH_PROFILE_DWT)
+#define PROF_BARRIER()  __DMB()
+#else
+#define PROF_BARRIER()  __sync_synchronize()
+#endif
+
+typedef struct {
+    uint32_t ticks;
+    uint16_t samples;
+    uint8_t stage;
+} prof_record_t;
+
+const char *const synth_profile_names[PROF_STAGE_COUNT] = {
+    "oscillateur", "filtre", "ADSR", "sampler", "reverb", "modulation", "MIDI", "USBH_Process"
+};
+
+static prof_record_t ring[PROF_RING_SIZE];
+static volatile uint32_t ring_head = 0;
+static volatile uint32_t ring_tail = 0;
+static volatile uint32_t ring_dropped = 0;
+
+static synth_profile_stat_t stats[PROF_STAGE_COUNT];
+
+//=======================================================================================
+
+void synth_profile_init(void) {
+#if defined(SYNTH_PROFILE_DWT)
+    // Active le compteur de cycles (le verrou DWT du Cortex-M7 doit être levé)
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->LAR = 0xC5ACCE55;
+    DWT->CYCCNT = 0;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+#endif
+    ring_head = 0;
+    ring_tail = 0;
+    synth_profile_reset();
+}
+
+// Producteur : une mesure est perdue (et comptée) si l'anneau est plein
+void synth_profile_record(synth_stage_t stage, uint32_t ticks, uint32_t nb_samples) {
+    uint32_t head = ring_head;
+    uint32_t next = (head + 1) & (PROF_RING_SIZE - 1);
+
+    if (next == ring_tail) {
+        ring_dropped++;
+        return;
+    }
+    ring[head].ticks = ticks;
+    ring[head].samples = (uint16_t)nb_samples;
+    ring[head].stage = (uint8_t)stage;
+    PROF_BARRIER();
+    ring_head = next;
+}
+
+// Consommateur : vide l'anneau dans les statistiques
+void synth_profile_poll(void) {
+    uint32_t tail = ring_tail;
+
+    while (tail != ring_head) {
+        PROF_BARRIER();
+        prof_record_t rec = ring[tail];
+        synth_profile_stat_t *s = &stats[rec.stage];
+
+        if (rec.ticks < s->min) s->min = rec.ticks;
+        if (rec.ticks > s->max) s->max = rec.ticks;
+        s->sum += rec.ticks;
+        s->samples += rec.samples;
+        s->count++;
+
+        tail = (tail + 1) & (PROF_RING_SIZE - 1);
+        ring_tail = tail;
+    }
+}
+
+void synth_profile_reset(void) {
+    uint32_t i;
+
+    memset(stats, 0, sizeof(stats));
+    for (i = 0; i < PROF_STAGE_COUNT; i++) {
+        stats[i].min = UINT32_MAX;
+    }
+    ring_dropped = 0;
+}
+
+const synth_profile_stat_t* synth_profile_stats(void) {
+    return stats;
+}
+
+uint32_t synth_profile_dropped(void) {
+    return ring_dropped;
+}
+
+//=======================================================================================
+// Dump texte lisible sur PC (CSV) :
+//   # unit=<cycles|ns> dropped=<n>
+//   stage,count,min,avg,max,samples
+
+int synth_profile_format(char *buf, int len) {
+    int n, pos = 0;
+    uint32_t i;
+
+#if defined(SYNTH_PROFILE_UNIT)
+    n = snprintf(buf, len, "# unit=%s dropped=%lu\nstage,count,min,avg,max,samples\n",
+                 SYNTH_PROFILE_UNIT, (unsigned long)ring_dropped);
+#else
+    n = snprintf(buf, len, "# unit=none dropped=%lu\nstage,count,min,avg,max,samples\n",
+                 (unsigned long)ring_dropped);
+#endif
+    if (n < 0 || n >= len) return len - 1;
+    pos = n;
+
+    for (i = 0; i < PROF_STAGE_COUNT; i++) {
+        const synth_profile_stat_t *s = &stats[i];
+        unsigned long avg = s->count ? (unsigned long)(s->sum / s->count) : 0;
+        n = snprintf(buf + pos, len - pos, "%s,%lu,%lu,%lu,%lu,%lu\n",
+                     synth_profile_names[i], (unsigned long)s->count,
+                     s->count ? (unsigned long)s->min : 0, avg,
+                     (unsigned long)s->max, (unsigned long)s->samples);
+        if (n < 0 || n >= len - pos) return len - 1;
+        pos += n;
+    }
+    return pos;
+}
+
+// Envoie le dump sur la sortie ITM (console SWV de STM32CubeIDE) ou stdout sur PC
+void synth_profile_dump(void) {
+    static char text[64 * (PROF_STAGE_COUNT + 2)];
+    int i, n = synth_profile_format(text, sizeof(text));
+
+#if defined(SYNTH_PROFILE_DWT)
+    for (i = 0; i < n; i++) {
+        ITM_SendChar(text[i]);
+    }
+#else
+    (void)i;
+    fwrite(text, 1, n, stdout);
+#endif
+}
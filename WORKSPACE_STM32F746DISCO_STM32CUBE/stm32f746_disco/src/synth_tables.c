@@ -0,0 +1,842 @@
+/*
+ * synth_tables.c
+ *
+ *  Généré par host/gen_tables.c (make -C host tables), ne pas modifier.
+ */
+
+#include "synth_tables.h"
+
+const int16_t synth_sine_table[SYNTH_SINE_TABLE_SIZE + 1] SYNTH_TABLE_ALIGN = {
+    0, 101, 201, 302, 402, 503, 603, 704,
+    804, 904, 1005, 1105, 1205, 1306, 1406, 1506,
+    1606, 1706, 1806, 1906, 2006, 2105, 2205, 2305,
+    2404, 2503, 2603, 2702, 2801, 2900, 2999, 3098,
+    3196, 3295, 3393, 3492, 3590, 3688, 3786, 3883,
+    3981, 4078, 4176, 4273, 4370, 4467, 4563, 4660,
+    4756, 4852, 4948, 5044, 5139, 5235, 5330, 5425,
+    5520, 5614, 5708, 5803, 5897, 5990, 6084, 6177,
+    6270, 6363, 6455, 6547, 6639, 6731, 6823, 6914,
+    7005, 7096, 7186, 7276, 7366, 7456, 7545, 7635,
+    7723, 7812, 7900, 7988, 8076, 8163, 8250, 8337,
+    8423, 8509, 8595, 8680, 8765, 8850, 8935, 9019,
+    9102, 9186, 9269, 9352, 9434, 9516, 9598, 9679,
+    9760, 9841, 9921, 10001, 10080, 10159, 10238, 10316,
+    10394, 10471, 10549, 10625, 10702, 10778, 10853, 10928,
+    11003, 11077, 11151, 11224, 11297, 11370, 11442, 11514,
+    11585, 11656, 11727, 11797, 11866, 11935, 12004, 12072,
+    12140, 12207, 12274, 12340, 12406, 12472, 12537, 12601,
+    12665, 12729, 12792, 12854, 12916, 12978, 13039, 13100,
+    13160, 13219, 13279, 13337, 13395, 13453, 13510, 13567,
+    13623, 13678, 13733, 13788, 13842, 13896, 13949, 14001,
+    14053, 14104, 14155, 14206, 14256, 14305, 14354, 14402,
+    14449, 14497, 14543, 14589, 14635, 14680, 14724, 14768,
+    14811, 14854, 14896, 14937, 14978, 15019, 15059, 15098,
+    15137, 15175, 15213, 15250, 15286, 15322, 15357, 15392,
+    15426, 15460, 15493, 15525, 15557, 15588, 15619, 15649,
+    15679, 15707, 15736, 15763, 15791, 15817, 15843, 15868,
+    15893, 15917, 15941, 15964, 15986, 16008, 16029, 16049,
+    16069, 16088, 16107, 16125, 16143, 16160, 16176, 16192,
+    16207, 16221, 16235, 16248, 16261, 16273, 16284, 16295,
+    16305, 16315, 16324, 16332, 16340, 16347, 16353, 16359,
+    16364, 16369, 16373, 16376, 16379, 16381, 16383, 16384,
+    16384, 16384, 16383, 16381, 16379, 16376, 16373, 16369,
+    16364, 16359, 16353, 16347, 16340, 16332, 16324, 16315,
+    16305, 16295, 16284, 16273, 16261, 16248, 16235, 16221,
+    16207, 16192, 16176, 16160, 16143, 16125, 16107, 16088,
+    16069, 16049, 16029, 16008, 15986, 15964, 15941, 15917,
+    15893, 15868, 15843, 15817, 15791, 15763, 15736, 15707,
+    15679, 15649, 15619, 15588, 15557, 15525, 15493, 15460,
+    15426, 15392, 15357, 15322, 15286, 15250, 15213, 15175,
+    15137, 15098, 15059, 15019, 14978, 14937, 14896, 14854,
+    14811, 14768, 14724, 14680, 14635, 14589, 14543, 14497,
+    14449, 14402, 14354, 14305, 14256, 14206, 14155, 14104,
+    14053, 14001, 13949, 13896, 13842, 13788, 13733, 13678,
+    13623, 13567, 13510, 13453, 13395, 13337, 13279, 13219,
+    13160, 13100, 13039, 12978, 12916, 12854, 12792, 12729,
+    12665, 12601, 12537, 12472, 12406, 12340, 12274, 12207,
+    12140, 12072, 12004, 11935, 11866, 11797, 11727, 11656,
+    11585, 11514, 11442, 11370, 11297, 11224, 11151, 11077,
+    11003, 10928, 10853, 10778, 10702, 10625, 10549, 10471,
+    10394, 10316, 10238, 10159, 10080, 10001, 9921, 9841,
+    9760, 9679, 9598, 9516, 9434, 9352, 9269, 9186,
+    9102, 9019, 8935, 8850, 8765, 8680, 8595, 8509,
+    8423, 8337, 8250, 8163, 8076, 7988, 7900, 7812,
+    7723, 7635, 7545, 7456, 7366, 7276, 7186, 7096,
+    7005, 6914, 6823, 6731, 6639, 6547, 6455, 6363,
+    6270, 6177, 6084, 5990, 5897, 5803, 5708, 5614,
+    5520, 5425, 5330, 5235, 5139, 5044, 4948, 4852,
+    4756, 4660, 4563, 4467, 4370, 4273, 4176, 4078,
+    3981, 3883, 3786, 3688, 3590, 3492, 3393, 3295,
+    3196, 3098, 2999, 2900, 2801, 2702, 2603, 2503,
+    2404, 2305, 2205, 2105, 2006, 1906, 1806, 1706,
+    1606, 1506, 1406, 1306, 1205, 1105, 1005, 904,
+    804, 704, 603, 503, 402, 302, 201, 101,
+    0, -101, -201, -302, -402, -503, -603, -704,
+    -804, -904, -1005, -1105, -1205, -1306, -1406, -1506,
+    -1606, -1706, -1806, -1906, -2006, -2105, -2205, -2305,
+    -2404, -2503, -2603, -2702, -2801, -2900, -2999, -3098,
+    -3196, -3295, -3393, -3492, -3590, -3688, -3786, -3883,
+    -3981, -4078, -4176, -4273, -4370, -4467, -4563, -4660,
+    -4756, -4852, -4948, -5044, -5139, -5235, -5330, -5425,
+    -5520, -5614, -5708, -5803, -5897, -5990, -6084, -6177,
+    -6270, -6363, -6455, -6547, -6639, -6731, -6823, -6914,
+    -7005, -7096, -7186, -7276, -7366, -7456, -7545, -7635,
+    -7723, -7812, -7900, -7988, -8076, -8163, -8250, -8337,
+    -8423, -8509, -8595, -8680, -8765, -8850, -8935, -9019,
+    -9102, -9186, -9269, -9352, -9434, -9516, -9598, -9679,
+    -9760, -9841, -9921, -10001, -10080, -10159, -10238, -10316,
+    -10394, -10471, -10549, -10625, -10702, -10778, -10853, -10928,
+    -11003, -11077, -11151, -11224, -11297, -11370, -11442, -11514,
+    -11585, -11656, -11727, -11797, -11866, -11935, -12004, -12072,
+    -12140, -12207, -12274, -12340, -12406, -12472, -12537, -12601,
+    -12665, -12729, -12792, -12854, -12916, -12978, -13039, -13100,
+    -13160, -13219, -13279, -13337, -13395, -13453, -13510, -13567,
+    -13623, -13678, -13733, -13788, -13842, -13896, -13949, -14001,
+    -14053, -14104, -14155, -14206, -14256, -14305, -14354, -14402,
+    -14449, -14497, -14543, -14589, -14635, -14680, -14724, -14768,
+    -14811, -14854, -14896, -14937, -14978, -15019, -15059, -15098,
+    -15137, -15175, -15213, -15250, -15286, -15322, -15357, -15392,
+    -15426, -15460, -15493, -15525, -15557, -15588, -15619, -15649,
+    -15679, -15707, -15736, -15763, -15791, -15817, -15843, -15868,
+    -15893, -15917, -15941, -15964, -15986, -16008, -16029, -16049,
+    -16069, -16088, -16107, -16125, -16143, -16160, -16176, -16192,
+    -16207, -16221, -16235, -16248, -16261, -16273, -16284, -16295,
+    -16305, -16315, -16324, -16332, -16340, -16347, -16353, -16359,
+    -16364, -16369, -16373, -16376, -16379, -16381, -16383, -16384,
+    -16384, -16384, -16383, -16381, -16379, -16376, -16373, -16369,
+    -16364, -16359, -16353, -16347, -16340, -16332, -16324, -16315,
+    -16305, -16295, -16284, -16273, -16261, -16248, -16235, -16221,
+    -16207, -16192, -16176, -16160, -16143, -16125, -16107, -16088,
+    -16069, -16049, -16029, -16008, -15986, -15964, -15941, -15917,
+    -15893, -15868, -15843, -15817, -15791, -15763, -15736, -15707,
+    -15679, -15649, -15619, -15588, -15557, -15525, -15493, -15460,
+    -15426, -15392, -15357, -15322, -15286, -15250, -15213, -15175,
+    -15137, -15098, -15059, -15019, -14978, -14937, -14896, -14854,
+    -14811, -14768, -14724, -14680, -14635, -14589, -14543, -14497,
+    -14449, -14402, -14354, -14305, -14256, -14206, -14155, -14104,
+    -14053, -14001, -13949, -13896, -13842, -13788, -13733, -13678,
+    -13623, -13567, -13510, -13453, -13395, -13337, -13279, -13219,
+    -13160, -13100, -13039, -12978, -12916, -12854, -12792, -12729,
+    -12665, -12601, -12537, -12472, -12406, -12340, -12274, -12207,
+    -12140, -12072, -12004, -11935, -11866, -11797, -11727, -11656,
+    -11585, -11514, -11442, -11370, -11297, -11224, -11151, -11077,
+    -11003, -10928, -10853, -10778, -10702, -10625, -10549, -10471,
+    -10394, -10316, -10238, -10159, -10080, -10001, -9921, -9841,
+    -9760, -9679, -9598, -9516, -9434, -9352, -9269, -9186,
+    -9102, -9019, -8935, -8850, -8765, -8680, -8595, -8509,
+    -8423, -8337, -8250, -8163, -8076, -7988, -7900, -7812,
+    -7723, -7635, -7545, -7456, -7366, -7276, -7186, -7096,
+    -7005, -6914, -6823, -6731, -6639, -6547, -6455, -6363,
+    -6270, -6177, -6084, -5990, -5897, -5803, -5708, -5614,
+    -5520, -5425, -5330, -5235, -5139, -5044, -4948, -4852,
+    -4756, -4660, -4563, -4467, -4370, -4273, -4176, -4078,
+    -3981, -3883, -3786, -3688, -3590, -3492, -3393, -3295,
+    -3196, -3098, -2999, -2900, -2801, -2702, -2603, -2503,
+    -2404, -2305, -2205, -2105, -2006, -1906, -1806, -1706,
+    -1606, -1506, -1406, -1306, -1205, -1105, -1005, -904,
+    -804, -704, -603, -503, -402, -302, -201, -101,
+    0
+};
+
+const float synth_note_freq[SYNTH_NOTE_COUNT] = {
+    8.17579892f, 8.66195722f, 9.177024f, 9.72271824f, 10.3008612f, 10.9133822f, 11.5623257f, 12.2498574f,
+    12.9782718f, 13.75f, 14.5676175f, 15.4338532f, 16.3515978f, 17.3239144f, 18.354048f, 19.4454365f,
+    20.6017223f, 21.8267645f, 23.1246514f, 24.4997147f, 25.9565436f, 27.5f, 29.1352351f, 30.8677063f,
+    32.7031957f, 34.6478289f, 36.708096f, 38.890873f, 41.2034446f, 43.6535289f, 46.2493028f, 48.9994295f,
+    51.9130872f, 55.0f, 58.2704702f, 61.7354127f, 65.4063913f, 69.2956577f, 73.416192f, 77.7817459f,
+    82.4068892f, 87.3070579f, 92.4986057f, 97.998859f, 103.826174f, 110.0f, 116.54094f, 123.470825f,
+    130.812783f, 138.591315f, 146.832384f, 155.563492f, 164.813778f, 174.614116f, 184.997211f, 195.997718f,
+    207.652349f, 220.0f, 233.081881f, 246.941651f, 261.625565f, 277.182631f, 293.664768f, 311.126984f,
+    329.627557f, 349.228231f, 369.994423f, 391.995436f, 415.304698f, 440.0f, 466.163762f, 493.883301f,
+    523.251131f, 554.365262f, 587.329536f, 622.253967f, 659.255114f, 698.456463f, 739.988845f, 783.990872f,
+    830.609395f, 880.0f, 932.327523f, 987.766603f, 1046.50226f, 1108.73052f, 1174.65907f, 1244.50793f,
+    1318.51023f, 1396.91293f, 1479.97769f, 1567.98174f, 1661.21879f, 1760.0f, 1864.65505f, 1975.53321f,
+    2093.00452f, 2217.46105f, 2349.31814f, 2489.01587f, 2637.02046f, 2793.82585f, 2959.95538f, 3135.96349f,
+    3322.43758f, 3520.0f, 3729.31009f, 3951.06641f, 4186.00904f, 4434.9221f, 4698.63629f, 4978.03174f,
+    5274.04091f, 5587.6517f, 5919.91076f, 6271.92698f, 6644.87516f, 7040.0f, 7458.62018f, 7902.13282f,
+    8372.01809f, 8869.84419f, 9397.27257f, 9956.06348f, 10548.0818f, 11175.3034f, 11839.8215f, 12543.854f
+};
+
+const uint32_t synth_note_increment[SYNTH_NOTE_COUNT] = {
+    796254, 843601, 893765, 946911, 1003217, 1062871, 1126073, 1193033,
+    1263974, 1339134, 1418763, 1503127, 1592507, 1687203, 1787529, 1893821,
+    2006434, 2125742, 2252146, 2386065, 2527948, 2678268, 2837526, 3006254,
+    3185015, 3374406, 3575058, 3787642, 4012867, 4251485, 4504291, 4772130,
+    5055896, 5356535, 5675051, 6012507, 6370030, 6748811, 7150117, 7575285,
+    8025735, 8502970, 9008582, 9544261, 10111792, 10713070, 11350103, 12025015,
+    12740059, 13497623, 14300233, 15150569, 16051469, 17005939, 18017165, 19088521,
+    20223584, 21426141, 22700205, 24050030, 25480119, 26995246, 28600467, 30301139,
+    32102938, 34011878, 36034330, 38177043, 40447168, 42852281, 45400411, 48100060,
+    50960238, 53990491, 57200933, 60602278, 64205876, 68023757, 72068660, 76354085,
+    80894335, 85704563, 90800821, 96200119, 101920476, 107980983, 114401866, 121204555,
+    128411753, 136047513, 144137319, 152708170, 161788671, 171409126, 181601643, 192400238,
+    203840952, 215961966, 228803732, 242409110, 256823506, 272095026, 288274639, 305416341,
+    323577341, 342818251, 363203285, 384800477, 407681904, 431923931, 457607465, 484818220,
+    513647012, 544190053, 576549277, 610832681, 647154683, 685636503, 726406571, 769600953,
+    815363807, 863847862, 915214929, 969636441, 1027294024, 1088380105, 1153098554, 1221665363
+};
+
+const float synth_fir_bank[SYNTH_FIR_BANK_SIZE][SYNTH_FIR_BANK_TAPS] SYNTH_TABLE_ALIGN = {
+  { // 20.0 Hz
+    0.00234330401f, 0.00241046494f, 0.00261089819f, 0.00294264497f, 0.00340243882f, 0.00398573792f, 0.00468677014f, 0.00549859029f,
+    0.00641314917f, 0.00742137354f, 0.00851325632f, 0.00967795618f, 0.0109039053f, 0.0121789246f, 0.0134903449f, 0.0148251329f,
+    0.0161700212f, 0.0175116401f, 0.0188366508f, 0.0201318785f, 0.0213844432f, 0.0225818884f, 0.0237123045f, 0.0247644483f,
+    0.0257278543f, 0.0265929393f, 0.0273510976f, 0.0279947872f, 0.0285176044f, 0.0289143479f, 0.0291810704f, 0.0293151184f,
+    0.0293151581f, 0.0291811889f, 0.0289145435f, 0.0285178746f, 0.0279951282f, 0.0273515048f, 0.0265934071f, 0.0257283766f,
+    0.024765018f, 0.0237129142f, 0.0225825302f, 0.0213851089f, 0.0201325597f, 0.0188373391f, 0.0175123274f, 0.0161706997f,
+    0.0148257951f, 0.013490984f, 0.0121795346f, 0.0109044809f, 0.0096784933f, 0.00851375186f, 0.00742182562f, 0.00641355721f,
+    0.00549895504f, 0.00468709373f, 0.00398602392f, 0.00340269218f, 0.00294287207f, 0.00261110676f, 0.00241066404f, 0.00234350391f
+  },
+  { // 21.8 Hz
+    0.0023428028f, 0.00240998705f, 0.00261042007f, 0.00294214918f, 0.00340191367f, 0.00398517713f, 0.00468617232f, 0.00549795848f,
+    0.00641249022f, 0.00742069751f, 0.00851257585f, 0.00967728581f, 0.0109032609f, 0.0121783227f, 0.0134898019f, 0.0148246649f,
+    0.016169643f, 0.017511365f, 0.0188364904f, 0.0201318419f, 0.0213845369f, 0.022582116f, 0.023712667f, 0.0247649435f,
+    0.0257284772f, 0.026593682f, 0.0273519497f, 0.0279957357f, 0.0285186342f, 0.0289154422f, 0.029182211f, 0.029316286f,
+    0.029316333f, 0.0291823512f, 0.0289156737f, 0.0285189539f, 0.0279961391f, 0.0273524315f, 0.0265942356f, 0.0257290952f,
+    0.0247656177f, 0.0237133884f, 0.0225828754f, 0.0213853245f, 0.0201326478f, 0.0188373049f, 0.0175121783f, 0.0161704457f,
+    0.0148254483f, 0.0134905581f, 0.0121790443f, 0.010903942f, 0.0096779213f, 0.00851316214f, 0.00742123239f, 0.00641297299f,
+    0.00549839002f, 0.00468655517f, 0.00398551548f, 0.00340221342f, 0.00294241785f, 0.00261066683f, 0.00241022259f, 0.00234303929f
+  },
+  { // 23.7 Hz
+    0.00234220984f, 0.00240942167f, 0.00260985442f, 0.0029415626f, 0.00340129236f, 0.00398451364f, 0.00468546503f, 0.00549721097f,
+    0.00641171059f, 0.00741989765f, 0.00851177072f, 0.00967649264f, 0.0109024984f, 0.0121776104f, 0.0134891594f, 0.014824111f,
+    0.0161691954f, 0.0175110396f, 0.0188363006f, 0.0201317985f, 0.0213846476f, 0.0225823853f, 0.0237130959f, 0.0247655294f,
+    0.0257292142f, 0.0265945608f, 0.0273529579f, 0.0279968579f, 0.0285198527f, 0.028916737f, 0.0291835605f, 0.0293176676f,
+    0.0293177231f, 0.0291837264f, 0.0289170109f, 0.0285202309f, 0.0279973353f, 0.0273535279f, 0.0265952158f, 0.0257299454f,
+    0.0247663271f, 0.0237139495f, 0.0225832838f, 0.0213855795f, 0.0201327521f, 0.0188372643f, 0.0175120018f, 0.0161701452f,
+    0.014825038f, 0.013490054f, 0.0121784642f, 0.0109033042f, 0.00967724452f, 0.00851246438f, 0.00742053048f, 0.00641228175f,
+    0.00549772153f, 0.00468591797f, 0.00398491394f, 0.00340164698f, 0.00294188046f, 0.00261014634f, 0.00240970032f, 0.00234248961f
+  },
+  { // 25.7 Hz
+    0.00234150834f, 0.00240875279f, 0.00260918522f, 0.00294086864f, 0.00340055729f, 0.00398372865f, 0.00468462821f, 0.00549632655f,
+    0.00641078816f, 0.00741895129f, 0.00851081811f, 0.00967555417f, 0.0109015963f, 0.0121767676f, 0.0134883991f, 0.0148234556f,
+    0.0161686658f, 0.0175106545f, 0.018836076f, 0.0201317471f, 0.0213847786f, 0.0225827039f, 0.0237136032f, 0.0247662227f,
+    0.0257300862f, 0.0265956006f, 0.0273541507f, 0.0279981857f, 0.0285212944f, 0.028918269f, 0.0291851573f, 0.0293193022f,
+    0.0293193679f, 0.0291853536f, 0.0289185931f, 0.0285217419f, 0.0279987506f, 0.0273548252f, 0.0265963756f, 0.0257309514f,
+    0.0247671665f, 0.0237146133f, 0.022583767f, 0.0213858812f, 0.0201328754f, 0.0188372162f, 0.017511793f, 0.0161697896f,
+    0.0148245524f, 0.0134894576f, 0.0121777778f, 0.0109025496f, 0.00967644374f, 0.0085116388f, 0.0074197f, 0.00641146391f,
+    0.00549693059f, 0.00468516408f, 0.00398420224f, 0.00340097683f, 0.00294124468f, 0.00260953057f, 0.00240908244f, 0.00234183931f
+  },
+  { // 28.0 Hz
+    0.00234067846f, 0.00240796148f, 0.00260839352f, 0.00294004764f, 0.00339968765f, 0.00398279994f, 0.00468363816f, 0.00549528018f,
+    0.0064096968f, 0.0074178316f, 0.00850969101f, 0.00967444377f, 0.0109005288f, 0.0121757704f, 0.0134874995f, 0.0148226801f,
+    0.0161680391f, 0.0175101988f, 0.0188358101f, 0.0201316862f, 0.0213849335f, 0.0225830808f, 0.0237142035f, 0.0247670428f,
+    0.0257311179f, 0.0265968308f, 0.0273555621f, 0.0279997568f, 0.0285230002f, 0.0289200816f, 0.0291870466f, 0.0293212363f,
+    0.0293213141f, 0.0291872788f, 0.0289204651f, 0.0285235297f, 0.0280004251f, 0.0273563601f, 0.0265977479f, 0.0257321416f,
+    0.0247681596f, 0.0237153986f, 0.0225843387f, 0.0213862381f, 0.0201330212f, 0.0188371592f, 0.0175115458f, 0.0161693688f,
+    0.0148239778f, 0.0134887519f, 0.0121769657f, 0.0109016568f, 0.00967549625f, 0.00851066198f, 0.0074187174f, 0.00641049627f,
+    0.0054959948f, 0.00468427213f, 0.00398336022f, 0.00340018398f, 0.0029404925f, 0.00260880207f, 0.00240835145f, 0.00234106999f
+  },
+  { // 30.5 Hz
+    0.00233969673f, 0.00240702537f, 0.00260745691f, 0.00293907636f, 0.0033986588f, 0.0039817012f, 0.00468246684f, 0.00549404218f,
+    0.00640840555f, 0.00741650682f, 0.00850835744f, 0.00967312996f, 0.0108992658f, 0.0121745905f, 0.0134864351f, 0.0148217625f,
+    0.0161672975f, 0.0175096595f, 0.0188354955f, 0.020131614f, 0.0213851167f, 0.0225835266f, 0.0237149137f, 0.0247680132f,
+    0.0257323386f, 0.0265982864f, 0.027357232f, 0.0280016156f, 0.0285250185f, 0.0289222264f, 0.0291892821f, 0.0293235248f,
+    0.0293236168f, 0.0291895568f, 0.0289226802f, 0.028525645f, 0.0280024064f, 0.0273581763f, 0.0265993715f, 0.0257335499f,
+    0.0247693345f, 0.0237163278f, 0.022585015f, 0.0213866604f, 0.0201331937f, 0.0188370917f, 0.0175112533f, 0.0161688707f,
+    0.0148232979f, 0.0134879169f, 0.0121760046f, 0.0109006003f, 0.00967437516f, 0.00850950621f, 0.0074175548f, 0.00640935139f,
+    0.00549488762f, 0.00468321685f, 0.00398236403f, 0.00339924596f, 0.00293960262f, 0.00260794021f, 0.00240748668f, 0.00234015988f
+  },
+  { // 33.1 Hz
+    0.0023385354f, 0.00240591797f, 0.00260634891f, 0.00293792731f, 0.00339744163f, 0.00398040132f, 0.00468108105f, 0.0054925775f,
+    0.00640687784f, 0.00741493939f, 0.0085067796f, 0.00967157544f, 0.0108977713f, 0.0121731943f, 0.0134851755f, 0.0148206766f,
+    0.01616642f, 0.0175090212f, 0.018835123f, 0.0201315285f, 0.0213853332f, 0.022584054f, 0.0237157538f, 0.0247691612f,
+    0.0257337828f, 0.0266000086f, 0.0273592077f, 0.028003815f, 0.0285274065f, 0.0289247641f, 0.0291919271f, 0.0293262325f,
+    0.0293263414f, 0.0291922522f, 0.028925301f, 0.028528148f, 0.0280047508f, 0.0273603251f, 0.0266012925f, 0.0257352161f,
+    0.0247707247f, 0.023717427f, 0.0225858151f, 0.0213871598f, 0.0201333976f, 0.0188370117f, 0.017510907f, 0.0161682813f,
+    0.0148224933f, 0.0134869287f, 0.0121748675f, 0.0108993503f, 0.00967304866f, 0.00850813869f, 0.00741617924f, 0.00640799682f,
+    0.00549357769f, 0.00468196833f, 0.00398118543f, 0.00339813623f, 0.00293854985f, 0.00260692063f, 0.00240646365f, 0.00233908324f
+  },
+  { // 36.0 Hz
+    0.00233716164f, 0.00240460798f, 0.00260503819f, 0.00293656799f, 0.0033960017f, 0.00397886349f, 0.00467944155f, 0.00549084463f,
+    0.00640507036f, 0.00741308489f, 0.00850491271f, 0.00966973612f, 0.010896003f, 0.0121715423f, 0.0134836851f, 0.0148193917f,
+    0.0161653814f, 0.0175082658f, 0.0188346821f, 0.0201314271f, 0.0213855893f, 0.0225846778f, 0.0237167477f, 0.0247705194f,
+    0.0257354915f, 0.0266020462f, 0.0273615454f, 0.0280064173f, 0.0285302321f, 0.0289277667f, 0.0291950568f, 0.0293294364f,
+    0.0293295653f, 0.0291954415f, 0.0289284021f, 0.0285311094f, 0.0280075246f, 0.0273628676f, 0.0266035655f, 0.0257371875f,
+    0.0247723694f, 0.0237187275f, 0.0225867617f, 0.0213877505f, 0.0201336386f, 0.0188369168f, 0.0175104971f, 0.0161675838f,
+    0.014821541f, 0.0134857594f, 0.0121735219f, 0.0108978711f, 0.00967147909f, 0.00850652063f, 0.00741455169f, 0.00640639416f,
+    0.00549202786f, 0.0046804912f, 0.00397979107f, 0.00339682336f, 0.00293730441f, 0.00260571446f, 0.00240525345f, 0.00233780965f
+  },
+  { // 39.2 Hz
+    0.00233553669f, 0.00240305842f, 0.0026034877f, 0.00293495998f, 0.00339429826f, 0.0039770442f, 0.00467750194f, 0.00548879449f,
+    0.0064029319f, 0.00741089073f, 0.00850270385f, 0.00966755981f, 0.0108939107f, 0.0121695874f, 0.0134819214f, 0.0148178711f,
+    0.0161641523f, 0.0175073717f, 0.0188341601f, 0.0201313069f, 0.021385892f, 0.0225854157f, 0.0237179235f, 0.0247721262f,
+    0.0257375131f, 0.026604457f, 0.0273643114f, 0.0280094964f, 0.0285335754f, 0.0289313196f, 0.0291987599f, 0.0293332274f,
+    0.0293333799f, 0.0291992152f, 0.0289320714f, 0.0285346136f, 0.0280108066f, 0.0273658759f, 0.0266062548f, 0.0257395199f,
+    0.0247743154f, 0.0237202662f, 0.0225878814f, 0.0213884493f, 0.0201339236f, 0.0188368043f, 0.0175100118f, 0.0161667582f,
+    0.0148204142f, 0.0134843756f, 0.0121719296f, 0.0108961208f, 0.0096696219f, 0.00850460612f, 0.00741262602f, 0.00640449796f,
+    0.00549019424f, 0.00467874362f, 0.00397814146f, 0.0033952702f, 0.00293583105f, 0.00260428761f, 0.00240382187f, 0.00233630313f
+  },
+  { // 42.6 Hz
+    0.0023336147f, 0.00240122552f, 0.00260165366f, 0.00293305782f, 0.00339228316f, 0.00397489198f, 0.00467520731f, 0.00548636902f,
+    0.00640040186f, 0.00740829472f, 0.00850009036f, 0.00966498476f, 0.0108914349f, 0.0121672743f, 0.0134798343f, 0.0148160715f,
+    0.0161626977f, 0.0175063134f, 0.0188335421f, 0.0201311641f, 0.0213862497f, 0.0225862883f, 0.0237193143f, 0.0247740272f,
+    0.0257399049f, 0.0266073094f, 0.027367584f, 0.0280131396f, 0.0285375313f, 0.0289355235f, 0.0292031417f, 0.0293377131f,
+    0.0293378936f, 0.0292036804f, 0.0289364132f, 0.0285387598f, 0.02801469f, 0.0273694354f, 0.0266094368f, 0.0257422796f,
+    0.0247766176f, 0.0237220864f, 0.022589206f, 0.0213892757f, 0.0201342604f, 0.0188366707f, 0.0175094372f, 0.0161657809f,
+    0.0148190805f, 0.0134827381f, 0.0121700453f, 0.0108940497f, 0.00966742435f, 0.00850234083f, 0.00741034759f, 0.00640225449f,
+    0.00548802486f, 0.00467667611f, 0.00397618991f, 0.00339343281f, 0.00293408813f, 0.00260259977f, 0.00240212848f, 0.00233452115f
+  },
+  { // 46.4 Hz
+    0.0023313415f, 0.00239905762f, 0.0025994843f, 0.00293080781f, 0.00338989946f, 0.00397234598f, 0.00467249273f, 0.00548349956f,
+    0.00639740858f, 0.00740522327f, 0.00849699812f, 0.00966193786f, 0.0108885054f, 0.012164537f, 0.0134773645f, 0.0148139419f,
+    0.0161609761f, 0.0175050607f, 0.0188328102f, 0.0201309947f, 0.0213866725f, 0.0225873204f, 0.0237209596f, 0.0247762761f,
+    0.0257427346f, 0.0266106842f, 0.0273714561f, 0.0280174502f, 0.0285422121f, 0.0289404977f, 0.0292083264f, 0.0293430209f,
+    0.0293432344f, 0.0292089639f, 0.0289415505f, 0.0285436658f, 0.028019285f, 0.027373647f, 0.0266132016f, 0.0257455446f,
+    0.0247793415f, 0.0237242398f, 0.0225907729f, 0.021390253f, 0.0201346584f, 0.0188365122f, 0.0175087568f, 0.0161646241f,
+    0.0148175019f, 0.0134808f, 0.0121678155f, 0.0108915989f, 0.00966482404f, 0.00849966046f, 0.00740765178f, 0.00639960014f,
+    0.00548545827f, 0.00467423014f, 0.00397388121f, 0.00339125925f, 0.0029320264f, 0.00260060325f, 0.0024001255f, 0.00233241347f
+  },
+  { // 50.4 Hz
+    0.00232865311f, 0.00239649362f, 0.00259691846f, 0.00292814645f, 0.00338707984f, 0.00396933425f, 0.00466928145f, 0.0054801049f,
+    0.00639386727f, 0.00740158932f, 0.00849333941f, 0.00965833265f, 0.0108850388f, 0.0121612979f, 0.0134744416f, 0.0148114213f,
+    0.0161589382f, 0.0175035776f, 0.0188319435f, 0.0201307934f, 0.0213871719f, 0.0225885408f, 0.0237229056f, 0.0247789366f,
+    0.0257460824f, 0.0266146772f, 0.0273760376f, 0.0280225507f, 0.0285477506f, 0.0289463835f, 0.0292144614f, 0.0293493016f,
+    0.0293495542f, 0.0292152159f, 0.0289476295f, 0.028549471f, 0.0280247221f, 0.0273786303f, 0.0266176562f, 0.0257494077f,
+    0.024782564f, 0.0237267873f, 0.0225926262f, 0.0213914088f, 0.0201351286f, 0.0188363238f, 0.017507951f, 0.0161632546f,
+    0.0148156335f, 0.0134785064f, 0.0121651766f, 0.0108886987f, 0.00966174708f, 0.00849648894f, 0.00740446213f, 0.00639645968f,
+    0.00548242178f, 0.00467133647f, 0.00397115006f, 0.00338868808f, 0.00292958763f, 0.00259824174f, 0.00239775644f, 0.00232992069f
+  },
+  { // 54.9 Hz
+    0.00232547394f, 0.00239346138f, 0.00259388387f, 0.00292499871f, 0.00338374475f, 0.00396577172f, 0.00466548267f, 0.005476089f,
+    0.00638967767f, 0.0073972899f, 0.00848901046f, 0.00965406677f, 0.0108809368f, 0.0121574646f, 0.0134709825f, 0.0148084381f,
+    0.016156526f, 0.0175018217f, 0.0188309167f, 0.0201305541f, 0.0213877617f, 0.0225899838f, 0.0237252074f, 0.0247820838f,
+    0.0257500431f, 0.0266194014f, 0.0273814584f, 0.0280285858f, 0.0285543041f, 0.0289533482f, 0.0292217209f, 0.0293567335f,
+    0.0293570325f, 0.0292226138f, 0.0289548227f, 0.0285563401f, 0.0280311555f, 0.0273845268f, 0.0266229269f, 0.0257539784f,
+    0.0247863764f, 0.0237298009f, 0.0225948183f, 0.0213927754f, 0.0201356839f, 0.0188360999f, 0.0175069965f, 0.0161616331f,
+    0.0148134218f, 0.0134757916f, 0.0121620535f, 0.0108852666f, 0.00965810605f, 0.00849273621f, 0.00740068816f, 0.00639274411f,
+    0.0054788294f, 0.00466791324f, 0.00396791926f, 0.0033856467f, 0.002926703f, 0.00259544865f, 0.00239495458f, 0.00232697269f
+  },
+  { // 59.7 Hz
+    0.00232171477f, 0.00238987569f, 0.00259029517f, 0.00292127596f, 0.00337980015f, 0.00396155787f, 0.00466098909f, 0.00547133828f,
+    0.00638472117f, 0.00739220317f, 0.00848388847f, 0.00964901908f, 0.0108760827f, 0.0121529283f, 0.0134668884f, 0.0148049069f,
+    0.0161536703f, 0.0174997425f, 0.0188297003f, 0.0201302693f, 0.0213884581f, 0.0225916899f, 0.0237279298f, 0.0247858067f,
+    0.0257547288f, 0.0266249908f, 0.0273878723f, 0.0280357269f, 0.0285620587f, 0.0289615894f, 0.0292303113f, 0.0293655279f,
+    0.0293658818f, 0.0292313681f, 0.0289633346f, 0.0285644684f, 0.028038768f, 0.0273915037f, 0.0266291631f, 0.025759386f,
+    0.0247908868f, 0.0237333658f, 0.022597411f, 0.021394391f, 0.0201363395f, 0.0188358334f, 0.0175058655f, 0.0161597131f,
+    0.0148108035f, 0.0134725782f, 0.0121583573f, 0.0108812049f, 0.00965379744f, 0.00848829573f, 0.00739622283f, 0.00638834816f,
+    0.00547457945f, 0.00466386365f, 0.00396409755f, 0.00338204925f, 0.0029232912f, 0.00259214533f, 0.0023916411f, 0.00232348661f
+  },
+  { // 64.9 Hz
+    0.0023172703f, 0.00238563598f, 0.00258605155f, 0.00291687348f, 0.00337513496f, 0.00395657386f, 0.00465567385f, 0.00546571848f,
+    0.00637885751f, 0.007386185f, 0.00847782815f, 0.00964304621f, 0.0108703384f, 0.0121475595f, 0.0134620427f, 0.0148007269f,
+    0.0161502892f, 0.01749728f, 0.0188282586f, 0.0201299301f, 0.02138928f, 0.0225937067f, 0.0237311494f, 0.0247902105f,
+    0.0257602722f, 0.0266316038f, 0.0273954613f, 0.0280441765f, 0.0285712347f, 0.0289713415f, 0.0292404766f, 0.0293759348f,
+    0.0293763537f, 0.0292417274f, 0.0289734071f, 0.0285740868f, 0.028047776f, 0.0273997592f, 0.0266365418f, 0.0257657841f,
+    0.0247962227f, 0.0237375826f, 0.0226004772f, 0.021396301f, 0.0201371133f, 0.018835516f, 0.0175045252f, 0.0161574392f,
+    0.0148077035f, 0.0134687743f, 0.0121539824f, 0.010876398f, 0.00964869871f, 0.00848304137f, 0.00739093947f, 0.00638314725f,
+    0.00546955166f, 0.00465907323f, 0.00395957702f, 0.00337779433f, 0.00291925614f, 0.00258823886f, 0.00238772293f, 0.00231936468f
+  },
+  { // 70.6 Hz
+    0.00231201629f, 0.00238062355f, 0.00258103403f, 0.00291166764f, 0.00336961799f, 0.00395067933f, 0.00464938702f, 0.00545907084f,
+    0.00637192083f, 0.00737906492f, 0.00847065756f, 0.00963597847f, 0.0108635405f, 0.0121412054f, 0.0134563068f, 0.0147957783f,
+    0.0161462857f, 0.0174943632f, 0.0188265496f, 0.0201295256f, 0.0213902496f, 0.0225960905f, 0.0237349567f, 0.0247954195f,
+    0.02576683f, 0.0266394278f, 0.0274044407f, 0.0280541748f, 0.0285820929f, 0.0289828818f, 0.0292525061f, 0.0293882503f,
+    0.029388746f, 0.0292539866f, 0.0289853267f, 0.0285854687f, 0.0280584352f, 0.0274095277f, 0.0266452725f, 0.0257733537f,
+    0.0248025352f, 0.0237425704f, 0.0226041031f, 0.0213985583f, 0.0201380261f, 0.0188351375f, 0.0175029364f, 0.0161547458f,
+    0.0148040328f, 0.013464271f, 0.0121488039f, 0.0108707088f, 0.00964266477f, 0.00847682384f, 0.00738468818f, 0.00637699407f,
+    0.00546360379f, 0.00465340667f, 0.00395423017f, 0.00337276207f, 0.00291448434f, 0.00258361955f, 0.00238309021f, 0.00231449149f
+  },
+  { // 76.8 Hz
+    0.00230580631f, 0.00237469842f, 0.00257510221f, 0.00290551253f, 0.00336309429f, 0.00394370846f, 0.00464195144f, 0.00545120772f,
+    0.00636371498f, 0.00737064127f, 0.00846217329f, 0.009627615f, 0.0108554954f, 0.0121336846f, 0.0134495169f, 0.0147899192f,
+    0.0161415445f, 0.0174909076f, 0.0188245229f, 0.0201290426f, 0.0213913927f, 0.0225989073f, 0.0237394584f, 0.0248015805f,
+    0.0257745878f, 0.0266486846f, 0.0274150653f, 0.0280660057f, 0.028594942f, 0.0289965383f, 0.0292667419f, 0.0294028247f,
+    0.0294034116f, 0.0292684945f, 0.0289994325f, 0.028598938f, 0.0280710489f, 0.0274210868f, 0.0266556027f, 0.0257823095f,
+    0.0248100026f, 0.0237484698f, 0.0226083904f, 0.0214012259f, 0.0201391023f, 0.0188346856f, 0.0175010522f, 0.0161515548f,
+    0.0147996857f, 0.0134589393f, 0.0121426737f, 0.010863975f, 0.00963552382f, 0.00846946644f, 0.00737729163f, 0.00636971434f,
+    0.00545656769f, 0.00464670401f, 0.00394790633f, 0.00336681091f, 0.0029088418f, 0.00257815791f, 0.00237761331f, 0.00230873096f
+  },
+  { // 83.5 Hz
+    0.0022984678f, 0.00236769558f, 0.00256809054f, 0.00289823596f, 0.00335538102f, 0.00393546543f, 0.00463315783f, 0.00544190736f,
+    0.00635400808f, 0.00736067553f, 0.00845213461f, 0.009617718f, 0.0108459739f, 0.0121247824f, 0.0134414784f, 0.0147829814f,
+    0.0161359287f, 0.0174868125f, 0.0188221186f, 0.0201284649f, 0.0213927394f, 0.0226022351f, 0.0237447808f, 0.0248088671f,
+    0.0257837649f, 0.0266596363f, 0.0274276366f, 0.0280800054f, 0.0286101473f, 0.0290126999f, 0.0292835895f, 0.0294200733f,
+    0.0294207681f, 0.0292856643f, 0.0290161262f, 0.028614878f, 0.0280859756f, 0.0274347648f, 0.0266678258f, 0.0257929052f,
+    0.0248188362f, 0.023755447f, 0.0226134591f, 0.0214043773f, 0.0201403702f, 0.0188341451f, 0.0174988169f, 0.0161477733f,
+    0.0147945367f, 0.0134526258f, 0.0121354163f, 0.0108560043f, 0.00962707239f, 0.00846076f, 0.00736853994f, 0.00636110194f,
+    0.00544824451f, 0.00463877622f, 0.0039404275f, 0.0033597737f, 0.00290217035f, 0.00257170117f, 0.00237113938f, 0.00230192265f
+  },
+  { // 90.9 Hz
+    0.00228979763f, 0.00235942067f, 0.00255980389f, 0.00288963493f, 0.00334626242f, 0.00392571914f, 0.00462275904f, 0.00543090774f,
+    0.00634252601f, 0.0073488856f, 0.00844025668f, 0.00960600597f, 0.0108347045f, 0.012114244f, 0.0134319607f, 0.0147747649f,
+    0.0161292756f, 0.0174819584f, 0.0188192649f, 0.0201277728f, 0.0213943249f, 0.0226061655f, 0.0237510724f, 0.0248174842f,
+    0.0257946203f, 0.0266725933f, 0.0274425114f, 0.0280965718f, 0.0286281415f, 0.0290318266f, 0.0293035287f, 0.0294404876f,
+    0.0294413102f, 0.0293059853f, 0.0290358833f, 0.0286337424f, 0.0281036401f, 0.0274509505f, 0.0266822885f, 0.0258054409f,
+    0.0248292854f, 0.0237636982f, 0.022619451f, 0.0214080994f, 0.0201418629f, 0.0188334974f, 0.0174961638f, 0.0161432908f,
+    0.0147884367f, 0.0134451487f, 0.0121268234f, 0.0108465687f, 0.00961706946f, 0.00845045686f, 0.0073581848f, 0.00635091307f,
+    0.0054383992f, 0.00462939995f, 0.00393158349f, 0.00335145312f, 0.0028942834f, 0.00256406919f, 0.00236348825f, 0.00229387761f
+  },
+  { // 98.9 Hz
+    0.00227955691f, 0.00234964494f, 0.00255001247f, 0.0028794702f, 0.00333548411f, 0.00391419687f, 0.00461046326f, 0.00541789933f,
+    0.00632894476f, 0.00733493786f, 0.00842620243f, 0.00959214558f, 0.0108213654f, 0.0121017678f, 0.0134206901f, 0.0147650323f,
+    0.0161213918f, 0.0174762025f, 0.0188158757f, 0.0201269417f, 0.0213961897f, 0.0226108062f, 0.0237585086f, 0.0248276739f,
+    0.0258074607f, 0.0266879224f, 0.027460112f, 0.028116176f, 0.028649437f, 0.0290544636f, 0.0293271282f, 0.0294646499f,
+    0.029465624f, 0.0293300372f, 0.0290592673f, 0.0286560691f, 0.0281245454f, 0.0274701042f, 0.0266994015f, 0.0258202717f,
+    0.0248416453f, 0.0237734552f, 0.0226265328f, 0.0214124942f, 0.0201436185f, 0.0188327198f, 0.0174930129f, 0.0161379757f,
+    0.0147812083f, 0.013436292f, 0.0121166479f, 0.010835398f, 0.00960522949f, 0.0084382638f, 0.00734593236f, 0.00633885943f,
+    0.00542675396f, 0.00461831136f, 0.00392112613f, 0.00334161637f, 0.00288496092f, 0.00255504969f, 0.00235444775f, 0.00228437344f
+  },
+  { // 107.5 Hz
+    0.00226746497f, 0.00233809944f, 0.00253844591f, 0.00286746007f, 0.00332274632f, 0.00390057705f, 0.00459592618f, 0.00540251663f,
+    0.00631288146f, 0.0073184378f, 0.00840957302f, 0.00957574214f, 0.0108055755f, 0.0120869957f, 0.0134073419f, 0.0147535017f,
+    0.016112047f, 0.0174693746f, 0.0188118481f, 0.0201259414f, 0.0213983805f, 0.0226162833f, 0.0237672957f, 0.0248397219f,
+    0.025822648f, 0.0267060576f, 0.027480938f, 0.0281393757f, 0.0286746404f, 0.0290812566f, 0.0293550616f, 0.0294932501f,
+    0.0294944038f, 0.0293585068f, 0.0290869456f, 0.0286824947f, 0.0281492871f, 0.0274927709f, 0.0267196506f, 0.0258378174f,
+    0.0248562642f, 0.0237849917f, 0.0226349013f, 0.021417681f, 0.020145681f, 0.0188317838f, 0.0174892685f, 0.0161316707f,
+    0.0147726404f, 0.013425799f, 0.0121045967f, 0.0108221717f, 0.00959121408f, 0.0084238336f, 0.0073314349f, 0.00632460007f,
+    0.00541298049f, 0.00460519888f, 0.00390876257f, 0.0033299889f, 0.00287394362f, 0.0025443927f, 0.00234376825f, 0.00227314867f
+  },
+  { // 117.0 Hz
+    0.00225319257f, 0.00232446838f, 0.00252478641f, 0.00285327311f, 0.00330769606f, 0.00388448071f, 0.00457874165f, 0.00538432817f,
+    0.00629388379f, 0.00729891898f, 0.00838989647f, 0.00955632819f, 0.0107868828f, 0.0120695029f, 0.0133915301f, 0.0147398375f,
+    0.016100967f, 0.0174612713f, 0.018807058f, 0.020124734f, 0.0214009505f, 0.0226227445f, 0.0237776769f, 0.0248539653f,
+    0.0258406103f, 0.0267275124f, 0.027505581f, 0.0281668313f, 0.0287044706f, 0.0291129705f, 0.0293881272f, 0.0295271061f,
+    0.0295284727f, 0.0293922081f, 0.0291197091f, 0.0287137737f, 0.0281785708f, 0.0275195956f, 0.0267436109f, 0.0258585746f,
+    0.0248735542f, 0.0237986303f, 0.0226447878f, 0.0214237998f, 0.0201481006f, 0.0188306541f, 0.0174848151f, 0.0161241879f,
+    0.0147624814f, 0.0134133645f, 0.0120903213f, 0.0108065095f, 0.00957462212f, 0.00840675504f, 0.00731428096f, 0.00630773188f,
+    0.00539669093f, 0.00458969472f, 0.00389414739f, 0.00331624718f, 0.00286092619f, 0.00253180414f, 0.00233115631f, 0.00225989627f
+  },
+  { // 127.2 Hz
+    0.00223635406f, 0.00230838142f, 0.0025086609f, 0.00283651985f, 0.00328991809f, 0.00386546156f, 0.00455843093f, 0.00536282483f,
+    0.0062714175f, 0.00727582994f, 0.00836661427f, 0.00953335001f, 0.0107647515f, 0.0120487853f, 0.0133727962f, 0.0147236403f,
+    0.0160878244f, 0.0174516493f, 0.0188013558f, 0.0201232721f, 0.0214039607f, 0.0226303625f, 0.0237899377f, 0.0248708016f,
+    0.0258618528f, 0.0267528936f, 0.0275347407f, 0.0281993249f, 0.0287397789f, 0.029150512f, 0.0294272712f, 0.0295671873f,
+    0.0295688064f, 0.0294321061f, 0.0291584956f, 0.0287508005f, 0.0282132322f, 0.0275513424f, 0.0267719628f, 0.0258831306f,
+    0.0248940018f, 0.0238147516f, 0.0226564645f, 0.021431014f, 0.0201509346f, 0.0188292862f, 0.0174795138f, 0.0161153026f,
+    0.0147504314f, 0.013398625f, 0.0120734077f, 0.0107879599f, 0.009554978f, 0.00838654101f, 0.00729398362f, 0.00628777831f,
+    0.00537742721f, 0.0045713649f, 0.00387687345f, 0.00330001021f, 0.00284554949f, 0.00251693842f, 0.0023162675f, 0.00224425619f
+  },
+  { // 138.4 Hz
+    0.00221649866f, 0.00228940508f, 0.00248963212f, 0.00281674322f, 0.00326892447f, 0.00384299454f, 0.00453443009f, 0.00533740625f,
+    0.00624485184f, 0.00724851888f, 0.0083390655f, 0.00950615161f, 0.010738546f, 0.0120242441f, 0.0133505947f, 0.0147044343f,
+    0.0160722283f, 0.0174402163f, 0.0187945604f, 0.0201214957f, 0.0214074792f, 0.0226393382f, 0.0238044137f, 0.0248906991f,
+    0.0258869723f, 0.0267829189f, 0.0275692455f, 0.0282377826f, 0.0287815743f, 0.0291949558f, 0.0294736156f, 0.0296146432f,
+    0.0296165621f, 0.0294793453f, 0.0292044167f, 0.0287946349f, 0.0282542619f, 0.0275889164f, 0.0268055118f, 0.0259121798f,
+    0.0249181813f, 0.0238338043f, 0.0226702508f, 0.0214395141f, 0.0201542471f, 0.018827624f, 0.0174731962f, 0.0161047451f,
+    0.0147361318f, 0.0133811473f, 0.0120533634f, 0.0107659867f, 0.00953171755f, 0.00836261443f, 0.0072699667f, 0.00626417607f,
+    0.00535464849f, 0.00454969766f, 0.00385646112f, 0.00328082973f, 0.00282739148f, 0.00249938996f, 0.00229869806f, 0.00222580701f
+  },
+  { // 150.5 Hz
+    0.00219310068f, 0.00226703304f, 0.00246718848f, 0.00279340763f, 0.00324414258f, 0.00381646258f, 0.00450607548f, 0.00530736486f,
+    0.00621344247f, 0.00721621554f, 0.0083064681f, 0.00947395566f, 0.0107075121f, 0.0119951675f, 0.013324276f, 0.0146816516f,
+    0.0160537109f, 0.0174266214f, 0.0187864524f, 0.0201193283f, 0.0214115819f, 0.0226499054f, 0.0238214981f, 0.0249142094f,
+    0.0259166734f, 0.026818437f, 0.0276100761f, 0.0282833017f, 0.0288310529f, 0.0292475764f, 0.0295284912f, 0.0296708379f,
+    0.0296731126f, 0.0295352833f, 0.0292587911f, 0.0288465339f, 0.028302834f, 0.0276333896f, 0.0268452113f, 0.0259465432f,
+    0.0249467709f, 0.0238563163f, 0.0226865213f, 0.0214495212f, 0.0201581096f, 0.018825596f, 0.0174656582f, 0.0160921913f,
+    0.0147191538f, 0.0133604149f, 0.012029602f, 0.0107399528f, 0.00950417129f, 0.00833429147f, 0.0072415484f, 0.0062362595f,
+    0.00532771652f, 0.00452408986f, 0.00383234597f, 0.00325817895f, 0.00280595687f, 0.00247868351f, 0.00227797567f, 0.00220405645f
+  },
+  { // 163.7 Hz
+    0.00216554891f, 0.00224067539f, 0.00244073283f, 0.00276588669f, 0.00321490155f, 0.00378514148f, 0.00447258686f, 0.00527186744f,
+    0.00617631142f, 0.00717800996f, 0.00826789662f, 0.00943584083f, 0.0106707542f, 0.0119607089f, 0.013293066f, 0.0146546136f,
+    0.0160317113f, 0.0174104415f, 0.0187767638f, 0.0201166721f, 0.0214163514f, 0.0226623341f, 0.0238416515f, 0.0249419812f,
+    0.0259517871f, 0.0268604509f, 0.0276583929f, 0.0283371821f, 0.0288896326f, 0.0293098856f, 0.0295934774f, 0.0297373903f,
+    0.0297400876f, 0.0296015316f, 0.0293231837f, 0.0289079887f, 0.0283603404f, 0.0276860319f, 0.0268921896f, 0.0259871911f,
+    0.0249805704f, 0.0238829088f, 0.0227057144f, 0.0214612913f, 0.0201625999f, 0.0188231105f, 0.0174566508f, 0.0160772503f,
+    0.014698983f, 0.0133358101f, 0.0120014246f, 0.0107091f, 0.00947154439f, 0.00830076164f, 0.00720792194f, 0.0062032422f,
+    0.0052958785f, 0.00449383125f, 0.00380386442f, 0.00323143959f, 0.00278066542f, 0.00245426327f, 0.00225354894f, 0.00217843099f
+  },
+  { // 178.1 Hz
+    0.00213313518f, 0.002209647f, 0.00240956995f, 0.0027334496f, 0.00318041694f, 0.00374818263f, 0.00443304812f, 0.00522993378f,
+    0.00613242381f, 0.00713282748f, 0.0082222561f, 0.0093907149f, 0.0106272087f, 0.0119198605f, 0.0132560411f, 0.0146225084f,
+    0.0160055557f, 0.0173911652f, 0.0187651671f, 0.0201134005f, 0.0214218759f, 0.0226769355f, 0.0238654112f, 0.0249747767f,
+    0.0259932932f, 0.0269101457f, 0.0277155696f, 0.0284009645f, 0.0289589952f, 0.0293836777f, 0.0296704493f, 0.0298162228f,
+    0.0298194228f, 0.029680004f, 0.0293994526f, 0.0289807689f, 0.0284284322f, 0.0277483487f, 0.0269477824f, 0.0260352704f,
+    0.0250205232f, 0.0239143118f, 0.0227283421f, 0.0214751188f, 0.0201678009f, 0.0188200494f, 0.0174458694f, 0.0160594501f,
+    0.0146750018f, 0.0133065941f, 0.0119679972f, 0.0106725262f, 0.00943289266f, 0.00826106411f, 0.0071681327f, 0.00616419547f,
+    0.00525824706f, 0.00445808626f, 0.00377023735f, 0.00319988719f, 0.00275083864f, 0.00242548075f, 0.002224776f, 0.00214826454f
+  },
+  { // 193.7 Hz
+    0.00209504259f, 0.00217315517f, 0.00237289326f, 0.00269524608f, 0.00313977371f, 0.00370459369f, 0.00438638537f, 0.00518041206f,
+    0.0060805608f, 0.00707939956f, 0.00816825106f, 0.00933728268f, 0.0105756112f, 0.0118714215f, 0.0132120972f, 0.0145843623f,
+    0.0159744325f, 0.0173681724f, 0.0187512591f, 0.0201093492f, 0.0214282456f, 0.0226940654f, 0.0238934032f, 0.0250134902f,
+    0.0260423462f, 0.026968922f, 0.0277832323f, 0.0284764749f, 0.0290411364f, 0.0294710831f, 0.0297616346f, 0.0299096203f,
+    0.0299134182f, 0.0297729747f, 0.029489805f, 0.0290669759f, 0.0285090685f, 0.0278221239f, 0.0270135707f, 0.0260921357f,
+    0.0250677404f, 0.0239513815f, 0.0227550004f, 0.0214913409f, 0.0201737978f, 0.0188162585f, 0.0174329393f, 0.0160382179f,
+    0.0146464659f, 0.0132718809f, 0.0119283232f, 0.010629156f, 0.00938709384f, 0.00821405949f, 0.0071210513f, 0.00611802302f,
+    0.00521377713f, 0.00441587309f, 0.00373055142f, 0.00316267457f, 0.00271568509f, 0.0023915815f, 0.0021909121f, 0.00211278644f
+  },
+  { // 210.7 Hz
+    0.00205033393f, 0.00213028718f, 0.00232977073f, 0.00265029043f, 0.00309190768f, 0.00365321702f, 0.00433134217f, 0.00512195087f,
+    0.00601928841f, 0.00701622965f, 0.00810434907f, 0.00927400796f, 0.0105144579f, 0.0118139592f, 0.0131599131f, 0.0145390055f,
+    0.0159373615f, 0.0173407079f, 0.0187345416f, 0.0201043025f, 0.0214355481f, 0.0227141277f, 0.0239263538f, 0.0250591689f,
+    0.0261003048f, 0.0270384334f, 0.0278633056f, 0.0285658782f, 0.029138425f, 0.0295746332f, 0.0298696813f, 0.0300202994f,
+    0.0300248097f, 0.0298831481f, 0.0295968649f, 0.029169106f, 0.0286045746f, 0.0279094728f, 0.0270914257f, 0.0261593872f,
+    0.02512353f, 0.0239951206f, 0.0227863811f, 0.0215103399f, 0.0201806727f, 0.0188115363f, 0.0174173971f, 0.0160128565f,
+    0.0146124766f, 0.0132306058f, 0.0118812097f, 0.0105777067f, 0.00933281309f, 0.00815839637f, 0.00706534178f, 0.00606343153f,
+    0.00516123911f, 0.00436603976f, 0.00368373805f, 0.00311881344f, 0.00267428431f, 0.00235169086f, 0.00215109671f, 0.00207110928f
+  },
+  { // 229.2 Hz
+    0.00199794122f, 0.0020799982f, 0.00227913094f, 0.00259744485f, 0.00303558572f, 0.00359270625f, 0.00426645204f, 0.0050529675f,
+    0.0059469216f, 0.00694155356f, 0.00802873787f, 0.00919906817f, 0.0104419587f, 0.0117457625f, 0.0130979046f, 0.0144850287f,
+    0.0158931552f, 0.017307849f, 0.0187143946f, 0.0200979761f, 0.0214438594f, 0.0227375758f, 0.023965102f, 0.0251130361f,
+    0.0261687667f, 0.0271206318f, 0.0279580675f, 0.0286717419f, 0.0292536741f, 0.0296973369f, 0.0299977398f, 0.0301514934f,
+    0.0301568534f, 0.0300137428f, 0.0297237538f, 0.0292901273f, 0.0287177123f, 0.0280129039f, 0.0271835625f, 0.0262389133f,
+    0.0251894298f, 0.0240467005f, 0.0228232831f, 0.0215325453f, 0.0201884975f, 0.0188056167f, 0.0173986665f, 0.0159825138f,
+    0.0145719452f, 0.0131814866f, 0.0118252264f, 0.0105166464f, 0.00926846155f, 0.00809247141f, 0.00699942422f, 0.00599889638f,
+    0.00509918819f, 0.00430723714f, 0.00362855002f, 0.00306715436f, 0.00262556975f, 0.00230479922f, 0.00210434057f, 0.00202221731f
+  },
+  { // 249.3 Hz
+    0.001936658f, 0.00202110125f, 0.0022197501f, 0.00253540323f, 0.00296938552f, 0.00352150139f, 0.0041900085f, 0.00497161259f,
+    0.00586148367f, 0.00685329365f, 0.00793927512f, 0.00911030057f, 0.0103559813f, 0.0116647847f, 0.0130241685f, 0.0144207301f,
+    0.0158403694f, 0.0172684622f, 0.0186900427f, 0.0200899922f, 0.021453231f, 0.0227649121f, 0.0240106118f, 0.0251765175f,
+    0.0262496071f, 0.0272178197f, 0.0280702138f, 0.0287971115f, 0.0293902267f, 0.0298427743f, 0.030149561f, 0.0303070541f,
+    0.0303134287f, 0.0301685928f, 0.0298741883f, 0.0294335704f, 0.028851763f, 0.0281353928f, 0.0272926021f, 0.0263329416f,
+    0.0252672449f, 0.0241074864f, 0.0228666246f, 0.0215584329f, 0.0201973205f, 0.0187981462f, 0.0173760267f, 0.015946143f,
+    0.0145235476f, 0.0131229744f, 0.0117586549f, 0.0104441423f, 0.00919214654f, 0.00801438206f, 0.00692143092f, 0.0059226221f,
+    0.00502592943f, 0.0042378888f, 0.00356353599f, 0.00300636556f, 0.0025683112f, 0.00224974762f, 0.00204951375f, 0.00196495647f
+  },
+  { // 271.2 Hz
+    0.00186513636f, 0.00195226059f, 0.00215024186f, 0.00246267658f, 0.00289167602f, 0.00343780355f, 0.00410003332f, 0.0048757315f,
+    0.0057606605f, 0.00674900642f, 0.00783342973f, 0.00900513851f, 0.0102539836f, 0.0115685741f, 0.012936413f, 0.0143440483f,
+    0.0157772418f, 0.0172211486f, 0.0186605088f, 0.0200798457f, 0.0214636693f, 0.022796682f, 0.0240639829f, 0.0252512679f,
+    0.0263450236f, 0.0273327105f, 0.028202934f, 0.0289456007f, 0.0295520568f, 0.0300152076f, 0.0303296152f, 0.030491574f,
+    0.0304991625f, 0.0303522697f, 0.030052598f, 0.0296036393f, 0.0290106282f, 0.0282804698f, 0.0274216456f, 0.0264440971f,
+    0.0253590905f, 0.0241790628f, 0.0229174528f, 0.0215885191f, 0.0202071477f, 0.0187886522f, 0.0173485692f, 0.0159024524f,
+    0.0144656677f, 0.0130531933f, 0.0116794263f, 0.0103579996f, 0.0091016116f, 0.00792187042f, 0.0068291553f, 0.00583249699f,
+    0.0049394786f, 0.0041561581f, 0.00348701353f, 0.00293491129f, 0.0025010979f, 0.00218521485f, 0.00198533622f, 0.00189802816f
+  },
+  { // 295.0 Hz
+    0.0017818924f, 0.00187199187f, 0.00206905222f, 0.00237758252f, 0.00280060062f, 0.00333955085f, 0.00399424433f, 0.00476282329f,
+    0.00564175034f, 0.00662582302f, 0.00770821394f, 0.00888053604f, 0.0101329324f, 0.0114541895f, 0.0128318719f, 0.0142524778f,
+    0.0157016116f, 0.0171641723f, 0.0186245541f, 0.0200668572f, 0.0214751045f, 0.0228334618f, 0.0241264575f, 0.0253391995f,
+    0.0264575846f, 0.0274684981f, 0.0283600004f, 0.0291214973f, 0.029743892f, 0.0302197156f, 0.030543235f, 0.0307105358f,
+    0.030719579f, 0.0305702312f, 0.0302642667f, 0.0298053431f, 0.0291989487f, 0.0284523246f, 0.0275743609f, 0.0265754701f,
+    0.025467439f, 0.0242632607f, 0.0229769508f, 0.0216233496f, 0.0202179135f, 0.0187764989f, 0.0173151423f, 0.015849839f,
+    0.0143963248f, 0.0129698635f, 0.0115850431f, 0.0102555845f, 0.00899416454f, 0.00781225693f, 0.00671999262f, 0.00572604179f,
+    0.00483751908f, 0.00405991318f, 0.00339704166f, 0.0028510313f, 0.00242232404f, 0.00210970806f, 0.00191037315f, 0.00181998924f
+  },
+  { // 320.9 Hz
+    0.00168532445f, 0.00177867285f, 0.00197446357f, 0.00227824227f, 0.00269406629f, 0.00322439851f, 0.0038700251f, 0.00462999896f,
+    0.00550160996f, 0.00648038321f, 0.00756010537f, 0.00873287934f, 0.00998920656f, 0.011318096f, 0.0127071982f, 0.0141429631f,
+    0.0156108184f, 0.0170953663f, 0.0185805959f, 0.0200501076f, 0.0214873453f, 0.0228758348f, 0.0241994218f, 0.0254425085f,
+    0.0265902824f, 0.027628936f, 0.0285458717f, 0.0293298904f, 0.0299713589f, 0.0304623556f, 0.0307967894f, 0.0309704923f,
+    0.0309812829f, 0.030829f, 0.0305155052f, 0.030044656f, 0.0294222482f, 0.0286559291f, 0.0277550831f, 0.026730692f,
+    0.0255951708f, 0.024362183f, 0.0230464388f, 0.021663477f, 0.0202294377f, 0.0187608263f, 0.0172742747f, 0.0157863018f,
+    0.0143130793f, 0.0128702043f, 0.0114724835f, 0.0101337323f, 0.008866591f, 0.00768236251f, 0.00659087212f, 0.00560035258f,
+    0.00471735571f, 0.00394669142f, 0.00329139518f, 0.00275272379f, 0.00233017928f, 0.00202156015f, 0.00182303865f, 0.00172926256f
+  },
+  { // 349.0 Hz
+    0.00157375138f, 0.00167057109f, 0.00186461323f, 0.00216259033f, 0.00256974347f, 0.0030897074f, 0.00372440057f, 0.00447394235f,
+    0.00533659962f, 0.00630876374f, 0.00738495915f, 0.00855788363f, 0.00981848011f, 0.0111560392f, 0.0125583308f, 0.0140117638f,
+    0.0155015698f, 0.0170120096f, 0.0185265986f, 0.0200283468f, 0.0215000104f, 0.0229243508f, 0.0242843954f, 0.0255636973f,
+    0.0267465891f, 0.0278184258f, 0.0287658133f, 0.0295768186f, 0.0302411576f, 0.0307503578f, 0.0310978926f, 0.0312792851f,
+    0.0312921802f, 0.0311363821f, 0.0308138583f, 0.0303287092f, 0.0296871039f, 0.0288971832f, 0.0279689318f, 0.0269140213f,
+    0.0257456278f, 0.024478226f, 0.0231273637f, 0.0217094218f, 0.0202413613f, 0.0187404648f, 0.0172240736f, 0.0157093281f,
+    0.0142129126f, 0.0127508119f, 0.0113380811f, 0.00998863365f, 0.00871505127f, 0.00752841781f, 0.00643818029f, 0.0054520389f,
+    0.00457586758f, 0.00381366606f, 0.00316754381f, 0.0026377357f, 0.00222264872f, 0.00191893834f, 0.00172161292f, 0.00162416379f
+  },
+  { // 379.6 Hz
+    0.00144548008f, 0.0015458969f, 0.00173753483f, 0.0020284047f, 0.00242508425f, 0.00293254833f, 0.00355402476f, 0.00429087912f,
+    0.00514253103f, 0.00610640415f, 0.00717791115f, 0.00835047475f, 0.00961558482f, 0.010962891f, 0.0123803297f, 0.0138542836f,
+    0.0153697714f, 0.0169106641f, 0.0184599245f, 0.0199998666f, 0.0215124293f, 0.0229794597f, 0.0243830021f, 0.0257055861f,
+    0.0269305101f, 0.0280421134f, 0.0290260338f, 0.0298694449f, 0.0305612685f, 0.0310923594f, 0.0314556584f, 0.0316463106f,
+    0.0316617476f, 0.0315017308f, 0.0311683564f, 0.0306660212f, 0.0300013499f, 0.0291830854f, 0.0282219436f, 0.0271304366f,
+    0.0259226658f, 0.02461409f, 0.0232212723f, 0.0217616101f, 0.0202530532f, 0.018713816f, 0.0171620871f, 0.015615743f,
+    0.0140920707f, 0.0126075037f, 0.0111773757f, 0.00981569714f, 0.00853495793f, 0.00734595907f, 0.0062576766f, 0.00527715957f,
+    0.00440946346f, 0.00365761978f, 0.00302264188f, 0.00250356633f, 0.00209752859f, 0.00179987096f, 0.00160428038f, 0.00150295296f
+  },
+  { // 413.0 Hz
+    0.00129891556f, 0.00140289406f, 0.00159123376f, 0.00187336878f, 0.00225736985f, 0.0027497325f, 0.00335519102f, 0.00407656277f,
+    0.00491462615f, 0.00586803562f, 0.00693327579f, 0.00810465638f, 0.00937434872f, 0.0107324637f, 0.0121671702f, 0.013664853f,
+    0.0152103056f, 0.0167869582f, 0.0183771326f, 0.0199623232f, 0.0215234969f, 0.0230414063f, 0.024496912f, 0.0258713059f,
+    0.0271466309f, 0.02830599f, 0.0293338392f, 0.0302162588f, 0.0309411975f, 0.0314986845f, 0.0318810058f, 0.0320828412f,
+    0.0321013589f, 0.031936267f, 0.0315898189f, 0.0310667748f, 0.0303743182f, 0.02952193f, 0.028521222f, 0.0273857343f,
+    0.0261306986f, 0.0247727731f, 0.023329755f, 0.0218202736f, 0.0202634729f, 0.0186786868f, 0.0170851159f, 0.0155015098f,
+    0.0139458614f, 0.0124351204f, 0.0109849282f, 0.00960938252f, 0.00832083263f, 0.00712971128f, 0.00604440439f, 0.00507116129f,
+    0.00421404641f, 0.00347493281f, 0.00285353693f, 0.00234749335f, 0.00195246735f, 0.00166230243f, 0.00146919938f, 0.00136392264f
+  },
+  { // 449.2 Hz
+    0.00113273098f, 0.00123998447f, 0.00142381331f, 0.00169518134f, 0.00206380367f, 0.00253788449f, 0.00312388007f, 0.00382629252f,
+    0.00464749942f, 0.00558762348f, 0.00664444604f, 0.00781336676f, 0.00908741129f, 0.0104572876f, 0.0119114908f, 0.0134364539f,
+    0.0150167444f, 0.0166353004f, 0.0182737044f, 0.0199124879f, 0.021531462f, 0.0231100674f, 0.0246277359f, 0.0260642575f,
+    0.0274001454f, 0.0286169903f, 0.0296977987f, 0.0306273065f, 0.0313922629f, 0.0319816776f, 0.0323870268f, 0.0326024136f,
+    0.0326246798f, 0.0324534657f, 0.0320912181f, 0.0315431451f, 0.0308171196f, 0.0299235324f, 0.028875099f, 0.0276866237f,
+    0.0263747255f, 0.0249575317f, 0.0234543457f, 0.0218852959f, 0.0202709717f, 0.018632056f, 0.0169889593f, 0.0153614651f,
+    0.0137683911f, 0.0122272755f, 0.0107540922f, 0.00936300184f, 0.00806614205f, 0.00687346218f, 0.00579260368f, 0.00482882888f,
+    0.00398499858f, 0.00326159811f, 0.00265681062f, 0.00216663511f, 0.00178504611f, 0.00150419079f, 0.00131461868f, 0.00120553857f
+  },
+  { // 488.6 Hz
+    0.000946120449f, 0.0010559892f, 0.00123367342f, 0.00149173727f, 0.00184167345f, 0.0022935817f, 0.00285587001f, 0.00353498593f,
+    0.00433518488f, 0.00525834163f, 0.00630380993f, 0.00746833468f, 0.00874601947f, 0.0101283514f, 0.0116042833f, 0.0131603733f,
+    0.0147809781f, 0.0164484986f, 0.0181436711f, 0.0198458995f, 0.021533622f, 0.0231847037f, 0.0247768476f, 0.026288015f,
+    0.0276968466f, 0.0289830745f, 0.0301279168f, 0.0311144464f, 0.0319279248f, 0.0325560942f, 0.0329894227f, 0.033221294f,
+    0.0332481412f, 0.0330695187f, 0.032688112f, 0.0321096853f, 0.0313429675f, 0.0303994784f, 0.0292933018f, 0.0280408061f,
+    0.026660323f, 0.0251717882f, 0.023596353f, 0.0219559767f, 0.0202730053f, 0.0185697494f, 0.0168680681f, 0.0151889675f,
+    0.0135522242f, 0.01197604f, 0.0104767351f, 0.00906848657f, 0.00776311682f, 0.00656993554f, 0.00549563837f, 0.00454426323f,
+    0.00371720447f, 0.00301328331f, 0.0024288723f, 0.00195806967f, 0.00159291897f, 0.0013236681f, 0.00113906094f, 0.00102665456f
+  },
+  { // 531.5 Hz
+    0.000739162339f, 0.000850454142f, 0.00101981196f, 0.00126141055f, 0.00158861594f, 0.00201359526f, 0.00254694429f, 0.00319734211f,
+    0.00397124249f, 0.00487261023f, 0.00590271017f, 0.00705995506f, 0.00833981731f, 0.00973480806f, 0.0112345253f, 0.0128257716f,
+    0.0144927387f, 0.0162172577f, 0.0179791081f, 0.0197563799f, 0.0215258819f, 0.0232635855f, 0.0249450958f, 0.0265461387f,
+    0.0280430518f, 0.0294132698f, 0.0306357915f, 0.0316916184f, 0.0325641533f, 0.0332395521f, 0.033707017f, 0.0339590276f,
+    0.0339915012f, 0.0338038818f, 0.0333991521f, 0.0327837716f, 0.0319675395f, 0.0309633877f, 0.0297871072f, 0.0284570154f,
+    0.0269935718f, 0.0254189515f, 0.0237565851f, 0.0220306779f, 0.0202657183f, 0.0184859863f, 0.0167150748f, 0.0149754337f,
+    0.0132879464f, 0.0116715499f, 0.0101429052f, 0.00871612495f, 0.00740256482f, 0.00621068172f, 0.00514596107f, 0.00421091383f,
+    0.00340514205f, 0.00272546987f, 0.00216613586f, 0.00171904049f, 0.00137404189f, 0.00111929154f, 0.00094160087f, 0.000826829119f
+  },
+  { // 578.1 Hz
+    0.000513324782f, 0.000624114592f, 0.000782265959f, 0.00100348121f, 0.00130302999f, 0.00169528245f, 0.0021932506f, 0.00280815052f,
+    0.00354899781f, 0.00442224806f, 0.00543149313f, 0.0065772225f, 0.00785665771f, 0.00926366574f, 0.0107887554f, 0.0124191584f,
+    0.014138995f, 0.0159295213f, 0.0177694533f, 0.0196353609f, 0.0215021233f, 0.0233434344f, 0.0251323472f, 0.0268418428f,
+    0.0284454119f, 0.029917632f, 0.0312347285f, 0.0323751035f, 0.0333198207f, 0.0340530322f, 0.0345623391f, 0.0348390731f,
+    0.0348784956f, 0.0346799067f, 0.0342466621f, 0.0335860973f, 0.0327093622f, 0.0316311673f, 0.0303694522f, 0.0289449803f,
+    0.0273808741f, 0.0257020996f, 0.0239349148f, 0.022106295f, 0.0202433505f, 0.0183727491f, 0.0165201599f, 0.0147097305f,
+    0.0129636097f, 0.0113015288f, 0.00974044919f, 0.00829428455f, 0.00697370408f, 0.0057860192f, 0.00473515578f, 0.00382171047f,
+    0.00304308833f, 0.00239371621f, 0.00186532497f, 0.00144729143f, 0.00112702998f, 0.00089042226f, 0.000722272673f, 0.000606777124f
+  },
+  { // 628.8 Hz
+    0.000272142689f, 0.000379535486f, 0.000522737216f, 0.000718758449f, 0.000984698949f, 0.00133719971f, 0.00179188729f, 0.0023628267f,
+    0.00306199952f, 0.00389882301f, 0.0048797256f, 0.00600779251f, 0.00728249345f, 0.00869950228f, 0.010250616f, 0.0119237779f,
+    0.0137032054f, 0.0155696237f, 0.0175005977f, 0.0194709576f, 0.0214533069f, 0.0234186004f, 0.0253367782f, 0.0271774382f,
+    0.028910531f, 0.0305070576f, 0.0319397517f, 0.0331837279f, 0.034217079f, 0.0350214051f, 0.035582261f, 0.0358895086f,
+    0.0359375657f, 0.0357255432f, 0.0352572685f, 0.0345411919f, 0.0335901817f, 0.0324212106f, 0.0310549445f, 0.0295152431f,
+    0.0278285866f, 0.0260234451f, 0.0241296057f, 0.0221774775f, 0.0201973919f, 0.0182189174f, 0.0162702064f, 0.0143773917f,
+    0.0125640476f, 0.0108507288f, 0.00925459901f, 0.00778915706f, 0.00646406603f, 0.00528508847f, 0.00425412687f, 0.0033693661f,
+    0.00262551163f, 0.00201411446f, 0.00152397181f, 0.00114159011f, 0.000851695853f, 0.00063777828f, 0.000482647624f, 0.000368992255f
+  },
+  { // 684.0 Hz
+    2.20807008e-05f, 0.000121956781f, 0.000245446092f, 0.000410458955f, 0.000635696876f, 0.000940026847f, 0.00134182261f, 0.00185829343f,
+    0.00250482175f, 0.00329433159f, 0.00423670851f, 0.00533829138f, 0.00660145391f, 0.00802429151f, 0.00960042609f, 0.011318938f,
+    0.0131644299f, 0.015117225f, 0.0171536948f, 0.0192467114f, 0.021366212f, 0.0234798616f, 0.0255537965f, 0.0275534265f,
+    0.029444276f, 0.0311928372f, 0.0327674128f, 0.034138923f, 0.0352816529f, 0.0361739194f, 0.0367986364f, 0.0371437629f,
+    0.0372026199f, 0.0369740673f, 0.036462534f, 0.0356779029f, 0.0346352514f, 0.0333544566f, 0.0318596775f, 0.0301787273f,
+    0.0283423568f, 0.0263834684f, 0.0243362841f, 0.022235492f, 0.0201153957f, 0.0180090909f, 0.0159476928f, 0.0139596351f,
+    0.0120700609f, 0.0103003199f, 0.00866758577f, 0.00718460261f, 0.00585956366f, 0.00469612461f, 0.00369354693f, 0.00284696411f,
+    0.00214775952f, 0.00158404155f, 0.00114119892f, 0.00080251689f, 0.000549833422f, 0.000364213884f, 0.00022662242f, 0.000118568907f
+  },
+  { // 744.0 Hz
+    -0.000226446337f, -0.000139655836f, -4.17603255e-05f, 8.53925369e-05f, 0.000261658159f, 0.000507910027f, 0.00084528289f, 0.00129436903f,
+    0.00187439486f, 0.00260240645f, 0.00349249304f, 0.00455507692f, 0.00579629642f, 0.00721750609f, 0.00881491478f, 0.0105793777f,
+    0.0124963542f, 0.0145460364f, 0.0167036502f, 0.0189399213f, 0.0212216967f, 0.0235127043f, 0.0257744278f, 0.0279670743f,
+    0.0300506017f, 0.031985778f, 0.0337352362f, 0.0352644954f, 0.0365429122f, 0.0375445351f, 0.0382488323f, 0.0386412717f,
+    0.0387137321f, 0.0384647346f, 0.0378994845f, 0.0370297247f, 0.0358734029f, 0.0344541649f, 0.0328006899f, 0.0309458888f,
+    0.0289259915f, 0.0267795521f, 0.0245464035f, 0.0222665941f, 0.0199793406f, 0.0177220283f, 0.0155292888f, 0.0134321849f,
+    0.0114575228f, 0.00962731441f, 0.00795839988f, 0.00646224194f, 0.00514489207f, 0.00400712649f, 0.00304474261f, 0.00224900183f,
+    0.00160719996f, 0.00110334261f, 0.000718899736f, 0.000433611419f, 0.000226316042f, 7.57716384e-05f, -3.85576563e-05f, -0.000135776294f
+  },
+  { // 809.3 Hz
+    -0.000458018536f, -0.000391429168f, -0.000326076995f, -0.0002445339f, -0.000126533707f, 5.03276651e-05f, 0.000309763359f, 0.000675866404f,
+    0.00117211338f, 0.00182033763f, 0.002639711f, 0.00364577374f, 0.00484955142f, 0.00625679555f, 0.00786738045f, 0.00967488425f,
+    0.0116663752f, 0.0138224177f, 0.0161173039f, 0.0185195098f, 0.0209923642f, 0.0234949144f, 0.0259829602f, 0.0284102267f,
+    0.0307296357f, 0.0328946356f, 0.0348605445f, 0.0365858602f, 0.0380334942f, 0.0391718851f, 0.039975954f, 0.0404278683f,
+    0.0405175871f, 0.0402431689f, 0.0396108314f, 0.0386347606f, 0.0373366757f, 0.0357451665f, 0.0338948244f, 0.0318251986f,
+    0.0295796133f, 0.0272038877f, 0.0247450003f, 0.022249747f, 0.0197634337f, 0.0173286505f, 0.014984166f, 0.0127639767f,
+    0.0106965406f, 0.00880421844f, 0.0071029342f, 0.00560206339f, 0.00430454498f, 0.00320720743f, 0.00230129037f, 0.0015731373f,
+    0.00100502867f, 0.000576120245f, 0.00026344884f, 4.29655827e-05f, -0.000109442824f, -0.000216983063f, -0.000301069604f, -0.000380555539f
+  },
+  { // 880.3 Hz
+    -0.000651428511f, -0.000613500423f, -0.00058835238f, -0.00056059635f, -0.000510672569f, -0.000415479937f, -0.000249214423f, 1.56132221e-05f,
+    0.000407017917f, 0.000952283755f, 0.001676661f, 0.0026020706f, 0.00374587152f, 0.00511974524f, 0.00672874833f, 0.00857057834f,
+    0.0106350909f, 0.0129040964f, 0.0153514533f, 0.0179434647f, 0.0206395721f, 0.0233933269f, 0.026153611f, 0.0288660662f,
+    0.0314746822f, 0.0339234883f, 0.036158286f, 0.0381283609f, 0.0397881075f, 0.0410985096f, 0.0420284165f, 0.0425555701f,
+    0.0426673416f, 0.0423611501f, 0.0416445476f, 0.0405349672f, 0.0390591424f, 0.0372522226f, 0.0351566154f, 0.0328206022f,
+    0.0302967774f, 0.0276403716f, 0.0249075205f, 0.0221535434f, 0.0194312946f, 0.0167896468f, 0.014272159f, 0.0119159751f,
+    0.0097509878f, 0.00779929164f, 0.00607493904f, 0.00458399786f, 0.00332489978f, 0.00228905597f, 0.00146170691f, 0.000822964417f,
+    0.000348997531f, 1.33089814e-05f, -0.000211952927f, -0.000354702281f, -0.000441696124f, -0.000497435788f, -0.000543230652f, -0.00059645781f
+  },
+  { // 957.5 Hz
+    -0.000779793253f, -0.000779554518f, -0.000802077128f, -0.000835669884f, -0.00086303237f, -0.000861671189f, -0.000804627512f, -0.000661494302f,
+    -0.000399686623f, 1.4085177e-05f, 0.000612201175f, 0.00142444716f, 0.00247633592f, 0.00378751332f, 0.00537032654f, 0.00722862674f,
+    0.00935687019f, 0.0117395698f, 0.0143511349f, 0.0171561209f, 0.0201098923f, 0.0231596844f, 0.0262460315f, 0.0293045127f,
+    0.0322677507f, 0.0350675882f, 0.0376373558f, 0.0399141423f, 0.0418409752f, 0.0433688219f, 0.0444583301f, 0.0450812355f,
+    0.0452213765f, 0.0448752766f, 0.0440522675f, 0.0427741489f, 0.0410743991f, 0.0389969692f, 0.0365947114f, 0.0339275063f,
+    0.0310601662f, 0.028060201f, 0.0249955375f, 0.0219322833f, 0.0189326233f, 0.0160529316f, 0.0133421687f, 0.0108406212f,
+    0.0085790265f, 0.00657810545f, 0.00484851041f, 0.00339117517f, 0.00219803821f, 0.00125309408f, 0.000533714738f, 1.21724217e-05f,
+    -0.000342711312f, -0.000563869216f, -0.00068432298f, -0.000735623333f, -0.000746462755f, -0.000741517686f, -0.000740564491f, -0.000757899037f
+  },
+  { // 1041.5 Hz
+    -0.000812644683f, -0.000857962614f, -0.000933650609f, -0.00103360315f, -0.00114477412f, -0.00124715725f, -0.00131419854f, -0.00131364081f,
+    -0.00120877689f, -0.00096006459f, -0.000527035463f, 0.000129589557f, 0.00104567843f, 0.00225147077f, 0.00376947958f, 0.00561262444f,
+    0.00778270084f, 0.0102692773f, 0.0130490929f, 0.0160860059f, 0.0193315181f, 0.0227258721f, 0.0261996913f, 0.0296761047f,
+    0.0330732741f, 0.0363072217f, 0.0392948372f, 0.041956936f, 0.0442212328f, 0.0460250996f, 0.0473179824f, 0.0480633694f,
+    0.0482402195f, 0.0478437863f, 0.046885801f, 0.0453940038f, 0.0434110476f, 0.0409928222f, 0.0382062767f, 0.0351268381f,
+    0.0318355438f, 0.0284160147f, 0.0249514053f, 0.0215214619f, 0.0181998164f, 0.0150516282f, 0.0121316677f, 0.00948291529f,
+    0.00713571904f, 0.00510753103f, 0.00340321224f, 0.00201586928f, 0.000928162098f, 0.000114000654f, -0.000459467583f, -0.000829688621f,
+    -0.00103646579f, -0.00111977021f, -0.00111770508f, -0.00106471933f, -0.000990149701f, -0.000917150458f, -0.000862047381f, -0.000834129011f
+  },
+  { // 1132.9 Hz
+    -0.000721585391f, -0.000816091675f, -0.000945493961f, -0.00111111753f, -0.00130649482f, -0.00151660675f, -0.00171766927f, -0.00187751366f,
+    -0.00195657389f, -0.00190945788f, -0.00168704304f, -0.00123900179f, -0.000516633439f, 0.000524145264f, 0.00191981395f, 0.00369643675f,
+    0.00586719161f, 0.00843039539f, 0.0113681574f, 0.0146457642f, 0.0182118624f, 0.0219994647f, 0.025927761f, 0.0299046734f,
+    0.0338300523f, 0.0375993744f, 0.0411077748f, 0.0442542243f, 0.0469456508f, 0.0491008056f, 0.0506536839f, 0.0515563299f,
+    0.0517808869f, 0.0513207889f, 0.0501910357f, 0.0484275358f, 0.046085551f, 0.0432373219f, 0.0399689916f, 0.0363769816f,
+    0.0325640003f, 0.028634878f, 0.0246924311f, 0.0208335521f, 0.0171457074f, 0.0137039982f, 0.0105689114f, 0.00778484434f,
+    0.00537944754f, 0.00336378563f, 0.00173327225f, 0.000469296938f, -0.000458572698f, -0.00108995676f, -0.00147075793f, -0.0016501551f,
+    -0.00167766436f, -0.00160042521f, -0.00146085056f, -0.00129475295f, -0.00113002682f, -0.00098593154f, -0.000872982447f, -0.000793421218f
+  },
+  { // 1232.3 Hz
+    -0.000491209338f, -0.000629748804f, -0.000804221824f, -0.00102467884f, -0.00129356539f, -0.00160387236f, -0.00193788122f, -0.00226664066f,
+    -0.00255026718f, -0.00273910899f, -0.00277575561f, -0.00259781702f, -0.00214134027f, -0.0013446828f, -0.000152622315f, 0.00147954298f,
+    0.0035821613f, 0.00616791393f, 0.00922925315f, 0.0127367866f, 0.0166387533f, 0.0208616772f, 0.0253122146f, 0.0298801451f,
+    0.034442384f, 0.0388678319f, 0.0430228258f, 0.0467769131f, 0.0500086469f, 0.0526110955f, 0.0544967675f, 0.0556016852f,
+    0.0558883823f, 0.0553476624f, 0.0539990183f, 0.0518896926f, 0.0490924294f, 0.0457020427f, 0.0418309911f, 0.0376042003f,
+    0.0331534162f, 0.0286113913f, 0.0241062124f, 0.0197560643f, 0.0156646909f, 0.0119177735f, 0.00858038431f, 0.00569561066f,
+    0.00328437353f, 0.00134639539f, -0.000137792531f, -0.00120397066f, -0.00190069033f, -0.00228531408f, -0.00241989356f, -0.00236714028f,
+    -0.00218672671f, -0.00193212381f, -0.00164813734f, -0.00136925308f, -0.00111884376f, -0.000909231623f, -0.000742544706f, -0.000612254822f
+  },
+  { // 1340.4 Hz
+    -0.000135707243f, -0.000299045061f, -0.000495933552f, -0.0007451464f, -0.00105977295f, -0.00144398975f, -0.00189030748f, -0.00237757064f,
+    -0.00286994319f, -0.00331704922f, -0.00365535718f, -0.00381080563f, -0.00370257393f, -0.00324780928f, -0.00236703996f, -0.000989938928f,
+    0.000938942071f, 0.00345486602f, 0.00656842101f, 0.0102621995f, 0.0144889355f, 0.0191713037f, 0.0242034824f, 0.029454469f,
+    0.0347730246f, 0.0399940101f, 0.0449457863f, 0.0494582671f, 0.0533711682f, 0.0565419702f, 0.0588531244f, 0.0602180679f,
+    0.0605856868f, 0.0599429546f, 0.0583155861f, 0.0557666672f, 0.0523933453f, 0.0483217829f, 0.0437006811f, 0.0386937654f,
+    0.0334716829f, 0.02820379f, 0.0230503058f, 0.0181552761f, 0.0136407273f, 0.00960230969f, 0.00610662376f, 0.00319031231f,
+    0.000860887107f, -0.000900851973f, -0.00213704285f, -0.00290794758f, -0.00328646809f, -0.0033523869f, -0.00318672697f, -0.00286659671f,
+    -0.00246083291f, -0.00202668245f, -0.00160767663f, -0.00123275858f, -0.00091662962f, -0.000661193187f, -0.000457899578f, -0.000290737797f
+  },
+  { // 1458.0 Hz
+    0.000282615963f, 0.000131337515f, -4.81695232e-05f, -0.000281264319f, -0.000591873997f, -0.000997898307f, -0.00150664585f, -0.00211076405f,
+    -0.00278511095f, -0.00348496233f, -0.00414585539f, -0.00468524764f, -0.00500602403f, -0.00500173081f, -0.00456326079f, -0.00358657692f,
+    -0.00198094968f, 0.000322889816f, 0.00336530931f, 0.00715165601f, 0.011648f, 0.0167791689f, 0.0224293538f, 0.0284453883f,
+    0.0346426129f, 0.0408130487f, 0.0467354276f, 0.0521864822f, 0.056952793f, 0.0608424352f, 0.0636956644f, 0.0653939346f,
+    0.0658666469f, 0.0650951748f, 0.0631138966f, 0.0600081643f, 0.0559093505f, 0.0509873072f, 0.045440745f, 0.0394861762f,
+    0.0333461518f, 0.0272375563f, 0.0213607058f, 0.015889918f, 0.0109661052f, 0.00669178337f, 0.00312870898f, 0.000298164777f,
+    -0.00181627184f, -0.00326381234f, -0.00411986447f, -0.00447833285f, -0.00444343275f, -0.0041216384f, -0.00361434152f, -0.00301170735f,
+    -0.00238809351f, -0.00179925188f, -0.00128137848f, -0.000851922738f, -0.000511929691f, -0.000249575186f, -4.44753219e-05f, 0.00012768905f
+  },
+  { // 1586.0 Hz
+    0.000644510213f, 0.000556714906f, 0.000448577646f, 0.00029296653f, 5.75632454e-05f, -0.000289852118f, -0.000775217795f, -0.00141173818f,
+    -0.00219387091f, -0.00309247248f, -0.00405176114f, -0.00498862618f, -0.00579462322f, -0.00634076134f, -0.0064849294f, -0.00608155003f,
+    -0.00499281354f, -0.00310065402f, -0.000318505392f, 0.00339816986f, 0.00804354496f, 0.0135561235f, 0.0198170964f, 0.0266527223f,
+    0.033840786f, 0.0411208586f, 0.0482077743f, 0.0548074601f, 0.060634045f, 0.0654270459f, 0.0689673923f, 0.0710911187f,
+    0.0716997098f, 0.0707663307f, 0.0683374749f, 0.0645299108f, 0.0595231577f, 0.0535480586f, 0.0468723042f, 0.0397839789f,
+    0.0325743323f, 0.0255210095f, 0.0188729095f, 0.0128376854f, 0.00757266144f, 0.00317965749f, -0.000296112657f, -0.00286322382f,
+    -0.00457775718f, -0.0055342569f, -0.00585481115f, -0.00567724271f, -0.00514340691f, -0.00438852219f, -0.0035323105f, -0.0026725173f,
+    -0.0018811347f, -0.00120339011f, -0.00065931048f, -0.000247451678f, 4.9788189e-05f, 0.000259958947f, 0.000414175475f, 0.000541249755f
+  },
+  { // 1725.1 Hz
+    0.000794288187f, 0.000820289205f, 0.000837061925f, 0.000822812591f, 0.00074277262f, 0.0005534543f, 0.000209249785f, -0.000329243913f,
+    -0.00108606301f, -0.0020609532f, -0.0032218339f, -0.00449974911f, -0.00578722514f, -0.00694066255f, -0.00778700762f, -0.00813451358f,
+    -0.00778695733f, -0.00656026955f, -0.00430020896f, -0.000899502936f, 0.00368718651f, 0.00943201773f, 0.0162277413f, 0.0238873976f,
+    0.0321503574f, 0.0406945714f, 0.0491543357f, 0.0571423626f, 0.0642745279f, 0.0701953813f, 0.0746023902f, 0.0772669496f,
+    0.0780504315f, 0.0769139465f, 0.0739210052f, 0.0692328628f, 0.0630969426f, 0.0558293083f, 0.0477926436f, 0.0393715507f,
+    0.0309471661f, 0.0228731044f, 0.0154545695f, 0.00893214612f, 0.00347133201f, -0.000841662236f, -0.00399787988f, -0.00605792195f,
+    -0.00713962168f, -0.00740246938f, -0.00703037092f, -0.00621436824f, -0.00513684025f, -0.00395845431f, -0.00280878297f, -0.00178107747f,
+    -0.000931244774f, -0.000280653222f, 0.000177963635f, 0.000472493339f, 0.000642446466f, 0.000730108982f, 0.000772866245f, 0.000797502143f
+  },
+  { // 1876.5 Hz
+    0.000607054853f, 0.000765433287f, 0.000931075767f, 0.00109512717f, 0.00122974235f, 0.00128851964f, 0.00121086536f, 0.000930152571f,
+    0.000384968829f, -0.000467770459f, -0.00163946261f, -0.00309804793f, -0.00475966186f, -0.00648530436f, -0.00808366611f, -0.00932061834f,
+    -0.00993512895f, -0.0096605941f, -0.0082498615f, -0.0055016555f, -0.00128576872f, 0.00443568917f, 0.0115934759f, 0.0200048221f,
+    0.0293767056f, 0.0393191306f, 0.0493677641f, 0.059014325f, 0.0677422921f, 0.0750648972f, 0.0805620543f, 0.0839128951f,
+    0.0849209326f, 0.0835295293f, 0.0798262364f, 0.074035608f, 0.0665011733f, 0.0576582555f, 0.0480001595f, 0.0380408269f,
+    0.0282773152f, 0.0191553886f, 0.0110411039f, 0.00420060955f, -0.00121049752f, -0.00514788277f, -0.00766984945f, -0.00892084153f,
+    -0.00910921418f, -0.00848183376f, -0.00729820413f, -0.00580666026f, -0.00422475746f, -0.00272536999f, -0.00142927749f, -0.000404247621f,
+    0.00033009154f, 0.000792878184f, 0.00102982185f, 0.00110003111f, 0.00106364129f, 0.000971742765f, 0.000859670008f, 0.000744170084f
+  },
+  { // 2041.1 Hz
+    9.4268411e-05f, 0.000336097688f, 0.000608692811f, 0.000921150756f, 0.00126368929f, 0.00160128861f, 0.00187190938f, 0.00199042126f,
+    0.00185853316f, 0.00138005055f, 0.00047983114f, -0.000875986596f, -0.00266142032f, -0.00477681527f, -0.00704252212f, -0.00920213713f,
+    -0.0109362936f, -0.0118866975f, -0.011688734f, -0.0100097071f, -0.00658879576f, -0.00127424502f, 0.00594672996f, 0.014929338f,
+    0.0253668895f, 0.0368022998f, 0.048655265f, 0.0602631969f, 0.0709324003f, 0.0799947099f, 0.0868640537f, 0.0910872598f,
+    0.0923839089f, 0.0906711171f, 0.0860706761f, 0.0788978231f, 0.069632835f, 0.05887843f, 0.0473073983f, 0.0356058207f,
+    0.0244175619f, 0.0142954169f, 0.00566339761f, -0.00120671345f, -0.00620307587f, -0.00936605329f, -0.0108669497f, -0.0109764828f,
+    -0.0100271512f, -0.00837401496f, -0.00635822451f, -0.00427695323f, -0.00236232231f, -0.000770610279f, 0.000418315027f, 0.00119264084f,
+    0.00159359934f, 0.0016966696f, 0.00159202934f, 0.00136704729f, 0.00109300302f, 0.000817367706f, 0.00056201114f, 0.000326761129f
+  },
+  { // 2220.2 Hz
+    -0.000510866656f, -0.000314186886f, -6.13114246e-05f, 0.000274073015f, 0.000709406555f, 0.00123930516f, 0.00182408377f, 0.00238392878f,
+    0.00280119808f, 0.00293209451f, 0.00262736284f, 0.00175994571f, 0.000255981809f, -0.00187558508f, -0.00451997271f, -0.00744495276f,
+    -0.010304377f, -0.0126587086f, -0.0140121233f, -0.0138632886f, -0.0117646661f, -0.00738347506f, -0.000556578157f, 0.00866831234f,
+    0.0200115201f, 0.0329646581f, 0.0468196956f, 0.0607221144f, 0.0737433366f, 0.0849650129f, 0.093566026f, 0.0989024459f,
+    0.100571276f, 0.0984505986f, 0.0927114355f, 0.0837999733f, 0.0723922716f, 0.0593268022f, 0.0455226786f, 0.0318929445f,
+    0.0192626113f, 0.00830024335f, -0.000530059954f, -0.00699217071f, -0.0110759415f, -0.0129718381f, -0.0130269915f, -0.0116893777f,
+    -0.0094477664f, -0.00677496378f, -0.00408078254f, -0.00167931754f, 0.000227213842f, 0.00154823402f, 0.00229052528f, 0.00253391853f,
+    0.00240188742f, 0.00203210224f, 0.00155135442f, 0.00105801587f, 0.000613587149f, 0.000243194103f, -5.66093488e-05f, -0.000305458994f
+  },
+  { // 2415.0 Hz
+    -0.000796633841f, -0.000800499932f, -0.000740139564f, -0.000580148145f, -0.000274706389f, 0.000215603512f, 0.000903102656f, 0.00175332523f,
+    0.00267177477f, 0.00350200659f, 0.00403824087f, 0.00405314781f, 0.00333841089f, 0.00175270842f, -0.000730570808f, -0.00398474344f,
+    -0.00770895187f, -0.0114317027f, -0.0145422924f, -0.0163493968f, -0.0161615956f, -0.0133805141f, -0.00759431003f, 0.00134203242f,
+    0.0132523868f, 0.0276211569f, 0.0436164731f, 0.0601548741f, 0.0760015755f, 0.0898951566f, 0.100681645f, 0.107441156f,
+    0.109590781f, 0.106950298f, 0.0997620637f, 0.0886625149f, 0.0746091368f, 0.0587725963f, 0.0424081929f, 0.0267231658f,
+    0.012756431f, 0.0012850478f, -0.00723247862f, -0.0126713827f, -0.0152154669f, -0.0152980822f, -0.0135198867f, -0.0105563288f,
+    -0.00706810088f, -0.00362614692f, -0.00065958376f, 0.0015692991f, 0.00296323073f, 0.00356557666f, 0.00352052357f, 0.00302643702f,
+    0.00229091339f, 0.00149456484f, 0.000768074534f, 0.000184064381f, -0.000237601851f, -0.000514784746f, -0.000683377022f, -0.000778262602f
+  },
+  { // 2626.9 Hz
+    -0.000443946974f, -0.000696174915f, -0.00092286745f, -0.00109452244f, -0.00115147385f, -0.00101173642f, -0.000591792467f, 0.000163123757f,
+    0.00124604634f, 0.00256149559f, 0.00391396186f, 0.00501871689f, 0.00553802596f, 0.00514052653f, 0.00357592652f, 0.000752438746f,
+    -0.00319838712f, -0.00788474839f, -0.0126577979f, -0.0166612975f, -0.0189262393f, -0.0185005731f, -0.01459674f, -0.00673469357f,
+    0.00514340413f, 0.0206080633f, 0.0387417483f, 0.058208002f, 0.0773849899f, 0.094547517f, 0.108073191f, 0.116643701f,
+    0.119412008f, 0.116110801f, 0.107086099f, 0.0932510822f, 0.0759672055f, 0.0568704606f, 0.0376685097f, 0.0199380748f,
+    0.00495091797f, -0.00644872881f, -0.0139012773f, -0.0175200924f, -0.0178182634f, -0.0155899268f, -0.0117678829f, -0.00728097984f,
+    -0.00293250278f, 0.000684724996f, 0.00322846606f, 0.00460260451f, 0.00491564679f, 0.00441499316f, 0.00341217759f, 0.00221364663f,
+    0.00106842249f, 0.00013904952f, -0.000503310139f, -0.000863736571f, -0.000995944497f, -0.000971206172f, -0.000852091201f, -0.000676835661f
+  },
+  { // 2857.3 Hz
+    0.000354915139f, 4.55745434e-05f, -0.000328063321f, -0.000761881434f, -0.00121752509f, -0.00160796434f, -0.00179994847f, -0.00163771164f,
+    -0.00098606858f, 0.000215654668f, 0.00190274791f, 0.00385351237f, 0.00569138374f, 0.00692930722f, 0.007055714f, 0.00565089019f,
+    0.00251299484f, -0.00223310338f, -0.00807177734f, -0.0140996292f, -0.0191067775f, -0.0217329051f, -0.0206787463f, -0.0149401913f,
+    -0.00402403175f, 0.0118963277f, 0.0319193928f, 0.0544678427f, 0.0774546094f, 0.0985422651f, 0.115457425f, 0.126310452f,
+    0.129868074f, 0.125733388f, 0.114402889f, 0.0971910544f, 0.0760355494f, 0.0532162452f, 0.0310351497f, 0.0115095663f,
+    -0.00387343685f, -0.0143058093f, -0.0196935061f, -0.0205811195f, -0.0179882325f, -0.0131929813f, -0.00750428561f, -0.00206210521f,
+    0.00230408768f, 0.00514235316f, 0.00637013459f, 0.00620420117f, 0.00505176978f, 0.00338995626f, 0.00165880864f, 0.000186368945f,
+    -0.000845504547f, -0.0013960138f, -0.00153082772f, -0.00137274647f, -0.00105307421f, -0.000676042739f, -0.000302903595f, 4.43085144e-05f
+  },
+  { // 3108.0 Hz
+    0.000795571871f, 0.0007752153f, 0.000622462515f, 0.000299915962f, -0.000219986246f, -0.000919152431f, -0.00170182588f, -0.00238283771f,
+    -0.00270870956f, -0.00241503918f, -0.0013114068f, 0.000626723031f, 0.00318716373f, 0.00589958786f, 0.00808367289f, 0.00897129326f,
+    0.00788742675f, 0.0044553693f, -0.00122119731f, -0.00844946878f, -0.0159526446f, -0.022008342f, -0.0247111031f, -0.0223198751f,
+    -0.0136272026f, 0.00172521178f, 0.0230560947f, 0.0486307602f, 0.0758423629f, 0.101567677f, 0.122639923f, 0.136354689f,
+    0.140915101f, 0.135731737f, 0.121519784f, 0.100174981f, 0.0744528412f, 0.0475132909f, 0.022417386f, 0.00166912344f,
+    -0.0131172198f, -0.0213721412f, -0.023533741f, -0.020841959f, -0.0150187482f, -0.00790614293f, -0.00113534021f, 0.00411420282f,
+    0.00723173901f, 0.00816394527f, 0.00729821025f, 0.00528223511f, 0.00282898117f, 0.000551331735f, -0.00114327963f, -0.00208707888f,
+    -0.00232258313f, -0.00203117219f, -0.00144737601f, -0.000784696046f, -0.000190272747f, 0.000266125409f, 0.000574724823f, 0.00075368036f
+  },
+  { // 3380.7 Hz
+    0.000230493031f, 0.000590771281f, 0.000897995964f, 0.0010847797f, 0.00104872468f, 0.000680042613f, -8.37415626e-05f, -0.00119416429f,
+    -0.00244719925f, -0.0034856595f, -0.00386532117f, -0.00318090782f, -0.00122418118f, 0.00187286848f, 0.00556375332f, 0.00892632971f,
+    0.0108325468f, 0.0102296388f, 0.0064751225f, -0.00035954512f, -0.00930878877f, -0.0185299187f, -0.0255491272f, -0.0277119112f,
+    -0.0227564977f, -0.00938699122f, 0.0122912104f, 0.0405915039f, 0.0723884084f, 0.103577466f, 0.129773249f, 0.147106496f,
+    0.152952671f, 0.146434422f, 0.128587958f, 0.102157213f, 0.0710621673f, 0.0396587659f, 0.0119507146f, -0.00908181088f,
+    -0.0219048612f, -0.0265352236f, -0.0243318373f, -0.0175478827f, -0.00876383562f, -0.000336425305f, 0.00601988466f, 0.00944631204f,
+    0.00993202897f, 0.0081230281f, 0.00502314258f, 0.00167688521f, -0.0010866042f, -0.0027982623f, -0.00336977281f, -0.00301230985f,
+    -0.00209835111f, -0.00101792636f, -7.12208753e-05f, 0.000580563932f, 0.00090707364f, 0.00096256111f, 0.00082912715f, 0.000574360067f
+  },
+  { // 3677.4 Hz
+    -0.0006930355f, -0.000429826632f, -9.51829977e-06f, 0.000541603601f, 0.00113638383f, 0.00160265305f, 0.00170325136f, 0.00121111444f,
+    2.33696886e-05f, -0.00172767031f, -0.00362163178f, -0.00500145799f, -0.00514365895f, -0.00351628706f, -4.91426476e-05f, 0.00468437809f,
+    0.00946673815f, 0.0126661943f, 0.0126758591f, 0.0084637051f, 7.78805676e-05f, -0.0110637623f, -0.0222332006f, -0.029848026f,
+    -0.0302577751f, -0.0206877785f, -9.95963273e-05f, 0.030276845f, 0.066917499f, 0.104539654f, 0.13710594f, 0.159073749f,
+    0.166591588f, 0.158347002f, 0.135853675f, 0.103106207f, 0.0656914913f, 0.0295811239f, -9.6837272e-05f, -0.0200151984f,
+    -0.0291254116f, -0.028580636f, -0.0211738982f, -0.0104774126f, 7.33212999e-05f, 0.00791946382f, 0.0117846743f, 0.0116962902f,
+    0.00867976106f, 0.00426281978f, -4.43676258e-05f, -0.00314833094f, -0.00456559987f, -0.0043998104f, -0.0031573253f, -0.00149305412f,
+    2.00383405e-05f, 0.00103237496f, 0.00144858836f, 0.00136821213f, 0.000982892682f, 0.00048058289f, -8.78832542e-06f, -0.000417886348f
+  },
+  { // 4000.0 Hz
+    -0.00045872589f, -0.000783960356f, -0.000932333098f, -0.000807434457f, -0.000326544313f, 0.000506537982f, 0.0015258234f, 0.00238015146f,
+    0.00260748447f, 0.00181026795f, -0.000120018667f, -0.00282590504f, -0.00546002673f, -0.00687910498f, -0.00603829886f, -0.00247269691f,
+    0.00331654808f, 0.00976099022f, 0.0145273369f, 0.0152079404f, 0.0102282906f, -0.000318232146f, -0.0142282024f, -0.0273750387f,
+    -0.0345792834f, -0.0309892041f, -0.0136018445f, 0.0175389388f, 0.0588787587f, 0.103841835f, 0.144212375f, 0.172069267f,
+    0.181749107f, 0.171283149f, 0.142895204f, 0.102417957f, 0.0578000303f, 0.0171359177f, -0.0132250411f, -0.0299817145f,
+    -0.0332851923f, -0.0262126552f, -0.0135502988f, -0.000301366697f, 0.0096295082f, 0.0142300248f, 0.0135059827f, 0.0090135499f,
+    0.00304084093f, -0.00225017305f, -0.00545157817f, -0.00615925226f, -0.00484641333f, -0.00248596438f, -0.000104631834f, 0.00156443508f,
+    0.00223578768f, 0.00202888239f, 0.00129768868f, 0.000432440081f, -0.000282438036f, -0.000716463452f, -0.000860830912f, -0.000762182484f
+  }
+};
+
+const float synth_fir_lowpass_f32[SYNTH_FIR_LOWPASS_TAPS] = {
+    0.000792368993f, 0.000722771461f, 0.000354973914f, -0.000279727567f, -0.00103243951f, -0.00160327719f, -0.0016064272f, -0.000753003103f,
+    0.000914780095f, 0.00287495316f, 0.00420138642f, 0.0039137675f, 0.00150206318f, -0.0026125596f, -0.00696045943f, -0.0094268448f,
+    -0.00812445447f, -0.00242337157f, 0.00633902578f, 0.0149082257f, 0.0191010289f, 0.0155062967f, 0.00329218187f, -0.0146596513f,
+    -0.0319265287f, -0.0402094282f, -0.0320797527f, -0.00389436244f, 0.0422224359f, 0.0981918387f, 0.151844837f, 0.19034084f,
+    0.204034837f, 0.189471246f, 0.150457954f, 0.0968454331f, 0.041448871f, -0.00380487524f, -0.0311910672f, -0.03890218f,
+    -0.030731714f, -0.0140371814f, 0.00313532564f, 0.0146845047f, 0.0179828205f, 0.0139495827f, 0.00589335631f, -0.00223780375f,
+    -0.00744906243f, -0.00857850065f, -0.00628413557f, -0.00233917256f, 0.00133325703f, 0.00344296303f, 0.00366275327f, 0.00248453692f,
+    0.000784378232f, -0.000641872905f, -0.00136624094f, -0.00136874498f, -0.000892988105f, -0.000248211575f, 0.000327750371f, 0.000702693374f
+};
+
+const int16_t synth_fir_lowpass_q15[SYNTH_FIR_LOWPASS_TAPS] = {
+    26, 24, 12, -9, -34, -53, -53, -25,
+    30, 94, 138, 128, 49, -86, -228, -309,
+    -266, -79, 208, 489, 626, 508, 108, -480,
+    -1046, -1318, -1051, -128, 1384, 3218, 4976, 6237,
+    6686, 6209, 4930, 3173, 1358, -125, -1022, -1275,
+    -1007, -460, 103, 481, 589, 457, 193, -73,
+    -244, -281, -206, -77, 44, 113, 120, 81,
+    26, -21, -45, -45, -29, -8, 11, 23
+};
@@ -0,0 +1,293 @@
+/*
+ * synth_tasks.c
+ *
+ *  Tâches FreeRTOS du synthé (voir synth_tasks.h).
+ *
+ *  - audio : rend une moitié ping-pong dès que le DMA TX l'a libérée. Le
+ *    drapeau TX_buffer_empty est testé avant l'attente : une notification
+ *    donnée entre le test et ulTaskNotifyTake() n'est pas perdue.
+ *  - USB : seule tâche qui appelle la bibliothèque hôte (USBH_Process, qui
+ *    réarme la réception dès la fin de chaque transfert). Le callback de
+ *    réception décode les paquets et recopie les messages de canal,
+ *    horodatés, dans la file de la tâche de contrôle.
+ *  - contrôle : horodate chaque paquet en échantillons et le poste au synthé.
+ *    Seul producteur de la file MIDI du synthé (SPSC).
+ *  - affichage : LCD et dumps du profil à basse priorité.
+ */
+
+#if defined(SYNTH_RTOS)
+
+#include <stdio.h>
+#include <string.h>
+#include "FreeRTOS.h"
+#include "task.h"
+#include "queue.h"
+#include "main.h"
+#include "stm32f7_wm8994_init.h"
+#include "synth_memory.h"
+#include "synth_tasks.h"
+#include "synth_telemetry.h"
+
+typedef struct {
+    uint8_t packet[4];
+    uint32_t tick;
+} midi_rx_t;
+
+struct task_def_TypeStruct
+{
+    TaskFunction_t fn;
+    const char* name;
+    uint32_t stack_size;
+    UBaseType_t priority;
+    StackType_t* stack;
+    StaticTask_t* tcb;
+};
+
+extern volatile int32_t TX_buffer_empty;
+extern USBH_HandleTypeDef hUSBHost;
+
+static void audio_task(void* arg);
+static void control_task(void* arg);
+static void usb_task(void* arg);
+static void display_task(void* arg);
+
+// Pile du rendu en DTCM, comme son état chaud
+static StackType_t audio_stack[SYNTH_TASK_STACK_AUDIO] SYNTH_DTCM;
+static StackType_t control_stack[SYNTH_TASK_STACK_CONTROL];
+static StackType_t usb_stack[SYNTH_TASK_STACK_USB];
+static StackType_t display_stack[SYNTH_TASK_STACK_DISPLAY];
+static StackType_t idle_stack[configMINIMAL_STACK_SIZE];
+static StaticTask_t audio_tcb, control_tcb, usb_tcb, display_tcb, idle_tcb;
+
+static const struct task_def_TypeStruct task_defs[] = {
+    { audio_task,   "audio",     SYNTH_TASK_STACK_AUDIO,   SYNTH_TASK_PRIO_AUDIO,   audio_stack,   &audio_tcb },
+    { control_task, "controle",  SYNTH_TASK_STACK_CONTROL, SYNTH_TASK_PRIO_CONTROL, control_stack, &control_tcb },
+    { usb_task,     "usb",       SYNTH_TASK_STACK_USB,     SYNTH_TASK_PRIO_USB,     usb_stack,     &usb_tcb },
+    { display_task, "affichage", SYNTH_TASK_STACK_DISPLAY, SYNTH_TASK_PRIO_DISPLAY, display_stack, &display_tcb },
+};
+#define TASK_DEF_COUNT (sizeof(task_defs) / sizeof(task_defs[0]))
+
+static TaskHandle_t task_handles[TASK_DEF_COUNT];
+static TaskHandle_t audio_handle = NULL;
+static TaskHandle_t usb_handle = NULL;
+
+static midi_rx_t midi_rx_storage[SYNTH_TASK_MIDI_QUEUE];
+static StaticQueue_t midi_rx_queue_buf;
+static QueueHandle_t midi_rx_queue = NULL;
+static volatile uint32_t midi_rx_dropped = 0;
+
+static uint64_t runtime_cycles = 0;
+static uint32_t runtime_last = 0;
+
+//=======================================================================================
+// Tâches
+
+static void audio_task(void* arg) {
+    (void)arg;
+    for (;;) {
+        if (TX_buffer_empty) {
+            process_buffer();
+        } else {
+            ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        }
+    }
+}
+
+static void control_task(void* arg) {
+    midi_rx_t rx;
+
+    (void)arg;
+    for (;;) {
+        if (xQueueReceive(midi_rx_queue, &rx, portMAX_DELAY) == pdTRUE) {
+            midi_post_packet(rx.packet, rx.tick);
+        }
+    }
+}
+
+// La bibliothèque hôte est une machine d'états scrutée : réveil sur
+// événement HCD, sinon à chaque tick (transferts en cours, timeouts)
+static void usb_task(void* arg) {
+    (void)arg;
+    for (;;) {
+        USBH_Process(&hUSBHost);
+        midiApplication();
+        ulTaskNotifyTake(pdTRUE, 1);
+    }
+}
+
+static void display_task(void* arg) {
+    TickType_t last = xTaskGetTickCount();
+
+    (void)arg;
+    for (;;) {
+        profile_service();
+        vTaskDelayUntil(&last, pdMS_TO_TICKS(SYNTH_TASK_DISPLAY_MS));
+    }
+}
+
+//=======================================================================================
+
+void synth_tasks_start(void) {
+    uint32_t i;
+
+    midi_rx_queue = xQueueCreateStatic(SYNTH_TASK_MIDI_QUEUE, sizeof(midi_rx_t),
+                                       (uint8_t*)midi_rx_storage, &midi_rx_queue_buf);
+
+    for (i = 0; i < TASK_DEF_COUNT; i++) {
+        const struct task_def_TypeStruct *d = &task_defs[i];
+        task_handles[i] = xTaskCreateStatic(d->fn, d->name, d->stack_size, NULL, d->priority,
+                                            d->stack, d->tcb);
+    }
+    audio_handle = task_handles[0];
+    usb_handle = task_handles[2];
+
+    // Les IRQ qui réveillent une tâche doivent être de priorité numérique
+    // >= configLIBRARY_MAX_SYSCALL_INTERRUPT_PRIORITY (BSP : DMA audio 3, OTG 4).
+    // Le DMA TX reste devant l'USB ; la DMA RX ne fait que lever un drapeau.
+    HAL_NVIC_SetPriority(AUDIO_OUT_SAIx_DMAx_IRQ, configLIBRARY_MAX_SYSCALL_INTERRUPT_PRIORITY, 0);
+    HAL_NVIC_SetPriority(OTG_FS_IRQn, configLIBRARY_MAX_SYSCALL_INTERRUPT_PRIORITY + 1, 0);
+
+    vTaskStartScheduler();
+    for (;;);
+}
+
+void synth_tasks_audio_isr(void) {
+    BaseType_t woken = pdFALSE;
+
+    // Le DMA tourne déjà pendant la création des tâches
+    if (audio_handle != NULL && xTaskGetSchedulerState() != taskSCHEDULER_NOT_STARTED) {
+        vTaskNotifyGiveFromISR(audio_handle, &woken);
+        portYIELD_FROM_ISR(woken);
+    }
+}
+
+void synth_tasks_usb_isr(void) {
+    BaseType_t woken = pdFALSE;
+
+    if (usb_handle != NULL && xTaskGetSchedulerState() != taskSCHEDULER_NOT_STARTED) {
+        vTaskNotifyGiveFromISR(usb_handle, &woken);
+        portYIELD_FROM_ISR(woken);
+    }
+}
+
+void synth_tasks_midi_rx(const uint8_t* packets, uint32_t numPackets, uint32_t tick) {
+    midi_rx_t rx;
+
+    rx.tick = tick;
+    while (numPackets--) {
+        memcpy(rx.packet, packets, 4);
+        packets += 4;
+        if (xQueueSend(midi_rx_queue, &rx, 0) != pdTRUE) {
+            midi_rx_dropped++;
+            synth_telemetry_midi_overflow();
+        }
+    }
+}
+
+//=======================================================================================
+// Statistiques
+
+// CYCCNT (32 bits, 20 s à 216 MHz) étendu à chaque appel, c'est-à-dire à
+// chaque changement de contexte ; rendu en unités de 1024 cycles
+void synth_tasks_runtime_init(void) {
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->LAR = 0xC5ACCE55;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+    runtime_last = DWT->CYCCNT;
+    runtime_cycles = 0;
+}
+
+// Appelé depuis PendSV et depuis les tâches (uxTaskGetSystemState)
+uint32_t synth_tasks_runtime_counter(void) {
+    UBaseType_t mask = portSET_INTERRUPT_MASK_FROM_ISR();
+    uint32_t now = DWT->CYCCNT;
+    uint32_t value;
+
+    runtime_cycles += (uint32_t)(now - runtime_last);
+    runtime_last = now;
+    value = (uint32_t)(runtime_cycles >> 10);
+    portCLEAR_INTERRUPT_MASK_FROM_ISR(mask);
+    return value;
+}
+
+uint32_t synth_tasks_stats(struct synth_task_stat_TypeStruct* stats, uint32_t count) {
+    TaskStatus_t status[SYNTH_TASK_COUNT];
+    uint32_t total, n, i, j;
+
+    n = uxTaskGetSystemState(status, SYNTH_TASK_COUNT, &total);
+    if (n > count) n = count;
+
+    for (i = 0; i < n; i++) {
+        const TaskStatus_t *s = &status[i];
+        uint32_t size = configMINIMAL_STACK_SIZE;   // idle
+
+        for (j = 0; j < TASK_DEF_COUNT; j++) {
+            if (task_handles[j] == s->xHandle) size = task_defs[j].stack_size;
+        }
+        stats[i].name = s->pcTaskName;
+        stats[i].priority = s->uxBasePriority;
+        stats[i].cpu_permille = total ? (uint32_t)((uint64_t)s->ulRunTimeCounter * 1000u / total) : 0;
+        stats[i].stack_size = size;
+        stats[i].stack_used = size - s->usStackHighWaterMark;
+    }
+    return n;
+}
+
+//=======================================================================================
+// Dump texte (CSV), même présentation que synth_profile_format :
+//   # tasks midi_dropped=<n>
+//   task,priority,cpu_permille,stack_used,stack_size
+
+int synth_tasks_format(char* buf, int len) {
+    struct synth_task_stat_TypeStruct stats[SYNTH_TASK_COUNT];
+    uint32_t count = synth_tasks_stats(stats, SYNTH_TASK_COUNT);
+    int n, pos;
+    uint32_t i;
+
+    n = snprintf(buf, len, "# tasks midi_dropped=%lu\ntask,priority,cpu_permille,stack_used,stack_size\n",
+                 (unsigned long)midi_rx_dropped);
+    if (n < 0 || n >= len) return len - 1;
+    pos = n;
+
+    for (i = 0; i < count; i++) {
+        n = snprintf(buf + pos, len - pos, "%s,%lu,%lu,%lu,%lu\n", stats[i].name,
+                     (unsigned long)stats[i].priority, (unsigned long)stats[i].cpu_permille,
+                     (unsigned long)stats[i].stack_used, (unsigned long)stats[i].stack_size);
+        if (n < 0 || n >= len - pos) return len - 1;
+        pos += n;
+    }
+    return pos;
+}
+
+void synth_tasks_dump(void) {
+    static char text[48 * (SYNTH_TASK_COUNT + 2)];
+    int i, n = synth_tasks_format(text, sizeof(text));
+
+    for (i = 0; i < n; i++) {
+        ITM_SendChar(text[i]);
+    }
+}
+
+//=======================================================================================
+// Crochets du noyau
+
+// Allocation statique : la tâche idle fournie par l'application
+void vApplicationGetIdleTaskMemory(StaticTask_t** ppxIdleTaskTCBBuffer, StackType_t** ppxIdleTaskStackBuffer,
+                                   uint32_t* pulIdleTaskStackSize) {
+    *ppxIdleTaskTCBBuffer = &idle_tcb;
+    *ppxIdleTaskStackBuffer = idle_stack;
+    *pulIdleTaskStackSize = configMINIMAL_STACK_SIZE;
+}
+
+// Pile débordée : arrêt, LED allumée, nom de la tâche visible au débogueur
+void vApplicationStackOverflowHook(TaskHandle_t xTask, char* pcTaskName) {
+    volatile const char *name = pcTaskName;
+
+    (void)xTask;
+    (void)name;
+    taskDISABLE_INTERRUPTS();
+    BSP_LED_On(LED1);
+    for (;;);
+}
+
+#endif /* SYNTH_RTOS */
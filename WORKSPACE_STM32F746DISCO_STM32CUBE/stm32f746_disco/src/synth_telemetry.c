@@ -0,0 +1,160 @@
+/*
+ * synth_telemetry.c
+ *
+ *  Chaque compteur n'a qu'un écrivain : le callback DMA (dma_halves,
+ *  dma_time), les callbacks d'erreur, ou le rendu. La remise à zéro est
+ *  seulement demandée par synth_telemetry_reset() ; le rendu l'applique en
+ *  début de moitié, en relevant les compteurs d'interruption comme origine.
+ */
+
+#include <string.h>
+#include "synth_telemetry.h"
+#include "synth.h"
+
+struct telemetry_counts_TypeStruct
+{
+    uint32_t dma_halves;
+    uint32_t blocks;
+    uint32_t sai_errors;
+    uint32_t midi_overflows;
+};
+
+// Écrits en interruption
+static volatile uint32_t dma_halves = 0;
+static volatile uint32_t dma_time = 0;
+static volatile uint32_t sai_errors = 0;
+static volatile uint32_t midi_overflows = 0;
+static volatile uint32_t reset_pending = 0;
+
+// Écrits par le rendu
+static uint32_t budget = 1;
+static uint32_t blocks = 0;
+static uint32_t late = 0;
+static uint32_t late_max = 0;
+static uint32_t render_start = 0;
+static uint32_t halves_start = 0;
+static uint32_t load_last = 0;
+static uint32_t load_max = 0;
+static uint64_t render_sum = 0;
+static uint32_t voices_last = 0;
+static uint32_t voices_max = 0;
+static struct telemetry_counts_TypeStruct origin;
+
+//=======================================================================================
+
+void synth_telemetry_init(uint32_t budget_ticks) {
+#if defined(USE_HAL_DRIVER)
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->LAR = 0xC5ACCE55;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+#endif
+    budget = budget_ticks ? budget_ticks : 1;
+    blocks = 0;
+    late = 0;
+    late_max = 0;
+    load_last = 0;
+    load_max = 0;
+    render_sum = 0;
+    voices_last = 0;
+    voices_max = 0;
+    memset(&origin, 0, sizeof(origin));
+    dma_halves = 0;
+    sai_errors = 0;
+    midi_overflows = 0;
+    reset_pending = 0;
+}
+
+void synth_telemetry_reset(void) {
+    reset_pending = 1;
+}
+
+void synth_telemetry_dma_half(uint32_t now) {
+    dma_time = now;
+    dma_halves++;
+}
+
+void synth_telemetry_sai_error(void) {
+    sai_errors++;
+}
+
+void synth_telemetry_midi_overflow(void) {
+    midi_overflows++;
+}
+
+//=======================================================================================
+
+void synth_telemetry_render_begin(uint32_t now) {
+    render_start = now;
+    halves_start = dma_halves;
+
+    if (reset_pending) {
+        reset_pending = 0;
+        // la moitié en cours appartient déjà à la nouvelle fenêtre
+        origin.dma_halves = halves_start - 1;
+        origin.blocks = blocks;
+        origin.sai_errors = sai_errors;
+        origin.midi_overflows = midi_overflows + synth_midi_dropped();
+        late = 0;
+        late_max = 0;
+        load_max = 0;
+        render_sum = 0;
+        voices_max = 0;
+    }
+}
+
+void synth_telemetry_render_end(uint32_t now, uint32_t voices) {
+    uint32_t halves, swap, elapsed = now - render_start;
+
+    // relecture si un échange tombe entre les deux lectures
+    do {
+        halves = dma_halves;
+        swap = dma_time;
+    } while (halves != dma_halves);
+
+    if (halves != halves_start) {
+        uint32_t lateness = (now - swap) + (halves - halves_start - 1) * budget;
+        late++;
+        if (lateness > late_max) late_max = lateness;
+    }
+
+    blocks++;
+    render_sum += elapsed;
+    load_last = (uint32_t)((uint64_t)elapsed * 1000u / budget);
+    if (load_last > load_max) load_max = load_last;
+    voices_last = voices;
+    if (voices > voices_max) voices_max = voices;
+}
+
+//=======================================================================================
+
+static uint16_t clamp16(uint32_t v) {
+    return (v > 0xFFFFu) ? 0xFFFFu : (uint16_t)v;
+}
+
+// Lue hors du rendu : valeurs cohérentes à une moitié près
+void synth_telemetry_snapshot(struct synth_telemetry_record_TypeStruct* rec, uint32_t tick) {
+    uint32_t n = blocks - origin.blocks;
+    const uint8_t *p = (const uint8_t*)rec;
+    uint32_t i, sum = 0;
+
+    rec->magic = TELEMETRY_MAGIC;
+    rec->tick = tick;
+    rec->budget = budget;
+    rec->dma_halves = dma_halves - origin.dma_halves;
+    rec->blocks = n;
+    rec->late = late;
+    rec->late_max = late_max;
+    rec->sai_errors = sai_errors - origin.sai_errors;
+    rec->midi_overflows = midi_overflows + synth_midi_dropped() - origin.midi_overflows;
+    rec->load_last = clamp16(load_last);
+    rec->load_avg = clamp16(n ? (uint32_t)(render_sum * 1000u / ((uint64_t)n * budget)) : 0);
+    rec->load_max = clamp16(load_max);
+    rec->voices = (uint8_t)voices_last;
+    rec->voices_max = (uint8_t)voices_max;
+    rec->reserved = 0;
+
+    for (i = 0; i < sizeof(*rec) - sizeof(rec->checksum); i++) {
+        sum += p[i];
+    }
+    rec->checksum = (uint16_t)sum;
+}
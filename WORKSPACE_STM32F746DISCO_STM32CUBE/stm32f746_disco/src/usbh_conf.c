@@ -1,6 +1,11 @@
 #include "stm32f7xx_hal.h"
 #include "usbh_core.h"
 #include "stm32746g_discovery.h"
+#if defined(SYNTH_RTOS)
+#include "FreeRTOS.h"
+#include "task.h"
+#include "synth_tasks.h"
+#endif
 
 HCD_HandleTypeDef hhcd;
 
@@ -151,6 +156,9 @@ void HAL_HCD_SOF_Callback(HCD_HandleTypeDef *hhcd) {
  */
 void HAL_HCD_Connect_Callback(HCD_HandleTypeDef *hhcd) {
 	USBH_LL_Connect(hhcd->pData);
+#if defined(SYNTH_RTOS)
+	synth_tasks_usb_isr();
+#endif
 }
 
 /**
@@ -160,6 +168,9 @@ void HAL_HCD_Connect_Callback(HCD_HandleTypeDef *hhcd) {
  */
 void HAL_HCD_Disconnect_Callback(HCD_HandleTypeDef *hhcd) {
 	USBH_LL_Disconnect(hhcd->pData);
+#if defined(SYNTH_RTOS)
+	synth_tasks_usb_isr();
+#endif
 }
 
 /**
@@ -172,6 +183,10 @@ void HAL_HCD_Disconnect_Callback(HCD_HandleTypeDef *hhcd) {
 void HAL_HCD_HC_NotifyURBChange_Callback(HCD_HandleTypeDef *hhcd, uint8_t chnum,
 		HCD_URBStateTypeDef urb_state) {
 	/* To be used with OS to sync URB state with the global state machine */
+#if defined(SYNTH_RTOS)
+	/* Réveille la tâche USB : transfert terminé, USBH_Process à relancer */
+	synth_tasks_usb_isr();
+#endif
 }
 
 /*******************************************************************************
@@ -450,5 +465,12 @@ uint8_t USBH_LL_GetToggle(USBH_HandleTypeDef *phost, uint8_t pipe) {
  * @retval None
  */
 void USBH_Delay(uint32_t Delay) {
+#if defined(SYNTH_RTOS)
+	/* Énumération dans la tâche USB : rend la main au lieu de scruter le tick */
+	if (xTaskGetSchedulerState() != taskSCHEDULER_NOT_STARTED) {
+		vTaskDelay(pdMS_TO_TICKS(Delay) + 1);
+		return;
+	}
+#endif
 	HAL_Delay(Delay);
 }
@@ -0,0 +1,452 @@
+/*
+ * voice.c
+ *
+ *  Pool de voix polyphonique : allocation O(1), vol de voix,
+ *  rendu oscillateur suréchantillonné -> décimation -> filtre (FIR, biquad, SVF ou aucun)
+ *  -> ADSR x gain de chaque voix active,
+ *  sommé par bloc. Coupure et gain suivent la matrice de modulation
+ *  (modulation.c) : gain en rampe sur le bloc, coefficients du filtre
+ *  recalculés au plus tous les MOD_COEFF_INTERVAL échantillons (à chaque
+ *  bloc pour le SVF, dont la coupure suit une rampe par échantillon).
+ */
+
+#include "synth_opt.h"
+#include "voice.h"
+#include "synth_profile.h"
+#include "synth_tables.h"
+#include "synth_memory.h"
+
+// ============== Variables globales ==============
+
+// État chaud du rendu (phases, enveloppes, états et coefficients de filtre) en DTCM
+struct voice_pool_TypeStruct voices SYNTH_DTCM;
+
+// Noyaux de la chaîne selon SYNTH_FORMAT (synth_format.h)
+#if (SYNTH_FORMAT == SYNTH_FORMAT_Q15)
+#define voice_osc_render        osc_render_block_q15
+#define voice_iir_init          IIR_init_q31
+#define voice_iir_set           IIR_set_q31
+#define voice_iir_process       IIR_process_block_q15
+#define voice_fir_init          arm_fir_init_q15
+#define voice_fir_process       arm_fir_q15
+#define voice_svf_process       SVF_bank_process_q15
+#define voice_svf_process_pair  SVF_bank_process_pair_q15
+#else
+#define voice_osc_render        osc_render_block
+#define voice_iir_init          IIR_init_f32
+#define voice_iir_set           IIR_set_f32
+#define voice_iir_process       IIR_process_block
+#define voice_fir_init          arm_fir_init_f32
+#define voice_fir_process       arm_fir_f32
+#define voice_svf_process       SVF_bank_process
+#define voice_svf_process_pair  SVF_bank_process_pair
+#endif
+
+// Recalcul des coefficients : le SVF suit la modulation à chaque bloc
+#if (VOICE_FILTER == VOICE_FILTER_SVF)
+#define VOICE_COEFF_INTERVAL    0
+#else
+#define VOICE_COEFF_INTERVAL    MOD_COEFF_INTERVAL
+#endif
+
+// Incréments de phase et banque FIR générés pour la fréquence du synthé
+_Static_assert(SYNTH_TABLES_FE == (uint32_t)SYNTH_SAMPLE_RATE,
+               "synth_tables.h : régénérer avec make -C host tables TABLES_FE=...");
+
+// Buffers de travail d'une voix
+static synth_sample_t osc_block[AUDIO_BLOCK_SIZE] SYNTH_DTCM;
+#if (VOICE_FILTER != VOICE_FILTER_NONE)
+static synth_sample_t filt_block[AUDIO_BLOCK_SIZE] SYNTH_DTCM;
+#endif
+static synth_sample_t env_block[AUDIO_BLOCK_SIZE] SYNTH_DTCM;
+#if (VOICE_FILTER == VOICE_FILTER_SVF)
+static synth_sample_t pair_block[AUDIO_BLOCK_SIZE] SYNTH_DTCM;  // seconde voix d'une paire
+#endif
+#if (VOICE_FILTER == VOICE_FILTER_FIR) && (SYNTH_FORMAT == SYNTH_FORMAT_Q15)
+static float32_t fir_interp[VOICE_FIR_TAPS];    // coefficients flottants avant conversion Q15
+#endif
+
+static void voice_update_cutoff(struct voice_pool_TypeStruct* pool, uint8_t v);
+#if (VOICE_FILTER != VOICE_FILTER_NONE)
+static void voice_modulate_filter(struct voice_pool_TypeStruct* pool, uint8_t v, uint32_t blockSize);
+#endif
+static void voice_gain_ramp(synth_sample_t* pEnv, float32_t from, float32_t to, uint32_t blockSize);
+static uint8_t voice_alloc(struct voice_pool_TypeStruct* pool);
+static uint8_t voice_steal(struct voice_pool_TypeStruct* pool, uint8_t note);
+static void voice_free(struct voice_pool_TypeStruct* pool, uint8_t v);
+static void voice_oscillator(struct voice_pool_TypeStruct* pool, uint8_t v, synth_sample_t* pDst, uint32_t blockSize);
+static void voice_envelope_mix(struct voice_pool_TypeStruct* pool, uint8_t v, synth_sample_t* pSrc, synth_sample_t* pMix, uint32_t blockSize);
+
+//=======================================================================================
+
+#if (VOICE_FILTER == VOICE_FILTER_BIQUAD)
+// Passe-bas résonant : quelques sections recalculées, l'état est conservé
+static void voice_update_cutoff(struct voice_pool_TypeStruct* pool, uint8_t v) {
+    float cutoff = pool->cutoff_ratio[v] * pool->freq[v];
+    if (cutoff > FIR_BANK_FMAX) cutoff = FIR_BANK_FMAX;
+    if (cutoff < FIR_BANK_FMIN) cutoff = FIR_BANK_FMIN;
+    voice_iir_set(&pool->iir[v], IIR_LOWPASS, VOICE_BIQUAD_ORDER, cutoff, SYNTH_SAMPLE_RATE, pool->resonance[v], 0.0f);
+}
+#elif (VOICE_FILTER == VOICE_FILTER_FIR)
+// Interpole la banque dans le tampon inactif puis bascule pCoeffs :
+// le rendu ne voit jamais un jeu de coefficients à moitié écrit
+static void voice_update_cutoff(struct voice_pool_TypeStruct* pool, uint8_t v) {
+    float cutoff = pool->cutoff_ratio[v] * pool->freq[v];
+#if (SYNTH_FORMAT == SYNTH_FORMAT_Q15)
+    q15_t *next = (pool->fir[v].pCoeffs == pool->fir_coeffs[v][0]) ? pool->fir_coeffs[v][1] : pool->fir_coeffs[v][0];
+
+    FIR_bank_interp(cutoff, fir_interp);
+    arm_float_to_q15(fir_interp, next, VOICE_FIR_TAPS);
+#else
+    float32_t *next = (pool->fir[v].pCoeffs == pool->fir_coeffs[v][0]) ? pool->fir_coeffs[v][1] : pool->fir_coeffs[v][0];
+
+    FIR_bank_interp(cutoff, next);
+#endif
+    pool->fir[v].pCoeffs = next;
+}
+#elif (VOICE_FILTER == VOICE_FILTER_SVF)
+// Nouvelle cible, atteinte en rampe sur le prochain bloc, état conservé
+static void voice_update_cutoff(struct voice_pool_TypeStruct* pool, uint8_t v) {
+    float cutoff = pool->cutoff_ratio[v] * pool->freq[v];
+    if (cutoff > FIR_BANK_FMAX) cutoff = FIR_BANK_FMAX;
+    if (cutoff < FIR_BANK_FMIN) cutoff = FIR_BANK_FMIN;
+    SVF_bank_set(&pool->svf, v, cutoff, pool->resonance[v]);
+}
+#else
+static void voice_update_cutoff(struct voice_pool_TypeStruct* pool, uint8_t v) {
+    (void)pool; (void)v;
+}
+#endif
+
+#if (VOICE_FILTER != VOICE_FILTER_NONE)
+// Coupure et résonance modulées : coefficients recalculés si elles ont bougé
+// et que VOICE_COEFF_INTERVAL échantillons se sont écoulés depuis le dernier calcul
+static void voice_modulate_filter(struct voice_pool_TypeStruct* pool, uint8_t v, uint32_t blockSize) {
+    float32_t ratio, q;
+
+    if (pool->coeff_elapsed[v] < VOICE_COEFF_INTERVAL) {
+        pool->coeff_elapsed[v] += blockSize;
+        if (pool->coeff_elapsed[v] < VOICE_COEFF_INTERVAL) return;
+    }
+
+    ratio = mod_voice_value(pool->mod, MOD_DST_CUTOFF, pool->velocity[v], pool->env.level[v]);
+    q = mod_value(pool->mod, MOD_DST_RESONANCE);
+    if (ratio != pool->cutoff_ratio[v] || q != pool->resonance[v]) {
+        pool->cutoff_ratio[v] = ratio;
+        pool->resonance[v] = q;
+        voice_update_cutoff(pool, v);
+        pool->coeff_elapsed[v] = 0;
+    }
+}
+#endif
+
+// Dépile une voix libre et l'ajoute en fin de liste active
+static uint8_t voice_alloc(struct voice_pool_TypeStruct* pool) {
+    uint8_t v;
+
+    if (pool->free_count == 0) return VOICE_NONE;
+
+    v = pool->free_list[--pool->free_count];
+    pool->active_pos[v] = pool->active_count;
+    pool->active_list[pool->active_count++] = v;
+    return v;
+}
+
+// Retire la voix de la liste active (échange avec la dernière) et la rend à la pile
+static void voice_free(struct voice_pool_TypeStruct* pool, uint8_t v) {
+    uint8_t pos = pool->active_pos[v];
+    uint8_t last = pool->active_list[--pool->active_count];
+
+    pool->active_list[pos] = last;
+    pool->active_pos[last] = pos;
+    pool->free_list[pool->free_count++] = v;
+}
+
+// Choisit une voix active à réutiliser selon la politique courante
+static uint8_t voice_steal(struct voice_pool_TypeStruct* pool, uint8_t note) {
+    uint8_t i, v, best = VOICE_NONE;
+
+    if (pool->active_count == 0) return VOICE_NONE;
+
+    if (pool->steal_policy == VOICE_STEAL_QUIETEST) {
+        float level = 2.0f;
+        for (i = 0; i < pool->active_count; i++) {
+            v = pool->active_list[i];
+            if (pool->env.level[v] < level) {
+                level = pool->env.level[v];
+                best = v;
+            }
+        }
+        return best;
+    }
+
+    if (pool->steal_policy == VOICE_STEAL_SAME_NOTE) {
+        for (i = 0; i < pool->active_count; i++) {
+            v = pool->active_list[i];
+            if (pool->note[v] == note) return v;
+        }
+    }
+
+    // VOICE_STEAL_OLDEST, et repli de VOICE_STEAL_SAME_NOTE
+    uint32_t oldest = 0;
+    for (i = 0; i < pool->active_count; i++) {
+        v = pool->active_list[i];
+        uint32_t elapsed = pool->clock - pool->age[v];
+        if (best == VOICE_NONE || elapsed > oldest) {
+            oldest = elapsed;
+            best = v;
+        }
+    }
+    return best;
+}
+
+//=======================================================================================
+
+void voice_pool_init(struct voice_pool_TypeStruct* pool, const struct adsr_TypeStruct* env_ref,
+                     const struct mod_TypeStruct* mod_ref) {
+    uint8_t v;
+
+    memset(pool, 0, sizeof(*pool));
+    pool->steal_policy = VOICE_STEAL_DEFAULT;
+    pool->waveform = VOICE_WAVE_DEFAULT;
+    pool->pitch_ratio = 1.0f;
+    pool->mod = mod_ref;
+#if (VOICE_FILTER == VOICE_FILTER_SVF)
+    SVF_bank_init(&pool->svf, VOICE_SVF_MODE, SYNTH_SAMPLE_RATE);
+#endif
+
+    for (v = 0; v < VOICE_COUNT; v++) {
+        pool->gain[v] = 1.0f;
+        pool->cutoff_ratio[v] = mod_value(mod_ref, MOD_DST_CUTOFF);
+        pool->resonance[v] = mod_value(mod_ref, MOD_DST_RESONANCE);
+#if (VOICE_FILTER == VOICE_FILTER_BIQUAD)
+        voice_iir_init(&pool->iir[v], IIR_LOWPASS, VOICE_BIQUAD_ORDER, 1000.0f, SYNTH_SAMPLE_RATE, pool->resonance[v], 0.0f);
+#elif (VOICE_FILTER == VOICE_FILTER_FIR)
+        voice_fir_init(&pool->fir[v], VOICE_FIR_TAPS, pool->fir_coeffs[v][0], pool->fir_state[v], AUDIO_BLOCK_SIZE);
+        pool->fir[v].pCoeffs = pool->fir_coeffs[v][1];
+        voice_update_cutoff(pool, v);
+#endif
+        // Pile initiale : la voix 0 sort en premier
+        pool->free_list[v] = VOICE_COUNT - 1 - v;
+    }
+    pool->free_count = VOICE_COUNT;
+    pool->active_count = 0;
+
+    // Paramètres partagés : un changement de CC s'applique à toutes les voix sans recopie
+    adsr_bank_init(&pool->env, env_ref);
+}
+
+uint8_t voice_note_on(struct voice_pool_TypeStruct* pool, uint8_t note, uint8_t velocity) {
+    float32_t vel = velocity / 127.0f;
+    uint8_t v = VOICE_NONE;
+    uint8_t i;
+
+    // Même note déjà en cours : on la redéclenche plutôt que de la doubler
+    if (pool->steal_policy == VOICE_STEAL_SAME_NOTE) {
+        for (i = 0; i < pool->active_count; i++) {
+            if (pool->note[pool->active_list[i]] == note) {
+                v = pool->active_list[i];
+                break;
+            }
+        }
+    }
+
+    if (v == VOICE_NONE) {
+        v = voice_alloc(pool);
+        // Voix libre, enveloppe à zéro : le gain prend directement sa valeur
+        if (v != VOICE_NONE) pool->gain[v] = mod_voice_value(pool->mod, MOD_DST_AMP, vel, 0.0f);
+    }
+    if (v == VOICE_NONE) v = voice_steal(pool, note);
+    if (v == VOICE_NONE) return VOICE_NONE;
+
+    // La phase et l'état du FIR sont conservés en cas de vol :
+    // l'attaque repart du niveau courant de l'enveloppe, sans clic
+    pool->note[v] = note;
+    pool->velocity[v] = vel;
+    pool->freq[v] = synth_note_freq[note & 0x7F];
+    pool->increment[v] = synth_note_increment[note & 0x7F] / OVERSAMPLE_FACTOR;
+    pool->gate[v] = 1;
+    pool->age[v] = pool->clock++;
+    pool->cutoff_ratio[v] = mod_voice_value(pool->mod, MOD_DST_CUTOFF, vel, pool->env.level[v]);
+    pool->resonance[v] = mod_value(pool->mod, MOD_DST_RESONANCE);
+    pool->coeff_elapsed[v] = 0;
+    voice_update_cutoff(pool, v);
+    adsr_note_on(&pool->env, v);
+
+    return v;
+}
+
+void voice_note_off(struct voice_pool_TypeStruct* pool, uint8_t note) {
+    uint8_t i, v;
+
+    for (i = 0; i < pool->active_count; i++) {
+        v = pool->active_list[i];
+        if (pool->gate[v] && pool->note[v] == note) {
+            pool->gate[v] = 0;
+            adsr_note_off(&pool->env, v);
+        }
+    }
+}
+
+void voice_set_steal_policy(struct voice_pool_TypeStruct* pool, voice_steal_t policy) {
+    pool->steal_policy = policy;
+}
+
+// Appliquée à toutes les voix, phases conservées
+void voice_set_waveform(struct voice_pool_TypeStruct* pool, osc_wave_t wave) {
+    if (wave >= OSC_WAVE_COUNT) wave = OSC_SQUARE;
+    pool->waveform = wave;
+}
+
+//=======================================================================================
+// Oscillateur à bande limitée d'une voix, pas constant sur le bloc (incrément
+// de la note x pitch_ratio), rendu à OVERSAMPLE_FACTOR x fe puis décimé dans pDst
+
+static void voice_oscillator(struct voice_pool_TypeStruct* pool, uint8_t v, synth_sample_t* pDst, uint32_t blockSize) {
+    uint32_t increment = osc_increment_scale(pool->increment[v], pool->pitch_ratio);
+
+#if (OVERSAMPLE_FACTOR > 1)
+    voice_osc_render(pool->waveform, &pool->phase[v], increment, oversample_input(), blockSize * OVERSAMPLE_FACTOR);
+    oversample_decimate(&pool->os[v], pDst, blockSize);
+#else
+    voice_osc_render(pool->waveform, &pool->phase[v], increment, pDst, blockSize);
+#endif
+}
+
+// Gain de la voix interpolé linéairement de from à to sur le bloc
+#if (SYNTH_FORMAT == SYNTH_FORMAT_Q15)
+static void voice_gain_ramp(synth_sample_t* pEnv, float32_t from, float32_t to, uint32_t blockSize) {
+    q31_t g = (q31_t)VOICE_MIX_GAIN_Q15(from) << 16;
+    q31_t step = (((q31_t)VOICE_MIX_GAIN_Q15(to) << 16) - g) / (q31_t)blockSize;
+    uint32_t i;
+
+    for (i = 0; i < blockSize; i++) {
+        g += step;
+        pEnv[i] = (q15_t)(((q31_t)pEnv[i] * (g >> 16)) >> 15);
+    }
+}
+#else
+static void voice_gain_ramp(synth_sample_t* pEnv, float32_t from, float32_t to, uint32_t blockSize) {
+    float32_t step = (to - from) / blockSize;
+    uint32_t i;
+
+    for (i = 0; i < blockSize; i++) {
+        from += step;
+        pEnv[i] *= from;
+    }
+}
+#endif
+
+// Applique l'enveloppe et le gain de la voix et ajoute le résultat au mixage
+#if (SYNTH_FORMAT == SYNTH_FORMAT_Q15)
+// En Q15 le gain de mixage est appliqué à l'enveloppe avant la somme saturée
+static void voice_envelope_mix(struct voice_pool_TypeStruct* pool, uint8_t v, synth_sample_t* pSrc, synth_sample_t* pMix, uint32_t blockSize) {
+    float32_t gain = mod_voice_value(pool->mod, MOD_DST_AMP, pool->velocity[v], pool->env.level[v]);
+
+    adsr_process_block_q15(&pool->env, v, env_block, blockSize);
+    if (gain != pool->gain[v]) {
+        voice_gain_ramp(env_block, pool->gain[v], gain, blockSize);
+    } else {
+        arm_scale_q15(env_block, VOICE_MIX_GAIN_Q15(gain), 0, env_block, blockSize);
+    }
+    pool->gain[v] = gain;
+    arm_mult_q15(pSrc, env_block, pSrc, blockSize);
+    arm_add_q15(pMix, pSrc, pMix, blockSize);
+}
+#else
+static void voice_envelope_mix(struct voice_pool_TypeStruct* pool, uint8_t v, synth_sample_t* pSrc, synth_sample_t* pMix, uint32_t blockSize) {
+    float32_t gain = mod_voice_value(pool->mod, MOD_DST_AMP, pool->velocity[v], pool->env.level[v]);
+
+    adsr_process_block(&pool->env, v, env_block, blockSize);
+    if (gain != pool->gain[v]) {
+        voice_gain_ramp(env_block, pool->gain[v], gain, blockSize);
+    } else if (gain != 1.0f) {
+        arm_scale_f32(env_block, gain, env_block, blockSize);
+    }
+    pool->gain[v] = gain;
+    arm_mult_f32(pSrc, env_block, pSrc, blockSize);
+    arm_add_f32(pMix, pSrc, pMix, blockSize);
+}
+#endif
+
+//=======================================================================================
+// Rendu : somme des voix actives dans pDst, les voix terminées retournent à la pile
+
+void voice_render_block(struct voice_pool_TypeStruct* pool, synth_sample_t* pDst, uint32_t blockSize) {
+    int32_t n;
+    float32_t pitch;
+    SYNTH_PROFILE_DECLARE(prof_osc);
+    SYNTH_PROFILE_DECLARE(prof_filter);
+    SYNTH_PROFILE_DECLARE(prof_adsr);
+
+#if (SYNTH_FORMAT == SYNTH_FORMAT_Q15)
+    arm_fill_q15(0, pDst, blockSize);
+#else
+    arm_fill_f32(0.0f, pDst, blockSize);
+#endif
+
+    // Pitch bend et vibrato : une exponentielle par bloc pour toutes les voix
+    pitch = mod_value(pool->mod, MOD_DST_PITCH);
+    pool->pitch_ratio = (pitch == 0.0f) ? 1.0f : exp2f(pitch * (1.0f / 12.0f));
+
+    // Parcours à rebours : voice_free() déplace la dernière voix, déjà rendue, à la place courante
+    for (n = (int32_t)pool->active_count - 1; n >= 0; n--) {
+        uint8_t v = pool->active_list[n];
+
+#if (VOICE_FILTER == VOICE_FILTER_SVF)
+        // Voix rendues par paires : les SVF des deux voix dans la même boucle.
+        // v (position n) est libérée avant w (n - 1), l'ordre du mixage est inchangé
+        if (n > 0) {
+            uint8_t w = pool->active_list[n - 1];
+
+            SYNTH_PROFILE_ACC(prof_osc, voice_oscillator(pool, v, osc_block, blockSize));
+            SYNTH_PROFILE_ACC(prof_osc, voice_oscillator(pool, w, pair_block, blockSize));
+            SYNTH_PROFILE_ACC(prof_filter, voice_modulate_filter(pool, v, blockSize));
+            SYNTH_PROFILE_ACC(prof_filter, voice_modulate_filter(pool, w, blockSize));
+            SYNTH_PROFILE_ACC(prof_filter, voice_svf_process_pair(&pool->svf, v, w, osc_block, pair_block, blockSize));
+            SYNTH_PROFILE_ACC(prof_adsr, voice_envelope_mix(pool, v, osc_block, pDst, blockSize));
+            SYNTH_PROFILE_ACC(prof_adsr, voice_envelope_mix(pool, w, pair_block, pDst, blockSize));
+
+            if (!pool->gate[v] && pool->env.state[v] == INIT) {
+                voice_free(pool, v);
+            }
+            if (!pool->gate[w] && pool->env.state[w] == INIT) {
+                voice_free(pool, w);
+            }
+            n--;
+            continue;
+        }
+#endif
+
+        SYNTH_PROFILE_ACC(prof_osc, voice_oscillator(pool, v, osc_block, blockSize));
+
+#if (VOICE_FILTER != VOICE_FILTER_NONE)
+        SYNTH_PROFILE_ACC(prof_filter, voice_modulate_filter(pool, v, blockSize));
+#endif
+#if (VOICE_FILTER == VOICE_FILTER_BIQUAD)
+        SYNTH_PROFILE_ACC(prof_filter, voice_iir_process(&pool->iir[v], osc_block, filt_block, blockSize));
+        SYNTH_PROFILE_ACC(prof_adsr, voice_envelope_mix(pool, v, filt_block, pDst, blockSize));
+#elif (VOICE_FILTER == VOICE_FILTER_FIR)
+        SYNTH_PROFILE_ACC(prof_filter, voice_fir_process(&pool->fir[v], osc_block, filt_block, blockSize));
+        SYNTH_PROFILE_ACC(prof_adsr, voice_envelope_mix(pool, v, filt_block, pDst, blockSize));
+#elif (VOICE_FILTER == VOICE_FILTER_SVF)
+        SYNTH_PROFILE_ACC(prof_filter, voice_svf_process(&pool->svf, v, osc_block, filt_block, blockSize));
+        SYNTH_PROFILE_ACC(prof_adsr, voice_envelope_mix(pool, v, filt_block, pDst, blockSize));
+#else
+        SYNTH_PROFILE_ACC(prof_adsr, voice_envelope_mix(pool, v, osc_block, pDst, blockSize));
+#endif
+
+        if (!pool->gate[v] && pool->env.state[v] == INIT) {
+            voice_free(pool, v);
+        }
+    }
+
+#if (SYNTH_FORMAT != SYNTH_FORMAT_Q15)
+    arm_scale_f32(pDst, VOICE_MIX_GAIN, pDst, blockSize);
+#endif
+
+    // Une mesure par étage et par bloc, toutes voix confondues
+    SYNTH_PROFILE_RECORD(PROF_OSC, prof_osc, blockSize);
+    SYNTH_PROFILE_RECORD(PROF_FILTER, prof_filter, blockSize);
+    SYNTH_PROFILE_RECORD(PROF_ADSR, prof_adsr, blockSize);
+}